@@ -0,0 +1,88 @@
+// Times TimeEMA::update with std::exp against the Nearest and Linear alpha
+// tables over the default tick interval range, and reports the largest
+// deviation of each table-driven EMA from the exact one.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <optional>
+#include <print>
+#include <random>
+#include <vector>
+
+#include "trading/AlphaTable.h"
+#include "trading/TimeEMA.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr auto kPeriod = 1s;
+constexpr auto kMinDt = 50ms;
+constexpr auto kMaxDt = 200ms;
+constexpr auto kStep = 1us;
+constexpr size_t kTicks = 5'000'000;
+
+std::vector<Tick> MakeTicks() {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<std::chrono::nanoseconds::rep> dt(
+      kMinDt.count(), kMaxDt.count());
+  std::normal_distribution<double> move(0.0, 0.1);
+
+  std::vector<Tick> ticks(kTicks);
+  Tick tick{0ns, 100.0, 1.0};
+  for (auto& t : ticks) {
+    tick.timestamp += std::chrono::nanoseconds(dt(gen));
+    tick.price += move(gen);
+    t = tick;
+  }
+  return ticks;
+}
+
+double Run(const std::vector<Tick>& ticks, std::optional<AlphaTable> table,
+           std::vector<Price>& out) {
+  TimeEMA ema(kPeriod, std::move(table));
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < ticks.size(); ++i) {
+    out[i] = ema.update(ticks[i]);
+  }
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                 .count()) /
+         static_cast<double>(ticks.size());
+}
+
+double MaxDeviation(const std::vector<Price>& a, const std::vector<Price>& b) {
+  double deviation = 0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    deviation = std::max(deviation, std::abs(a[i] - b[i]));
+  }
+  return deviation;
+}
+
+}  // namespace
+
+int main() {
+  const auto ticks = MakeTicks();
+  std::vector<Price> exact(kTicks);
+  std::vector<Price> nearest(kTicks);
+  std::vector<Price> linear(kTicks);
+
+  double exp_ns = Run(ticks, std::nullopt, exact);
+  double nearest_ns =
+      Run(ticks,
+          AlphaTable(kPeriod, kMinDt, kMaxDt, kStep, AlphaTableMode::Nearest),
+          nearest);
+  double linear_ns =
+      Run(ticks,
+          AlphaTable(kPeriod, kMinDt, kMaxDt, kStep, AlphaTableMode::Linear),
+          linear);
+
+  std::println("std::exp:       {:.2f} ns/update", exp_ns);
+  std::println("nearest table:  {:.2f} ns/update, max EMA deviation {:.3e}",
+               nearest_ns, MaxDeviation(exact, nearest));
+  std::println("linear table:   {:.2f} ns/update, max EMA deviation {:.3e}",
+               linear_ns, MaxDeviation(exact, linear));
+  return 0;
+}
@@ -0,0 +1,80 @@
+// Writes the same ticks through TickLogger with every FileSink backend and
+// reports throughput and per-tick cost, including the final flush and
+// close of the file.
+
+#include <chrono>
+#include <filesystem>
+#include <print>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "logs/TickLogger.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr size_t kTicks = 2'000'000;
+
+std::vector<Tick> MakeTicks() {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<std::chrono::nanoseconds::rep> dt(
+      (50ms).count(), (200ms).count());
+  std::normal_distribution<double> move(0.0, 0.1);
+  std::uniform_real_distribution<double> volume(10.0, 1000.0);
+
+  std::vector<Tick> ticks(kTicks);
+  Tick tick{0ns, 100.0, 1.0};
+  for (auto& t : ticks) {
+    tick.timestamp += std::chrono::nanoseconds(dt(gen));
+    tick.price += move(gen);
+    tick.volume = volume(gen);
+    t = tick;
+  }
+  return ticks;
+}
+
+void Run(std::string_view name, FileSinkBackend backend,
+         const std::vector<Tick>& ticks, const std::filesystem::path& path) {
+  Config config;
+  config.price_evolution_path = path;
+  config.tick_log_backend = backend;
+
+  auto start = std::chrono::steady_clock::now();
+  try {
+    TickLogger logger(config);
+    for (const auto& tick : ticks) {
+      if (auto err = logger.writeTick(tick)) {
+        std::println("{:<9} {}", name, err.value());
+        return;
+      }
+    }
+  } catch (const std::runtime_error& e) {
+    std::println("{:<9} unavailable: {}", name, e.what());
+    return;
+  }
+  auto elapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start);
+
+  const auto bytes = static_cast<double>(std::filesystem::file_size(path));
+  std::println("{:<9} {:8.1f} MB/s, {:6.1f} ns/tick", name,
+               bytes / elapsed.count() / 1e6,
+               elapsed.count() * 1e9 / static_cast<double>(ticks.size()));
+  std::filesystem::remove(path);
+}
+
+}  // namespace
+
+int main() {
+  const auto ticks = MakeTicks();
+  const auto path =
+      std::filesystem::temp_directory_path() / "file_sink_benchmark.csv";
+
+  Run("stream", FileSinkBackend::Stream, ticks, path);
+  Run("pwrite", FileSinkBackend::Pwrite, ticks, path);
+  Run("mmap", FileSinkBackend::Mmap, ticks, path);
+  Run("io_uring", FileSinkBackend::IoUring, ticks, path);
+  return 0;
+}
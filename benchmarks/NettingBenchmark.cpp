@@ -0,0 +1,82 @@
+// Runs a number of strategies that each want to trade on every tick,
+// buying or selling at random, through one OrderManager: once sending every
+// order to the exchange and once netting them with SubmitIntent() and
+// FlushIntents(). Reports the cost per tick and the orders that reach the
+// exchange (and the order log) per tick.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <print>
+#include <random>
+
+#include "config/Config.h"
+#include "trading/OrderManager.h"
+
+namespace {
+
+constexpr size_t kTicks = 200'000;
+
+Config BenchmarkConfig() {
+  Config config;
+  config.seed = 42;
+  config.rejection_probability = 1.0;
+  config.min_position = -1e12;
+  config.max_position = 1e12;
+  return config;
+}
+
+template <typename Trade>
+double NanosecondsPerTick(uint32_t strategies, Trade&& trade) {
+  std::mt19937 rng(7);
+  std::bernoulli_distribution buy;
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t tick = 0; tick < kTicks; ++tick) {
+    for (uint32_t strategy = 0; strategy < strategies; ++strategy) {
+      trade(strategy, Order{buy(rng) ? OrderSide::Buy : OrderSide::Sell,
+                            100.0, 1.0 + strategy});
+    }
+    trade(strategies, Order{});  // end of the tick
+  }
+  const std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / static_cast<double>(kTicks);
+}
+
+void Run(uint32_t strategies) {
+  OrderManager<NullOrderLogger> direct(BenchmarkConfig());
+  const double direct_ns =
+      NanosecondsPerTick(strategies, [&](uint32_t strategy, const Order& o) {
+        if (strategy < strategies) direct.SendOrder(o);
+      });
+
+  OrderManager<NullOrderLogger> netted(BenchmarkConfig());
+  const double netted_ns =
+      NanosecondsPerTick(strategies, [&](uint32_t strategy, const Order& o) {
+        if (strategy < strategies) {
+          netted.SubmitIntent(strategy, o);
+        } else {
+          netted.FlushIntents();
+        }
+      });
+
+  const auto orders_per_tick = [](const PerformanceSummary& summary) {
+    return static_cast<double>(summary.executed_orders +
+                               summary.rejected_orders) /
+           static_cast<double>(kTicks);
+  };
+  std::println(
+      "{:2} strategies: direct {:7.1f} ns/tick, {:5.2f} orders/tick; netted "
+      "{:7.1f} ns/tick, {:5.2f} orders/tick",
+      strategies, direct_ns, orders_per_tick(direct.getSummary()), netted_ns,
+      orders_per_tick(netted.getSummary()));
+}
+
+}  // namespace
+
+int main() {
+  for (uint32_t strategies : {2, 4, 8, 16}) {
+    Run(strategies);
+  }
+  return 0;
+}
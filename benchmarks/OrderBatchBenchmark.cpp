@@ -0,0 +1,72 @@
+// Sends baskets of orders through an OrderManager, once leg by leg with
+// SendOrder() and once with SendOrders(), and reports the cost per order.
+// Both managers start from the same seed, so they must book the same fills.
+
+#include <chrono>
+#include <cstddef>
+#include <print>
+#include <vector>
+
+#include "config/Config.h"
+#include "trading/OrderManager.h"
+
+namespace {
+
+constexpr size_t kOrders = 2'000'000;
+
+Config BenchmarkConfig() {
+  Config config;
+  config.seed = 42;
+  config.rejection_probability = 1.0;
+  return config;
+}
+
+template <typename Send>
+double NanosecondsPerOrder(Send&& send) {
+  const auto start = std::chrono::steady_clock::now();
+  send();
+  const std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / static_cast<double>(kOrders);
+}
+
+void Run(size_t basket_size) {
+  std::vector<Order> basket;
+  for (size_t i = 0; i < basket_size; ++i) {
+    basket.push_back({i % 2 == 0 ? OrderSide::Buy : OrderSide::Sell,
+                      100.0 + static_cast<double>(i), 10.0});
+  }
+
+  OrderManager<NullOrderLogger> one_by_one(BenchmarkConfig());
+  const double single = NanosecondsPerOrder([&] {
+    for (size_t sent = 0; sent < kOrders; sent += basket_size) {
+      for (const auto& order : basket) {
+        one_by_one.SendOrder(order);
+      }
+    }
+  });
+
+  OrderManager<NullOrderLogger> batched(BenchmarkConfig());
+  const double batch = NanosecondsPerOrder([&] {
+    for (size_t sent = 0; sent < kOrders; sent += basket_size) {
+      batched.SendOrders(basket);
+    }
+  });
+
+  const bool same = batched.getSummary().executed_orders ==
+                    one_by_one.getSummary().executed_orders;
+  std::println(
+      "basket {:3}: SendOrder {:6.1f} ns/order, SendOrders {:6.1f} ns/order "
+      "({:.2f}x){}",
+      basket_size, single, batch, single / batch,
+      same ? "" : "  MISMATCH");
+}
+
+}  // namespace
+
+int main() {
+  for (size_t basket_size : {1, 2, 4, 16, 64}) {
+    Run(basket_size);
+  }
+  return 0;
+}
@@ -0,0 +1,132 @@
+// Fires NewOrderSingle messages at an OrderGateway on a background thread
+// over loopback TCP, keeping a fixed number of orders in flight, and
+// reports messages per second and the ack latency distribution seen by the
+// client, from writing an order to reading its ExecutionReport.
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <print>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/LatencyHistogram.h"
+#include "venue/FixMessage.h"
+#include "venue/OrderGateway.h"
+
+namespace {
+
+constexpr size_t kOrders = 200'000;
+
+int Connect(uint16_t port) {
+  const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  const int one = 1;
+  ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  if (::connect(fd, reinterpret_cast<const sockaddr*>(&address),
+                sizeof(address)) != 0) {
+    ::close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+void Run(size_t in_flight) {
+  Config config;
+  config.gateway_port = 0;
+  config.rejection_probability = 1.0;
+  config.seed = 42;
+  auto gateway = OrderGateway::Open(config);
+  if (!gateway) {
+    std::println("unavailable: {}", gateway.error());
+    return;
+  }
+  std::jthread server([&gateway] { gateway.value()->Run(); });
+  const int fd = Connect(gateway.value()->port());
+  if (fd < 0) {
+    std::println("cannot connect to the gateway");
+    return;
+  }
+
+  using Clock = std::chrono::steady_clock;
+  std::vector<Clock::time_point> sent_at(kOrders);
+  LatencyHistogram acks;
+  std::string input;
+  std::array<char, 64 * 1024> chunk{};
+  std::array<char, 256> order{};
+  size_t sent = 0;
+  size_t acked = 0;
+
+  const auto start = Clock::now();
+  while (acked < kOrders) {
+    // Top up the window with one write
+    std::string batch;
+    while (sent < kOrders && sent - acked < in_flight) {
+      std::array<char, 20> id{};
+      const auto [end, ec] =
+          std::to_chars(id.data(), id.data() + id.size(), sent);
+      batch += FixWriter(order, "D")
+                   .add(FixTag::ClOrdId, std::string_view(id.data(), end))
+                   .add(FixTag::Side, sent % 2 == 0 ? "1" : "2")
+                   .add(FixTag::OrderQty, 10.0)
+                   .add(FixTag::Price, 100.0)
+                   .finish();
+      sent_at[sent++] = Clock::now();
+    }
+    if (!batch.empty() &&
+        ::send(fd, batch.data(), batch.size(), MSG_NOSIGNAL) !=
+            static_cast<ssize_t>(batch.size())) {
+      break;
+    }
+
+    const ssize_t n = ::recv(fd, chunk.data(), chunk.size(), 0);
+    if (n <= 0) break;
+    input.append(chunk.data(), static_cast<size_t>(n));
+    const auto now = Clock::now();
+    size_t consumed = 0;
+    FixMessage report;
+    while (true) {
+      const auto result = ParseFixMessage(
+          std::string_view(input).substr(consumed), report);
+      if (result.status != FixParseStatus::Complete) break;
+      size_t id = 0;
+      const auto text = report.get(FixTag::ClOrdId);
+      std::from_chars(text.data(), text.data() + text.size(), id);
+      if (id < kOrders) acks.record(now - sent_at[id]);
+      ++acked;
+      consumed += result.length;
+    }
+    input.erase(0, consumed);
+  }
+  const std::chrono::duration<double> elapsed = Clock::now() - start;
+  ::close(fd);
+  server.join();
+
+  const auto stats = acks.summarize();
+  std::println(
+      "in flight {:4}: {:8.0f} msgs/s, ack p50 {:7.1f} us, p99 {:7.1f} us, "
+      "max {:8.1f} us",
+      in_flight, static_cast<double>(acked) / elapsed.count(),
+      static_cast<double>(stats.p50.count()) / 1e3,
+      static_cast<double>(stats.p99.count()) / 1e3,
+      static_cast<double>(stats.max.count()) / 1e3);
+}
+
+}  // namespace
+
+int main() {
+  for (size_t in_flight : {1, 16, 256}) {
+    Run(in_flight);
+  }
+  return 0;
+}
@@ -0,0 +1,64 @@
+// Times ParallelTimeEMA on a synthetic tick series for 1, 2, 4, ... threads
+// up to the hardware thread count, against a plain TimeEMA loop.
+
+#include <chrono>
+#include <print>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "backtest/ParallelEma.h"
+#include "trading/TimeEMA.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr size_t kTicks = 20'000'000;
+
+std::vector<Tick> MakeTicks() {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dt(50, 200);
+  std::normal_distribution<double> move(0.0, 0.1);
+
+  std::vector<Tick> ticks(kTicks);
+  Tick tick{0ns, 100.0, 1.0};
+  for (auto& t : ticks) {
+    tick.timestamp += std::chrono::milliseconds(dt(gen));
+    tick.price += move(gen);
+    t = tick;
+  }
+  return ticks;
+}
+
+template <typename Fn>
+double Seconds(Fn&& fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+}  // namespace
+
+int main() {
+  const auto ticks = MakeTicks();
+
+  std::vector<Price> sequential(kTicks);
+  double base = Seconds([&] {
+    TimeEMA ema(5s);
+    for (size_t i = 0; i < kTicks; ++i) sequential[i] = ema.update(ticks[i]);
+  });
+  std::println("TimeEMA loop:        {:.3f} s", base);
+
+  const size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+  for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+    std::vector<Price> parallel;
+    double elapsed =
+        Seconds([&] { parallel = ParallelTimeEMA(ticks, 5s, threads); });
+    std::println("{:3} threads:         {:.3f} s  speedup {:.2f}x", threads,
+                 elapsed, base / elapsed);
+  }
+  return 0;
+}
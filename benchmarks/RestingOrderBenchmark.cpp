@@ -0,0 +1,65 @@
+// Requotes a resting order every tick through an OrderManager, once by
+// replacing it in place and once by cancelling it and placing a new one,
+// and compares the cost per requote with a plain SendOrder().
+
+#include <chrono>
+#include <cstddef>
+#include <print>
+
+#include "config/Config.h"
+#include "trading/OrderManager.h"
+
+namespace {
+
+constexpr size_t kRequotes = 2'000'000;
+
+Config BenchmarkConfig() {
+  Config config;
+  config.seed = 42;
+  config.rejection_probability = 0.0;
+  return config;
+}
+
+template <typename Requote>
+double NanosecondsPerRequote(Requote&& requote) {
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < kRequotes; ++i) {
+    requote(i);
+  }
+  const std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / static_cast<double>(kRequotes);
+}
+
+// Bids stay below the market, so the quote never fills
+Price Bid(size_t i) { return 90.0 + static_cast<double>(i % 5); }
+
+}  // namespace
+
+int main() {
+  OrderManager<NullOrderLogger> sender(BenchmarkConfig());
+  const double send = NanosecondsPerRequote([&](size_t i) {
+    sender.SendOrder({OrderSide::Buy, Bid(i), 1.0});
+  });
+
+  OrderManager<NullOrderLogger> replacer(BenchmarkConfig());
+  const OrderIdentifier quote =
+      replacer.PlaceOrder({OrderSide::Buy, 90.0, 1.0});
+  const double replace = NanosecondsPerRequote([&](size_t i) {
+    replacer.onTick({std::chrono::nanoseconds(i), 100.0, 1.0});
+    replacer.ReplaceOrder(quote, Bid(i), 1.0);
+  });
+
+  OrderManager<NullOrderLogger> canceller(BenchmarkConfig());
+  OrderIdentifier resting = canceller.PlaceOrder({OrderSide::Buy, 90.0, 1.0});
+  const double cancel_place = NanosecondsPerRequote([&](size_t i) {
+    canceller.onTick({std::chrono::nanoseconds(i), 100.0, 1.0});
+    canceller.CancelOrder(resting);
+    resting = canceller.PlaceOrder({OrderSide::Buy, Bid(i), 1.0});
+  });
+
+  std::println("SendOrder:             {:6.1f} ns", send);
+  std::println("tick + ReplaceOrder:   {:6.1f} ns", replace);
+  std::println("tick + cancel + place: {:6.1f} ns", cancel_place);
+  return 0;
+}
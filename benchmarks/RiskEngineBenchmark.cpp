@@ -0,0 +1,72 @@
+// Runs RiskEngine::check() over orders that pass, orders that break a
+// random limit and a mix of both, and reports the cost per check, which
+// should not depend on the outcome.
+
+#include <chrono>
+#include <cstddef>
+#include <print>
+#include <random>
+#include <vector>
+
+#include "config/Config.h"
+#include "trading/RiskEngine.h"
+
+namespace {
+
+constexpr size_t kChecks = 20'000'000;
+constexpr size_t kOrders = 4096;
+
+Config BenchmarkConfig() {
+  Config config;
+  config.min_position = -1000;
+  config.max_position = 1000;
+  config.max_order_notional = 50'000;
+  config.max_orders_per_second = 1e9;
+  config.order_burst = 1'000'000;
+  return config;
+}
+
+// Orders that pass with probability `pass`, the others too large for the
+// position limit or the notional one
+std::vector<Order> MakeOrders(double pass) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::vector<Order> orders;
+  for (size_t i = 0; i < kOrders; ++i) {
+    const OrderSide side = i % 2 == 0 ? OrderSide::Buy : OrderSide::Sell;
+    if (uniform(rng) < pass) {
+      orders.push_back({side, 100.0, 10.0});
+    } else if (uniform(rng) < 0.5) {
+      orders.push_back({side, 10.0, 2000.0});
+    } else {
+      orders.push_back({side, 1000.0, 100.0});
+    }
+  }
+  return orders;
+}
+
+void Run(const char* name, double pass) {
+  const auto orders = MakeOrders(pass);
+  RiskEngine risk(BenchmarkConfig());
+  size_t accepted = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < kChecks; ++i) {
+    const auto now = std::chrono::nanoseconds(i);
+    accepted += risk.check(orders[i % kOrders], now) == RiskReason::None;
+  }
+  const std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  std::println("{:12}: {:5.2f} ns/check ({:.0f}% passed)", name,
+               elapsed.count() / static_cast<double>(kChecks),
+               100.0 * static_cast<double>(accepted) /
+                   static_cast<double>(kChecks));
+}
+
+}  // namespace
+
+int main() {
+  Run("all pass", 1.0);
+  Run("all refused", 0.0);
+  Run("random mix", 0.5);
+  return 0;
+}
@@ -0,0 +1,75 @@
+// Sends orders from a growing number of strategy threads through one
+// SharedVenue, each thread keeping a few orders in flight per poll as an
+// OrderManager would, and reports orders per second across all threads,
+// orders decided per ExchangeApi poll and the round-trip distribution.
+
+#include <chrono>
+#include <print>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/LatencyHistogram.h"
+#include "venue/SharedVenue.h"
+
+namespace {
+
+constexpr size_t kOrdersPerThread = 100'000;
+constexpr size_t kOrdersPerPoll = 4;
+
+void Run(uint64_t threads) {
+  Config config;
+  config.venue_name = "tsim_bench_shared";
+  config.venue_sessions = threads;
+  config.venue_capacity = 4096;
+  config.rejection_probability = 1.0;
+  config.seed = 42;
+  auto venue = SharedVenue::Create(config);
+  if (!venue) {
+    std::println("unavailable: {}", venue.error());
+    return;
+  }
+
+  std::vector<LatencyStats> round_trips(threads);
+  const auto start = std::chrono::steady_clock::now();
+  {
+    std::jthread server(
+        [&venue](std::stop_token stop) { venue.value()->Run(stop); });
+    std::vector<std::jthread> strategies;
+    for (uint64_t t = 0; t < threads; ++t) {
+      strategies.emplace_back([&, t] {
+        SharedExchange exchange(config);
+        for (size_t i = 0; i < kOrdersPerThread; ++i) {
+          exchange.sendOrder({OrderSide::Buy, 100.0, 10.0}, nullptr);
+          if (i % kOrdersPerPoll == kOrdersPerPoll - 1) exchange.poll();
+        }
+        exchange.poll();
+        round_trips[t] = exchange.getRoundTripStats();
+      });
+    }
+  }
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  const auto stats = venue.value()->stats();
+  double p99 = 0;
+  for (const auto& stats_of_thread : round_trips) {
+    p99 = std::max(p99, static_cast<double>(stats_of_thread.p99.count()));
+  }
+  std::println(
+      "{:3} threads: {:9.0f} orders/s, {:5.1f} orders per venue poll, "
+      "worst thread p99 {:8.1f} us",
+      threads, static_cast<double>(stats.orders) / elapsed.count(),
+      static_cast<double>(stats.orders) /
+          static_cast<double>(std::max<uint64_t>(stats.batches, 1)),
+      p99 / 1e3);
+}
+
+}  // namespace
+
+int main() {
+  for (uint64_t threads : {1, 4, 16, 32}) {
+    Run(threads);
+  }
+  return 0;
+}
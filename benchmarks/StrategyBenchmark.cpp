@@ -0,0 +1,122 @@
+// Compares the templated simulator loop against the same loop written out
+// by hand, with the EMA crossover bot inlined. Both use the same seed, so
+// they must produce identical results; the timings should match as well.
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <print>
+#include <random>
+
+#include "config/Config.h"
+#include "simulation/Simulator.h"
+#include "trading/OrderManager.h"
+#include "trading/TimeEMA.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr int kRepetitions = 5;
+
+Config BenchmarkConfig() {
+  Config config;
+  config.metrics_only = true;
+  config.seed = 42;
+  config.steps_count = 2'000'000;
+  return config;
+}
+
+PerformanceSummary RunTemplated(const Config& config) {
+  MetricsOnlySimulator simulator(config);
+  simulator.Run();
+  return simulator.getSummary();
+}
+
+PerformanceSummary RunHandWritten(const Config& config) {
+  std::mt19937 gen(static_cast<std::mt19937::result_type>(config.seed));
+  std::normal_distribution<double> norm_dist(0.0, 1.0);
+  std::uniform_int_distribution<std::chrono::nanoseconds::rep> time_dist(
+      config.min_diff_time.count(), config.max_diff_time.count());
+  std::uniform_real_distribution<double> volume_dist(config.min_volume,
+                                                     config.max_volume);
+
+  TimeEMA fast_ema(config.fast_ema);
+  TimeEMA slow_ema(config.slow_ema);
+  OrderManager<NullOrderLogger> order_manager(config);
+  IndicatorHigher higher_ema = IndicatorHigher::None;
+
+  const double horizon = static_cast<double>(config.time_horizon.count());
+  const double drift =
+      config.average_trend_value - 0.5 * std::pow(config.price_variation, 2);
+
+  Tick tick(0ns, config.initial_price, 0);
+  for (uint64_t step = 0; step < config.steps_count; ++step) {
+    std::chrono::nanoseconds deltaT(time_dist(gen));
+    double t_fraction = static_cast<double>(deltaT.count()) / horizon;
+    double Z = norm_dist(gen);
+    tick.timestamp += deltaT;
+    tick.price *= std::exp(drift * t_fraction + config.price_variation *
+                                                    std::sqrt(t_fraction) * Z);
+    tick.volume = volume_dist(gen);
+
+    order_manager.onTick(tick);
+    slow_ema.update(tick);
+    fast_ema.update(tick);
+    if (fast_ema.getCurrentPrice() > slow_ema.getCurrentPrice()) {
+      if (higher_ema == IndicatorHigher::Slow) {
+        order_manager.onBuySignal(tick.price, tick.volume);
+      }
+      higher_ema = IndicatorHigher::Fast;
+    } else {
+      if (higher_ema == IndicatorHigher::Fast) {
+        order_manager.onSellSignal(tick.price, tick.volume);
+      }
+      higher_ema = IndicatorHigher::Slow;
+    }
+  }
+  return order_manager.getSummary();
+}
+
+template <typename Fn>
+double BestNsPerTick(const Config& config, Fn&& run,
+                     PerformanceSummary& summary) {
+  double best = 0;
+  for (int i = 0; i < kRepetitions; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    summary = run(config);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double ns_per_tick =
+        static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                .count()) /
+        static_cast<double>(config.steps_count);
+    if (i == 0 || ns_per_tick < best) best = ns_per_tick;
+  }
+  return best;
+}
+
+}  // namespace
+
+int main() {
+  const Config config = BenchmarkConfig();
+
+  PerformanceSummary templated{};
+  PerformanceSummary hand_written{};
+  double templated_ns = BestNsPerTick(config, RunTemplated, templated);
+  double hand_written_ns =
+      BestNsPerTick(config, RunHandWritten, hand_written);
+
+  std::println("Steps per run:        {}", config.steps_count);
+  std::println("Simulator<Strategy>:  {:.2f} ns/tick", templated_ns);
+  std::println("Hand-written loop:    {:.2f} ns/tick", hand_written_ns);
+  std::println("Overhead:             {:+.2f}%",
+               (templated_ns / hand_written_ns - 1.0) * 100.0);
+
+  if (templated.total_pnl != hand_written.total_pnl ||
+      templated.executed_orders != hand_written.executed_orders) {
+    std::println(stderr, "Error: the two loops diverged");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,92 @@
+// Publishes the same ticks over the loopback UDP feed with several batch
+// sizes while a subscriber thread reads them, and reports end-to-end
+// throughput, datagrams received and how many ticks had to be replayed over TCP
+// or were lost.
+
+#include <chrono>
+#include <print>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "feed/UdpFeedPublisher.h"
+#include "feed/UdpFeedSubscriber.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr size_t kTicks = 2'000'000;
+constexpr uint16_t kFeedPort = 31001;
+constexpr uint16_t kReplayPort = 31002;
+constexpr int kReceiveBuffer = 4 << 20;
+
+std::vector<Tick> MakeTicks() {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<std::chrono::nanoseconds::rep> dt(
+      (50ms).count(), (200ms).count());
+  std::normal_distribution<double> move(0.0, 0.1);
+  std::uniform_real_distribution<double> volume(10.0, 1000.0);
+
+  std::vector<Tick> ticks(kTicks);
+  Tick tick{0ns, 100.0, 1.0};
+  for (auto& t : ticks) {
+    tick.timestamp += std::chrono::nanoseconds(dt(gen));
+    tick.price += move(gen);
+    tick.volume = volume(gen);
+    t = tick;
+  }
+  return ticks;
+}
+
+void Run(uint64_t batch, const std::vector<Tick>& ticks) {
+  Config config;
+  config.udp_feed_port = kFeedPort;
+  config.udp_replay_port = kReplayPort;
+  config.udp_feed_batch = batch;
+  config.udp_replay_capacity = 1 << 20;
+
+  auto subscriber =
+      UdpFeedSubscriber::Open(kFeedPort, kReplayPort, kReceiveBuffer);
+  if (!subscriber) {
+    std::println("{}", subscriber.error());
+    return;
+  }
+  std::jthread reader([&subscriber] {
+    while (subscriber.value()->next()) {
+    }
+  });
+
+  auto start = std::chrono::steady_clock::now();
+  try {
+    UdpFeedPublisher publisher(config);
+    for (const auto& tick : ticks) {
+      publisher.writeTick(tick);
+    }
+  } catch (const std::runtime_error& e) {
+    std::println("unavailable: {}", e.what());
+    return;
+  }
+  reader.join();
+  // The publisher lingers for late replay requests before it closes
+  auto elapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start -
+      UdpFeedPublisher::kReplayLinger);
+
+  const auto& stats = subscriber.value()->stats();
+  std::println(
+      "batch {:2}: {:6.2f} Mticks/s, {:8} datagrams, {:7} replayed, {} lost",
+      batch, static_cast<double>(stats.ticks) / elapsed.count() / 1e6,
+      stats.datagrams, stats.recovered, stats.lost);
+}
+
+}  // namespace
+
+int main() {
+  const auto ticks = MakeTicks();
+  for (uint64_t batch : {1, 8, 32, 60}) {
+    Run(batch, ticks);
+  }
+  return 0;
+}
@@ -0,0 +1,88 @@
+#include "Backtester.h"
+
+#include "ParallelEma.h"
+#include "TickFile.h"
+#include "logs/NullLogger.h"
+#include "logs/OrderLogger.h"
+#include "trading/EmaTradingBot.h"
+#include "trading/OrderManager.h"
+
+Backtester::Backtester(const Config& config, size_t threads)
+    : config_(config), threads_(ThreadCount(threads)) {}
+
+std::expected<PerformanceSummary, std::string> Backtester::Run(
+    const std::filesystem::path& ticks_path) const {
+  auto ticks = ReadTickFile(ticks_path, threads_);
+  if (!ticks) {
+    return std::unexpected(ticks.error());
+  }
+
+  const auto signals = findSignals(ticks.value());
+  if (config_.metrics_only) {
+    return execute<NullOrderLogger>(ticks.value(), signals);
+  }
+  return execute<OrderLogger>(ticks.value(), signals);
+}
+
+std::vector<Backtester::Signal> Backtester::findSignals(
+    std::span<const Tick> ticks) const {
+  const EmaScan fast_scan(config_.fast_ema);
+  const EmaScan slow_scan(config_.slow_ema);
+  const auto ranges = SplitRange(ticks.size(), threads_);
+  const auto fast_carry = fast_scan.carryIn(ticks, ranges);
+  const auto slow_carry = slow_scan.carryIn(ticks, ranges);
+
+  std::vector<std::vector<Signal>> chunk_signals(ranges.size());
+  ForEachRange(ranges, [&](size_t r) {
+    Price fast = fast_carry[r];
+    Price slow = slow_carry[r];
+    // The bot's state only depends on how the EMAs compared at the
+    // previous tick, which the carry-in values already tell.
+    IndicatorHigher higher = IndicatorHigher::None;
+    if (ranges[r].first != 0) {
+      higher = fast > slow ? IndicatorHigher::Fast : IndicatorHigher::Slow;
+    }
+
+    for (size_t i = ranges[r].first; i < ranges[r].second; ++i) {
+      slow = slow_scan.step(slow, ticks, i);
+      fast = fast_scan.step(fast, ticks, i);
+
+      if (fast > slow) {
+        if (higher == IndicatorHigher::Slow) {
+          chunk_signals[r].push_back({i, OrderSide::Buy});
+        }
+        higher = IndicatorHigher::Fast;
+      } else {
+        if (higher == IndicatorHigher::Fast) {
+          chunk_signals[r].push_back({i, OrderSide::Sell});
+        }
+        higher = IndicatorHigher::Slow;
+      }
+    }
+  });
+
+  std::vector<Signal> signals;
+  for (const auto& chunk : chunk_signals) {
+    signals.insert(signals.end(), chunk.begin(), chunk.end());
+  }
+  return signals;
+}
+
+template <OrderSink Logger>
+PerformanceSummary Backtester::execute(
+    std::span<const Tick> ticks, const std::vector<Signal>& signals) const {
+  OrderManager<Logger> order_manager(config_);
+
+  auto signal = signals.begin();
+  for (size_t i = 0; i < ticks.size(); ++i) {
+    order_manager.onTick(ticks[i]);
+    for (; signal != signals.end() && signal->tick == i; ++signal) {
+      if (signal->side == OrderSide::Buy) {
+        order_manager.onBuySignal(ticks[i].price, ticks[i].volume);
+      } else {
+        order_manager.onSellSignal(ticks[i].price, ticks[i].volume);
+      }
+    }
+  }
+  return order_manager.getSummary();
+}
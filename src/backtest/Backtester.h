@@ -0,0 +1,44 @@
+#ifndef TRADINGSIMULATOR_BACKTESTER_H
+#define TRADINGSIMULATOR_BACKTESTER_H
+
+#include <expected>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "common/Types.h"
+#include "config/Config.h"
+#include "logs/LogSink.h"
+#include "trading/PerformanceStats.h"
+
+// Replays a recorded price log through the EmaTradingBot crossover rules.
+// Both EMAs are computed as parallel scans (see ParallelEma.h) and the
+// crossovers of every chunk are found on that chunk's thread; only order
+// execution, which depends on the position built so far, runs sequentially.
+class Backtester {
+ public:
+  // threads = 0 uses all hardware threads
+  explicit Backtester(const Config& config, size_t threads = 0);
+
+  std::expected<PerformanceSummary, std::string> Run(
+      const std::filesystem::path& ticks_path) const;
+
+  struct Signal {
+    size_t tick;
+    OrderSide side;
+  };
+
+  // Crossover signals in tick order, as EmaTradingBot would raise them.
+  std::vector<Signal> findSignals(std::span<const Tick> ticks) const;
+
+ private:
+  template <OrderSink Logger>
+  PerformanceSummary execute(std::span<const Tick> ticks,
+                             const std::vector<Signal>& signals) const;
+
+  Config config_;
+  size_t threads_;
+};
+
+#endif  // TRADINGSIMULATOR_BACKTESTER_H
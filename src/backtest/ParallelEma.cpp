@@ -0,0 +1,69 @@
+#include "ParallelEma.h"
+
+#include <cmath>
+
+EmaScan::EmaScan(std::chrono::nanoseconds period) {
+  const double tau_sec = std::chrono::duration<double>(period).count();
+  neg_inv_tau_ = -1.0 / tau_sec;
+}
+
+double EmaScan::alpha(std::span<const Tick> ticks, size_t i) const {
+  if (i == 0) return 1.0;
+
+  const std::chrono::nanoseconds deltaT =
+      ticks[i].timestamp - ticks[i - 1].timestamp;
+  if (deltaT <= std::chrono::nanoseconds(0)) return 0.0;
+
+  // Same expression as TimeEMA::update, so a range replayed from an exact
+  // carry-in reproduces it bit for bit.
+  const double dt_sec = std::chrono::duration<double>(deltaT).count();
+  return 1.0 - std::exp(dt_sec * neg_inv_tau_);
+}
+
+std::vector<Price> EmaScan::carryIn(
+    std::span<const Tick> ticks, const std::vector<IndexRange>& ranges) const {
+  // No later range depends on the last one, so it is not reduced
+  const std::vector<IndexRange> reduced_ranges(ranges.begin(),
+                                               ranges.end() - 1);
+  std::vector<AffineStep> reduced(reduced_ranges.size());
+  if (!reduced_ranges.empty()) {
+    ForEachRange(reduced_ranges, [&](size_t r) {
+      AffineStep total;
+      for (size_t i = ranges[r].first; i < ranges[r].second; ++i) {
+        const double a = alpha(ticks, i);
+        const double scale = 1.0 - a;
+        total = {scale * total.scale,
+                 scale * total.offset + a * ticks[i].price};
+      }
+      reduced[r] = total;
+    });
+  }
+
+  std::vector<Price> carry(ranges.size());
+  Price value = 0;
+  for (size_t r = 0; r < ranges.size(); ++r) {
+    carry[r] = value;
+    if (r < reduced.size()) {
+      value = reduced[r].scale * value + reduced[r].offset;
+    }
+  }
+  return carry;
+}
+
+std::vector<Price> ParallelTimeEMA(std::span<const Tick> ticks,
+                                   std::chrono::nanoseconds period,
+                                   size_t threads) {
+  const EmaScan scan(period);
+  const auto ranges = SplitRange(ticks.size(), ThreadCount(threads));
+  const auto carry = scan.carryIn(ticks, ranges);
+
+  std::vector<Price> result(ticks.size());
+  ForEachRange(ranges, [&](size_t r) {
+    Price value = carry[r];
+    for (size_t i = ranges[r].first; i < ranges[r].second; ++i) {
+      value = scan.step(value, ticks, i);
+      result[i] = value;
+    }
+  });
+  return result;
+}
@@ -0,0 +1,51 @@
+#ifndef TRADINGSIMULATOR_PARALLELEMA_H
+#define TRADINGSIMULATOR_PARALLELEMA_H
+
+#include <chrono>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "common/Parallel.h"
+#include "common/Types.h"
+
+// TimeEMA as a parallel prefix scan. Every update is an affine map of the
+// previous value, ema' = (1 - alpha) * ema + alpha * price, and affine maps
+// compose associatively. Each range of ticks is first reduced to a single
+// map on its own thread, the maps are chained to get the value entering
+// every range, and the ranges are then replayed in parallel from there.
+
+// x -> scale * x + offset
+struct AffineStep {
+  double scale = 1;
+  double offset = 0;
+};
+
+class EmaScan {
+ public:
+  explicit EmaScan(std::chrono::nanoseconds period);
+
+  // TimeEMA::update for ticks[i] given the value after ticks[i - 1]; the
+  // first tick seeds the average with its own price.
+  Price step(Price ema, std::span<const Tick> ticks, size_t i) const {
+    return ema + alpha(ticks, i) * (ticks[i].price - ema);
+  }
+
+  // Value entering each range: TimeEMA's value after the tick preceding
+  // range.first (0 for a range starting at the first tick).
+  std::vector<Price> carryIn(std::span<const Tick> ticks,
+                             const std::vector<IndexRange>& ranges) const;
+
+ private:
+  double alpha(std::span<const Tick> ticks, size_t i) const;
+
+  double neg_inv_tau_;
+};
+
+// TimeEMA::update output for every tick, computed on `threads` threads
+// (0 - all hardware threads).
+std::vector<Price> ParallelTimeEMA(std::span<const Tick> ticks,
+                                   std::chrono::nanoseconds period,
+                                   size_t threads = 0);
+
+#endif  // TRADINGSIMULATOR_PARALLELEMA_H
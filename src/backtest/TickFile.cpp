@@ -0,0 +1,125 @@
+#include "TickFile.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <string_view>
+
+#include "common/Parallel.h"
+#include "logs/CompressedTickLogger.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+template <typename T>
+bool ParseField(std::string_view& line, char separator, T& value) {
+  const auto end = line.find(separator);
+  const auto field = line.substr(0, end);
+  auto [ptr, ec] = std::from_chars(field.data(), field.data() + field.size(),
+                                   value);
+  if (ec != std::errc() || ptr != field.data() + field.size()) return false;
+  line.remove_prefix(end == std::string_view::npos ? line.size() : end + 1);
+  return true;
+}
+
+std::optional<Tick> ParseLine(std::string_view line) {
+  if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+  int64_t hours = 0;
+  int64_t minutes = 0;
+  double seconds = 0;
+  Tick tick{};
+  if (!ParseField(line, ':', hours) || !ParseField(line, ':', minutes) ||
+      !ParseField(line, ',', seconds) || !ParseField(line, ',', tick.price) ||
+      !ParseField(line, ',', tick.volume) || !line.empty()) {
+    return std::nullopt;
+  }
+
+  const auto millis = std::llround(seconds * 1000.0);
+  tick.timestamp = std::chrono::hours(hours) + std::chrono::minutes(minutes) +
+                   std::chrono::milliseconds(millis);
+  return tick;
+}
+
+}  // namespace
+
+std::expected<std::vector<Tick>, std::string> ReadTickFile(
+    const std::filesystem::path& path, size_t threads) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return std::unexpected(
+        std::format("TickFile: error on file open for path: {}",
+                    path.string()));
+  }
+  const std::string data((std::istreambuf_iterator<char>(file)),
+                         std::istreambuf_iterator<char>());
+
+  if (IsCompressedTickData(data)) {
+    return DecodeCompressedTicks(data, threads);
+  }
+
+  // Skip the header
+  const auto header_end = data.find('\n');
+  const std::string_view text =
+      header_end == std::string::npos
+          ? std::string_view()
+          : std::string_view(data).substr(header_end + 1);
+
+  // Byte ranges moved forward to the next line start
+  auto ranges = SplitRange(text.size(), ThreadCount(threads));
+  for (size_t r = 1; r < ranges.size(); ++r) {
+    const auto newline = text.find('\n', ranges[r].first - 1);
+    ranges[r].first = newline == std::string_view::npos ? text.size()
+                                                        : newline + 1;
+    ranges[r - 1].second = ranges[r].first;
+  }
+  ranges.back().second = text.size();
+
+  std::vector<std::vector<Tick>> parsed(ranges.size());
+  std::vector<std::string> errors(ranges.size());
+  ForEachRange(ranges, [&](size_t r) {
+    auto chunk =
+        text.substr(ranges[r].first, ranges[r].second - ranges[r].first);
+    while (!chunk.empty()) {
+      const auto end = chunk.find('\n');
+      const auto line = chunk.substr(0, end);
+      chunk.remove_prefix(end == std::string_view::npos ? chunk.size()
+                                                        : end + 1);
+      if (line.empty() || line == "\r") continue;
+
+      auto tick = ParseLine(line);
+      if (!tick) {
+        errors[r] = std::format("TickFile: malformed line in {}: {}",
+                                path.string(), line);
+        return;
+      }
+      parsed[r].push_back(*tick);
+    }
+  });
+
+  for (const auto& error : errors) {
+    if (!error.empty()) return std::unexpected(error);
+  }
+
+  std::vector<Tick> ticks;
+  size_t total = 0;
+  for (const auto& chunk : parsed) total += chunk.size();
+  ticks.reserve(total);
+  for (const auto& chunk : parsed) {
+    ticks.insert(ticks.end(), chunk.begin(), chunk.end());
+  }
+
+  std::chrono::nanoseconds day_offset = 0ns;
+  for (size_t i = 1; i < ticks.size(); ++i) {
+    ticks[i].timestamp += day_offset;
+    if (ticks[i].timestamp < ticks[i - 1].timestamp) {
+      day_offset += 24h;
+      ticks[i].timestamp += 24h;
+    }
+  }
+  return ticks;
+}
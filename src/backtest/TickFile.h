@@ -0,0 +1,20 @@
+#ifndef TRADINGSIMULATOR_TICKFILE_H
+#define TRADINGSIMULATOR_TICKFILE_H
+
+#include <expected>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "common/Types.h"
+
+// Reads a price log written by TickLogger ("Time,Price,Volume" with
+// HH:MM:SS.mmm times). The file is split at line boundaries into one chunk
+// per thread (0 - all hardware threads) and the chunks are parsed in
+// parallel. If the hour field wraps at 24h, whole days are added back so
+// timestamps keep increasing. CompressedTickLogger files are recognised by
+// their header and decoded instead.
+std::expected<std::vector<Tick>, std::string> ReadTickFile(
+    const std::filesystem::path& path, size_t threads = 0);
+
+#endif  // TRADINGSIMULATOR_TICKFILE_H
@@ -0,0 +1,108 @@
+#ifndef TRADINGSIMULATOR_CONFLATINGCHANNEL_H
+#define TRADINGSIMULATOR_CONFLATINGCHANNEL_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <thread>
+#include <type_traits>
+
+// Last-value-wins slot between one writer and one reader, guarded by a
+// seqlock: publish() never waits and overwrites a value the reader has not
+// taken yet, so a slow reader sees the latest value instead of a growing
+// backlog. The value is copied through relaxed atomic words and the reader
+// retries a copy that raced with a write, so it only sees whole values.
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+class ConflatingChannel {
+ public:
+  // Writer side
+  void publish(const T& value) {
+    std::array<uint64_t, kWords> words{};
+    std::memcpy(words.data(), &value, sizeof(T));
+
+    const uint64_t seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq | kWriting, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < kWords; ++i) {
+      words_[i].store(words[i], std::memory_order_relaxed);
+    }
+    seq_.store(seq + kStep, std::memory_order_release);
+    seq_.notify_one();
+  }
+
+  // Writer side: no more values follow, wait() returns nullopt once the
+  // last one is taken.
+  void close() {
+    seq_.fetch_or(kClosed, std::memory_order_release);
+    seq_.notify_one();
+  }
+
+  // Reader side: the newest value not taken yet, if any.
+  std::optional<T> take() {
+    std::array<uint64_t, kWords> words{};
+    while (true) {
+      const uint64_t seq = seq_.load(std::memory_order_acquire);
+      if (seq & kWriting) {
+        std::this_thread::yield();
+        continue;
+      }
+      if (seq / kStep == taken_version_) {
+        return std::nullopt;
+      }
+      for (size_t i = 0; i < kWords; ++i) {
+        words[i] = words_[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      const uint64_t after = seq_.load(std::memory_order_relaxed);
+      if ((after | kClosed) != (seq | kClosed)) {
+        continue;  // overwritten while copying
+      }
+
+      taken_version_ = seq / kStep;
+      ++taken_;
+      T value;
+      std::memcpy(&value, words.data(), sizeof(T));
+      return value;
+    }
+  }
+
+  // Blocks until a value newer than the last one taken is published;
+  // nullopt once the channel is closed and drained.
+  std::optional<T> wait() {
+    while (true) {
+      const uint64_t seq = seq_.load(std::memory_order_acquire);
+      if (auto value = take()) {
+        return value;
+      }
+      if (seq & kClosed) {
+        return std::nullopt;
+      }
+      seq_.wait(seq, std::memory_order_acquire);
+    }
+  }
+
+  [[nodiscard]] uint64_t published() const {
+    return seq_.load(std::memory_order_acquire) / kStep;
+  }
+  // Reader side
+  [[nodiscard]] uint64_t taken() const { return taken_; }
+  [[nodiscard]] uint64_t conflated() const { return published() - taken_; }
+
+ private:
+  static constexpr size_t kWords = (sizeof(T) + 7) / 8;
+  static constexpr uint64_t kWriting = 1;
+  static constexpr uint64_t kClosed = 2;
+  static constexpr uint64_t kStep = 4;  // version = seq / kStep
+
+  alignas(64) std::atomic<uint64_t> seq_{0};
+  std::array<std::atomic<uint64_t>, kWords> words_{};
+
+  // Owned by the reader, kept off the writer's cache line
+  alignas(64) uint64_t taken_version_ = 0;
+  uint64_t taken_ = 0;
+};
+
+#endif  // TRADINGSIMULATOR_CONFLATINGCHANNEL_H
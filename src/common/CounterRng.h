@@ -0,0 +1,50 @@
+#ifndef TRADINGSIMULATOR_COUNTERRNG_H
+#define TRADINGSIMULATOR_COUNTERRNG_H
+
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+
+// Counter-based random numbers: the value for any counter is computed
+// directly from (seed, counter) with the SplitMix64 finalizer, so streams
+// can be split across threads or resumed anywhere without replaying them.
+class CounterRng {
+ public:
+  explicit CounterRng(uint64_t seed) : key_(Mix(seed)) {}
+
+  [[nodiscard]] uint64_t bits(uint64_t counter) const {
+    return Mix(key_ + counter * 0x9E3779B97F4A7C15ULL);
+  }
+
+  // Uniform in [0, 1) with 53 random bits
+  [[nodiscard]] double uniform(uint64_t counter) const {
+    return static_cast<double>(bits(counter) >> 11) * 0x1.0p-53;
+  }
+
+  // Uniform integer in [low, high]
+  [[nodiscard]] int64_t uniformInt(uint64_t counter, int64_t low,
+                                   int64_t high) const {
+    const auto range = static_cast<unsigned __int128>(high - low) + 1;
+    return low + static_cast<int64_t>((bits(counter) * range) >> 64);
+  }
+
+  // Standard normal from two counters (Box-Muller)
+  [[nodiscard]] double normal(uint64_t counter1, uint64_t counter2) const {
+    const double u1 = 1.0 - uniform(counter1);  // (0, 1], log is finite
+    const double u2 = uniform(counter2);
+    return std::sqrt(-2.0 * std::log(u1)) *
+           std::cos(2.0 * std::numbers::pi * u2);
+  }
+
+ private:
+  static uint64_t Mix(uint64_t z) {
+    z += 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  uint64_t key_;
+};
+
+#endif  // TRADINGSIMULATOR_COUNTERRNG_H
@@ -0,0 +1,185 @@
+#ifndef TRADINGSIMULATOR_EVENTBUS_H
+#define TRADINGSIMULATOR_EVENTBUS_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "config/Config.h"
+
+// Disruptor-style ring of preallocated events between one producer and any
+// number of consumers. Each consumer has its own cursor and sees every
+// event in order; a consumer can also be made to follow others (a
+// dependency barrier), seeing an event only after they have finished it.
+// The producer writes events in place and waits only when the slowest
+// consumer is a whole ring behind.
+//
+// A consumer that has fallen behind takes everything published so far in
+// one batch and moves its cursor once per batch, so catching up costs one
+// cursor store rather than one per event. Cursors count events and sit on
+// cache lines of their own.
+//
+// Consumers are added before the producer starts; events are consumed on
+// any threads, one per consumer.
+template <typename T>
+class EventBus {
+ public:
+  EventBus(size_t capacity, BusWait wait)
+      : ring_(std::bit_ceil(std::max<size_t>(capacity, 2))),
+        mask_(ring_.size() - 1),
+        wait_(wait) {}
+
+  EventBus(const EventBus&) = delete;
+  EventBus& operator=(const EventBus&) = delete;
+
+  // Registers a consumer that sees an event once every consumer in `after`
+  // has finished it, or as soon as it is published if `after` is empty
+  size_t addConsumer(std::initializer_list<size_t> after = {}) {
+    auto consumer = std::make_unique<Consumer>();
+    consumer->after.assign(after.begin(), after.end());
+    consumers_.push_back(std::move(consumer));
+    return consumers_.size() - 1;
+  }
+
+  // Producer: the slot of the next event, reused from an event every
+  // consumer is done with
+  T& claim() {
+    if (published_ - cached_gate_ >= ring_.size()) {
+      cached_gate_ = waitForConsumers(published_ - ring_.size() + 1);
+    }
+    return ring_[published_ & mask_];
+  }
+
+  // Producer: makes the claimed event visible to consumers
+  void publish() {
+    cursor_.value.store(++published_, std::memory_order_release);
+    if (wait_ == BusWait::Block) cursor_.value.notify_all();
+  }
+
+  // Producer: waits until every consumer has finished every event, so the
+  // state they update can be read from the producer's thread
+  void drain() { cached_gate_ = waitForConsumers(published_); }
+
+  // Producer: no more events follow
+  void close() {
+    cursor_.value.store(published_ | kClosed, std::memory_order_release);
+    cursor_.value.notify_all();
+  }
+
+  // Consumer: waits for events and passes each available one to
+  // handler(event, end_of_batch) in order; false once the bus is closed
+  // and this consumer has seen every event
+  template <typename Handler>
+  bool consume(size_t id, Handler&& handler) {
+    Consumer& consumer = *consumers_[id];
+    const uint64_t next =
+        consumer.sequence.value.load(std::memory_order_relaxed);
+    uint64_t available = 0;
+    while (true) {
+      const uint64_t cursor = cursor_.value.load(std::memory_order_acquire);
+      available = cursor & ~kClosed;
+      const std::atomic<uint64_t>* limit = &cursor_.value;
+      uint64_t seen = cursor;
+      for (const size_t before : consumer.after) {
+        const auto& sequence = consumers_[before]->sequence.value;
+        const uint64_t done = sequence.load(std::memory_order_acquire);
+        if (done < available) {
+          available = done;
+          limit = &sequence;
+          seen = done;
+        }
+      }
+      if (available > next) break;
+      if ((cursor & kClosed) != 0 && next == (cursor & ~kClosed)) {
+        return false;
+      }
+      pause(*limit, seen);
+    }
+
+    for (uint64_t sequence = next; sequence < available; ++sequence) {
+      handler(static_cast<const T&>(ring_[sequence & mask_]),
+              sequence + 1 == available);
+    }
+    ++consumer.batches;
+    consumer.sequence.value.store(available, std::memory_order_release);
+    if (wait_ == BusWait::Block) consumer.sequence.value.notify_all();
+    return true;
+  }
+
+  // Consumer: handles events until the bus is closed and drained
+  template <typename Handler>
+  void run(size_t id, Handler&& handler) {
+    while (consume(id, handler)) {
+    }
+  }
+
+  [[nodiscard]] uint64_t published() const { return published_; }
+  // Wake-ups of a consumer with events to handle; read after it has
+  // finished
+  [[nodiscard]] uint64_t batches(size_t id) const {
+    return consumers_[id]->batches;
+  }
+  [[nodiscard]] size_t capacity() const { return ring_.size(); }
+
+ private:
+  static constexpr uint64_t kClosed = uint64_t{1} << 63;
+
+  struct alignas(64) Cursor {
+    std::atomic<uint64_t> value{0};  // events published or finished
+  };
+
+  struct Consumer {
+    Cursor sequence;
+    std::vector<size_t> after;
+    uint64_t batches = 0;
+  };
+
+  // Lowest consumer cursor once it is at least `needed`
+  uint64_t waitForConsumers(uint64_t needed) {
+    while (true) {
+      const Cursor* slowest = nullptr;
+      uint64_t gate = published_;
+      for (const auto& consumer : consumers_) {
+        const uint64_t done =
+            consumer->sequence.value.load(std::memory_order_acquire);
+        if (done < gate) {
+          gate = done;
+          slowest = &consumer->sequence;
+        }
+      }
+      if (gate >= needed) return gate;
+      pause(slowest->value, gate);
+    }
+  }
+
+  void pause(const std::atomic<uint64_t>& watched, uint64_t seen) const {
+    switch (wait_) {
+      case BusWait::Spin:
+        break;
+      case BusWait::Yield:
+        std::this_thread::yield();
+        break;
+      case BusWait::Block:
+        watched.wait(seen, std::memory_order_acquire);
+        break;
+    }
+  }
+
+  std::vector<T> ring_;
+  size_t mask_;
+  BusWait wait_;
+  std::vector<std::unique_ptr<Consumer>> consumers_;
+
+  Cursor cursor_;
+  // Producer only, off the cursor's line
+  alignas(64) uint64_t published_ = 0;
+  uint64_t cached_gate_ = 0;  // a lower bound of the slowest consumer
+};
+
+#endif  // TRADINGSIMULATOR_EVENTBUS_H
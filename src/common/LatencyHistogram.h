@@ -0,0 +1,83 @@
+#ifndef TRADINGSIMULATOR_LATENCYHISTOGRAM_H
+#define TRADINGSIMULATOR_LATENCYHISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+
+// Summary of a latency distribution, reported in the run summary.
+struct LatencyStats {
+  uint64_t count = 0;
+  std::chrono::nanoseconds mean{0};
+  std::chrono::nanoseconds p50{0};
+  std::chrono::nanoseconds p99{0};
+  std::chrono::nanoseconds max{0};
+};
+
+// Latency distribution in constant memory and O(1) per sample: a value is
+// binned by its highest set bit and the kSubBits bits below it, so a
+// percentile is reported at most 1/16 (6.25%) above the true value. Exact
+// below 16 ns.
+class LatencyHistogram {
+ public:
+  void record(std::chrono::nanoseconds latency) {
+    const auto ns =
+        static_cast<uint64_t>(std::max<int64_t>(latency.count(), 0));
+    ++buckets_[Bucket(ns)];
+    ++count_;
+    total_ += ns;
+    max_ = std::max(max_, ns);
+  }
+
+  [[nodiscard]] uint64_t count() const { return count_; }
+
+  // Upper bound of the bucket holding the q-th quantile (0 < q <= 1)
+  [[nodiscard]] std::chrono::nanoseconds percentile(double q) const {
+    if (count_ == 0) return std::chrono::nanoseconds(0);
+    const auto rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(q * static_cast<double>(count_) + 0.5));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+      seen += buckets_[i];
+      if (seen >= rank) {
+        return std::chrono::nanoseconds(std::min(UpperBound(i), max_));
+      }
+    }
+    return std::chrono::nanoseconds(max_);
+  }
+
+  [[nodiscard]] LatencyStats summarize() const {
+    return {.count = count_,
+            .mean = std::chrono::nanoseconds(count_ == 0 ? 0 : total_ / count_),
+            .p50 = percentile(0.5),
+            .p99 = percentile(0.99),
+            .max = std::chrono::nanoseconds(max_)};
+  }
+
+ private:
+  static constexpr unsigned kSubBits = 4;
+  static constexpr uint64_t kSubBuckets = uint64_t{1} << kSubBits;
+
+  static size_t Bucket(uint64_t ns) {
+    if (ns < kSubBuckets) return ns;
+    const unsigned shift = std::bit_width(ns) - 1 - kSubBits;
+    return ((shift + 1) << kSubBits) + ((ns >> shift) & (kSubBuckets - 1));
+  }
+
+  static uint64_t UpperBound(size_t bucket) {
+    if (bucket < kSubBuckets) return bucket;
+    const unsigned shift = (bucket >> kSubBits) - 1;
+    const uint64_t lower = (kSubBuckets + (bucket & (kSubBuckets - 1)))
+                           << shift;
+    return lower + ((uint64_t{1} << shift) - 1);
+  }
+
+  std::array<uint64_t, (64 - kSubBits + 1) << kSubBits> buckets_{};
+  uint64_t count_ = 0;
+  uint64_t total_ = 0;
+  uint64_t max_ = 0;
+};
+
+#endif  // TRADINGSIMULATOR_LATENCYHISTOGRAM_H
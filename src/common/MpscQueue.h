@@ -0,0 +1,83 @@
+#ifndef TRADINGSIMULATOR_MPSCQUEUE_H
+#define TRADINGSIMULATOR_MPSCQUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+// Bounded multi-producer single-consumer queue over a power-of-two ring
+// (Vyukov's scheme). Producers claim a position with one compare-exchange
+// on the tail; each slot carries a sequence number that tells a producer
+// when the slot is free and the consumer when the value in it is complete,
+// so neither side takes a lock and a stalled producer holds up only its
+// own slot. Values from one producer come out in the order it pushed them.
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+class MpscQueue {
+ public:
+  explicit MpscQueue(size_t capacity)
+      : capacity_(std::bit_ceil(std::max<size_t>(capacity, 2))),
+        mask_(capacity_ - 1),
+        slots_(std::make_unique<Slot[]>(capacity_)) {
+    for (size_t i = 0; i < capacity_; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpscQueue(const MpscQueue&) = delete;
+  MpscQueue& operator=(const MpscQueue&) = delete;
+
+  // Any thread: false if the ring is full
+  bool push(const T& value) {
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[tail & mask_];
+      const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+      if (sequence == tail) {
+        if (tail_.compare_exchange_weak(tail, tail + 1,
+                                        std::memory_order_relaxed)) {
+          slot.value = value;
+          slot.sequence.store(tail + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (sequence < tail) {
+        return false;  // still holds a value from one lap ago
+      } else {
+        tail = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Consumer: nullopt if the next value is not complete yet
+  std::optional<T> pop() {
+    Slot& slot = slots_[head_ & mask_];
+    if (slot.sequence.load(std::memory_order_acquire) != head_ + 1) {
+      return std::nullopt;
+    }
+    const T value = slot.value;
+    slot.sequence.store(head_ + capacity_, std::memory_order_release);
+    ++head_;
+    return value;
+  }
+
+  [[nodiscard]] size_t capacity() const { return capacity_; }
+
+ private:
+  struct Slot {
+    std::atomic<uint64_t> sequence;
+    T value;
+  };
+
+  size_t capacity_;
+  size_t mask_;
+  std::unique_ptr<Slot[]> slots_;
+  alignas(64) std::atomic<uint64_t> tail_{0};  // producers
+  alignas(64) uint64_t head_ = 0;              // consumer only
+};
+
+#endif  // TRADINGSIMULATOR_MPSCQUEUE_H
@@ -0,0 +1,18 @@
+#include "Parallel.h"
+
+#include <algorithm>
+
+size_t ThreadCount(size_t requested) {
+  if (requested != 0) return requested;
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+std::vector<IndexRange> SplitRange(size_t size, size_t parts) {
+  parts = std::clamp<size_t>(parts, 1, std::max<size_t>(size, 1));
+  std::vector<IndexRange> ranges;
+  ranges.reserve(parts);
+  for (size_t p = 0; p < parts; ++p) {
+    ranges.emplace_back(size * p / parts, size * (p + 1) / parts);
+  }
+  return ranges;
+}
@@ -0,0 +1,31 @@
+#ifndef TRADINGSIMULATOR_PARALLEL_H
+#define TRADINGSIMULATOR_PARALLEL_H
+
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using IndexRange = std::pair<size_t, size_t>;  // [first, second)
+
+// `requested` threads, or all hardware threads when it is 0.
+size_t ThreadCount(size_t requested);
+
+// Splits [0, size) into at most `parts` contiguous ranges of near-equal size.
+std::vector<IndexRange> SplitRange(size_t size, size_t parts);
+
+// Runs fn(range_index) for every range, one thread per range.
+template <typename Fn>
+void ForEachRange(const std::vector<IndexRange>& ranges, Fn&& fn) {
+  if (ranges.size() == 1) {
+    fn(size_t{0});
+    return;
+  }
+  std::vector<std::jthread> workers;
+  workers.reserve(ranges.size());
+  for (size_t r = 0; r < ranges.size(); ++r) {
+    workers.emplace_back([&fn, r] { fn(r); });
+  }
+}
+
+#endif  // TRADINGSIMULATOR_PARALLEL_H
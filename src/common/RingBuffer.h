@@ -0,0 +1,100 @@
+#ifndef TRADINGSIMULATOR_RINGBUFFER_H
+#define TRADINGSIMULATOR_RINGBUFFER_H
+
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Snapshot.h"
+
+// Double-ended queue over a power-of-two ring. Capacity is reserved up front
+// and only grows (by doubling) if more elements than expected are queued, so
+// a correctly sized buffer never allocates after construction.
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+class RingBuffer {
+ public:
+  explicit RingBuffer(size_t capacity)
+      : storage_(std::bit_ceil(capacity < 2 ? size_t{2} : capacity)),
+        mask_(storage_.size() - 1) {}
+
+  void push_back(const T& value) {
+    if (size_ == storage_.size()) grow();
+    storage_[(head_ + size_) & mask_] = value;
+    ++size_;
+  }
+
+  void pop_front() {
+    head_ = (head_ + 1) & mask_;
+    --size_;
+  }
+
+  void pop_back() { --size_; }
+
+  [[nodiscard]] const T& front() const { return storage_[head_]; }
+  [[nodiscard]] const T& back() const {
+    return storage_[(head_ + size_ - 1) & mask_];
+  }
+  [[nodiscard]] const T& operator[](size_t i) const {
+    return storage_[(head_ + i) & mask_];
+  }
+
+  [[nodiscard]] size_t size() const { return size_; }
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+  [[nodiscard]] size_t capacity() const { return storage_.size(); }
+
+  void clear() {
+    head_ = 0;
+    size_ = 0;
+  }
+
+  void save(SnapshotWriter& writer) const {
+    writer.write(static_cast<uint64_t>(size_));
+    for (size_t i = 0; i < size_; ++i) {
+      writer.write((*this)[i]);
+    }
+  }
+
+  void load(SnapshotReader& reader) {
+    clear();
+    uint64_t count = 0;
+    reader.read(count);
+    for (uint64_t i = 0; i < count && reader.ok(); ++i) {
+      T value{};
+      reader.read(value);
+      push_back(value);
+    }
+  }
+
+ private:
+  void grow() {
+    std::vector<T> storage(storage_.size() * 2);
+    for (size_t i = 0; i < size_; ++i) {
+      storage[i] = (*this)[i];
+    }
+    storage_ = std::move(storage);
+    mask_ = storage_.size() - 1;
+    head_ = 0;
+  }
+
+  std::vector<T> storage_;
+  size_t mask_;
+  size_t head_ = 0;
+  size_t size_ = 0;
+};
+
+// Number of ticks a time window can hold when ticks are at least
+// min_interval apart: the window is (now - window, now], empty for a
+// window <= 0.
+inline size_t WindowCapacity(std::chrono::nanoseconds window,
+                             std::chrono::nanoseconds min_interval) {
+  if (window <= std::chrono::nanoseconds(0)) return 1;
+  if (min_interval <= std::chrono::nanoseconds(0)) return 2;
+  return static_cast<size_t>(window / min_interval) + 1;
+}
+
+#endif  // TRADINGSIMULATOR_RINGBUFFER_H
@@ -0,0 +1,156 @@
+#include "Snapshot.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <utility>
+
+namespace {
+
+constexpr std::string_view kSnapshotMagic = "TSIMSNAP";
+constexpr uint32_t kSnapshotVersion = 8;
+constexpr uint64_t kHeaderSize =
+    kSnapshotMagic.size() + sizeof(kSnapshotVersion) + sizeof(uint64_t);
+
+// fsync()s a file or directory through a descriptor of its own
+std::optional<std::string> SyncPath(const std::filesystem::path& path,
+                                    int flags) {
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC | flags);
+  if (fd < 0) {
+    return std::format("Snapshot: error on file open for path: {}",
+                       path.string());
+  }
+  std::optional<std::string> err;
+  if (::fsync(fd) != 0) {
+    err = std::format("Snapshot: fsync failed for {}: {}", path.string(),
+                      std::strerror(errno));
+  }
+  ::close(fd);
+  return err;
+}
+
+}  // namespace
+
+void SnapshotWriter::writeString(std::string_view value) {
+  write(static_cast<uint64_t>(value.size()));
+  buffer_.append(value);
+}
+
+void SnapshotWriter::addBarrier(SnapshotBarrier barrier) {
+  barriers_.push_back(std::move(barrier));
+}
+
+std::vector<SnapshotBarrier> SnapshotWriter::takeBarriers() {
+  return std::exchange(barriers_, {});
+}
+
+const std::string& SnapshotWriter::data() const { return buffer_; }
+
+std::string SnapshotWriter::release() && { return std::move(buffer_); }
+
+SnapshotReader::SnapshotReader(std::string data) : data_(std::move(data)) {}
+
+bool SnapshotReader::readString(std::string& value) {
+  uint64_t size = 0;
+  if (!read(size) || data_.size() - offset_ < size) {
+    ok_ = false;
+    return false;
+  }
+  value.assign(data_, offset_, size);
+  offset_ += size;
+  return true;
+}
+
+bool SnapshotReader::ok() const { return ok_; }
+
+bool SnapshotReader::atEnd() const { return offset_ == data_.size(); }
+
+std::optional<std::string> WriteSnapshotFile(const std::filesystem::path& path,
+                                             const std::string& payload) {
+  std::error_code ec;
+  std::filesystem::create_directories(path.parent_path(), ec);
+  if (ec) {
+    return std::format("Snapshot: error on folder creation for path: {}",
+                       path.string());
+  }
+
+  // Write next to the target and rename, so an interrupted write never
+  // replaces the last good checkpoint. The file is synced before the
+  // rename and the directory after it, so a crash cannot leave the new
+  // name pointing at data that never reached the disk.
+  auto tmp_path = path;
+  tmp_path += ".tmp";
+  {
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return std::format("Snapshot: error on file open for path: {}",
+                         tmp_path.string());
+    }
+    const uint64_t size = payload.size();
+    file.write(kSnapshotMagic.data(), kSnapshotMagic.size());
+    file.write(reinterpret_cast<const char*>(&kSnapshotVersion),
+               sizeof(kSnapshotVersion));
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    if (!file.flush()) {
+      return std::format("Snapshot: file write error for path: {}",
+                         tmp_path.string());
+    }
+  }
+
+  if (auto err = SyncPath(tmp_path, 0)) return err;
+
+  std::filesystem::rename(tmp_path, path, ec);
+  if (ec) {
+    return std::format("Snapshot: cannot replace {}: {}", path.string(),
+                       ec.message());
+  }
+  auto dir = path.parent_path();
+  if (dir.empty()) dir = ".";
+  return SyncPath(dir, O_DIRECTORY);
+}
+
+std::expected<std::string, std::string> ReadSnapshotFile(
+    const std::filesystem::path& path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return std::unexpected(std::format(
+        "Snapshot: error on file open for path: {}", path.string()));
+  }
+
+  std::string magic(kSnapshotMagic.size(), '\0');
+  uint32_t version = 0;
+  uint64_t size = 0;
+  file.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+  file.read(reinterpret_cast<char*>(&version), sizeof(version));
+  file.read(reinterpret_cast<char*>(&size), sizeof(size));
+  if (!file || magic != kSnapshotMagic) {
+    return std::unexpected(
+        std::format("Snapshot: {} is not a snapshot file", path.string()));
+  }
+  if (version != kSnapshotVersion) {
+    return std::unexpected(
+        std::format("Snapshot: unsupported version {} in {}", version,
+                    path.string()));
+  }
+
+  // A corrupt size must not make us allocate more than the file holds
+  std::error_code ec;
+  const uint64_t file_size = std::filesystem::file_size(path, ec);
+  if (ec || file_size - kHeaderSize < size) {
+    return std::unexpected(
+        std::format("Snapshot: truncated snapshot file {}", path.string()));
+  }
+
+  std::string payload(size, '\0');
+  file.read(payload.data(), static_cast<std::streamsize>(size));
+  if (!file) {
+    return std::unexpected(
+        std::format("Snapshot: truncated snapshot file {}", path.string()));
+  }
+  return payload;
+}
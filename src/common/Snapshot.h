@@ -0,0 +1,137 @@
+#ifndef TRADINGSIMULATOR_SNAPSHOT_H
+#define TRADINGSIMULATOR_SNAPSHOT_H
+
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Waits until something a snapshot relies on outside its payload, such as a
+// log up to the saved length, is durable; the error if it cannot be.
+using SnapshotBarrier = std::function<std::optional<std::string>()>;
+
+// Compact binary encoding of simulation state. Values are written in host
+// byte order, so a snapshot is only meant to be restored on the same kind of
+// machine that produced it.
+class SnapshotWriter {
+ public:
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  void write(const T& value) {
+    const auto* bytes = reinterpret_cast<const char*>(&value);
+    buffer_.append(bytes, sizeof(T));
+  }
+
+  void writeString(std::string_view value);
+
+  // Random engines only expose their state through operator<<. Engines whose
+  // state is a sequence of integers (mt19937 and friends) are packed as
+  // binary words instead of text.
+  template <typename Engine>
+  void writeEngine(const Engine& engine) {
+    std::ostringstream os;
+    os << engine;
+    std::istringstream is(os.str());
+    std::vector<uint64_t> words;
+    uint64_t word = 0;
+    while (is >> word) {
+      words.push_back(word);
+    }
+    write(static_cast<uint64_t>(words.size()));
+    buffer_.append(reinterpret_cast<const char*>(words.data()),
+                   words.size() * sizeof(uint64_t));
+  }
+
+  // Distributions may cache values between calls (e.g. the second
+  // Box-Muller variate), so their textual state is kept verbatim.
+  template <typename Distribution>
+  void writeDistribution(const Distribution& distribution) {
+    std::ostringstream os;
+    os.precision(17);
+    os << distribution;
+    writeString(os.str());
+  }
+
+  // State saved without waiting for it to reach the disk adds a barrier;
+  // Checkpointer runs them on its thread before the snapshot file replaces
+  // the previous one.
+  void addBarrier(SnapshotBarrier barrier);
+  [[nodiscard]] std::vector<SnapshotBarrier> takeBarriers();
+
+  [[nodiscard]] const std::string& data() const;
+  [[nodiscard]] std::string release() &&;
+
+ private:
+  std::string buffer_;
+  std::vector<SnapshotBarrier> barriers_;
+};
+
+class SnapshotReader {
+ public:
+  explicit SnapshotReader(std::string data);
+
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  bool read(T& value) {
+    if (!ok_ || data_.size() - offset_ < sizeof(T)) {
+      ok_ = false;
+      return false;
+    }
+    std::memcpy(&value, data_.data() + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return true;
+  }
+
+  bool readString(std::string& value);
+
+  template <typename Engine>
+  bool readEngine(Engine& engine) {
+    uint64_t count = 0;
+    if (!read(count) || (data_.size() - offset_) / sizeof(uint64_t) < count) {
+      ok_ = false;
+      return false;
+    }
+    std::ostringstream os;
+    for (uint64_t i = 0; i < count; ++i) {
+      uint64_t word = 0;
+      read(word);
+      os << word << ' ';
+    }
+    std::istringstream is(os.str());
+    is >> engine;
+    ok_ = ok_ && !is.fail();
+    return ok_;
+  }
+
+  template <typename Distribution>
+  bool readDistribution(Distribution& distribution) {
+    std::string text;
+    if (!readString(text)) return false;
+    std::istringstream is(text);
+    is >> distribution;
+    ok_ = !is.fail();
+    return ok_;
+  }
+
+  [[nodiscard]] bool ok() const;
+  [[nodiscard]] bool atEnd() const;
+
+ private:
+  std::string data_;
+  size_t offset_ = 0;
+  bool ok_ = true;
+};
+
+std::optional<std::string> WriteSnapshotFile(const std::filesystem::path& path,
+                                             const std::string& payload);
+std::expected<std::string, std::string> ReadSnapshotFile(
+    const std::filesystem::path& path);
+
+#endif  // TRADINGSIMULATOR_SNAPSHOT_H
@@ -0,0 +1,66 @@
+#ifndef TRADINGSIMULATOR_SPSCQUEUE_H
+#define TRADINGSIMULATOR_SPSCQUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+// Bounded single-producer single-consumer queue over a power-of-two ring.
+// Each side writes only its own index, kept on a cache line of its own
+// next to a cached copy of the other side's index, so it touches the
+// shared line only when the cached copy says the ring is full or empty.
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+class SpscQueue {
+ public:
+  explicit SpscQueue(size_t capacity)
+      : slots_(std::bit_ceil(std::max<size_t>(capacity, 2))),
+        mask_(slots_.size() - 1) {}
+
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  // Producer: false if the ring is full
+  bool push(const T& value) {
+    const uint64_t write = producer_.index.load(std::memory_order_relaxed);
+    if (write - producer_.cached >= slots_.size()) {
+      producer_.cached = consumer_.index.load(std::memory_order_acquire);
+      if (write - producer_.cached >= slots_.size()) return false;
+    }
+    slots_[write & mask_] = value;
+    producer_.index.store(write + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer: nullopt if the ring is empty
+  std::optional<T> pop() {
+    const uint64_t read = consumer_.index.load(std::memory_order_relaxed);
+    if (read == consumer_.cached) {
+      consumer_.cached = producer_.index.load(std::memory_order_acquire);
+      if (read == consumer_.cached) return std::nullopt;
+    }
+    const T value = slots_[read & mask_];
+    consumer_.index.store(read + 1, std::memory_order_release);
+    return value;
+  }
+
+  [[nodiscard]] size_t capacity() const { return slots_.size(); }
+
+ private:
+  struct alignas(64) Side {
+    std::atomic<uint64_t> index{0};  // written by this side only
+    uint64_t cached = 0;             // last seen index of the other side
+  };
+
+  std::vector<T> slots_;
+  size_t mask_;
+  Side producer_;
+  Side consumer_;
+};
+
+#endif  // TRADINGSIMULATOR_SPSCQUEUE_H
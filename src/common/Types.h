@@ -11,7 +11,20 @@ using OrderIdentifier = uint64_t;
 
 enum class OrderSide { Buy, Sell };
 
-enum class Status { Pending, Executed, Rejected };
+// Pending, Executed and Rejected are all a sent order ever gets. Orders
+// placed to rest on the book (ExchangeApi::placeOrder) also go through
+// Acked, PartiallyFilled, Replaced, Cancelled and Expired. New values go at
+// the end: snapshots store the underlying integer.
+enum class Status {
+  Pending,
+  Executed,
+  Rejected,
+  Acked,
+  PartiallyFilled,
+  Replaced,
+  Cancelled,
+  Expired
+};
 
 inline bool isVolumeEqual(const Volume a, const Volume b) {
   return std::abs(a - b) < 1e-9;
@@ -4,11 +4,63 @@
 #include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <string>
+#include <vector>
 
 using namespace std::chrono_literals;
 
 #include "common/Types.h"
 
+// How TimeEMA obtains alpha(dt): std::exp on every update, or a table
+// sampled every alpha_table_step, read at the nearest sample or linearly
+// interpolated between the two neighbouring ones.
+enum class AlphaTableMode { Off, Nearest, Linear };
+
+// Price log written by the simulator: TickLogger CSV lines,
+// CompressedTickLogger blocks, BarLogger OHLCV bars instead of ticks, or
+// instead of a file a TickFeedPublisher shared-memory ring or
+// UdpFeedPublisher loopback datagrams.
+enum class TickLogFormat { Csv, Compressed, Bars, Feed, Udp };
+
+// How a log reaches its file (see logs/FileSink.h): std::ofstream flushed
+// on every write, double-buffered pwrite on a background thread, a growing
+// shared mapping, or an io_uring write queue. All but Stream are
+// Linux-only.
+enum class FileSinkBackend { Stream, Pwrite, Mmap, IoUring };
+
+// When the order log is made durable (see logs/LogSyncer.h): never, by a
+// background fdatasync covering a group of orders, or before every
+// writeOrder() returns. With durability the log is written on the syncer's
+// thread; only fsync makes the strategy thread wait, for every order.
+enum class LogDurability { None, Group, Fsync };
+
+// How ticks reach the strategy: every tick in the generating thread,
+// through a ConflatingChannel from a generator thread, so a strategy that
+// falls behind gets the latest tick and skips the rest, or through an
+// EventBus to the strategy, the tick log and the metrics, each on a thread
+// of its own.
+enum class TickDelivery { Every, Latest, Bus };
+
+// How a side of an EventBus (see common/EventBus.h) waits for the other:
+// spinning on the cursor, yielding the core between checks, or sleeping on
+// std::atomic::wait until it is notified. Only Block makes the other side
+// pay for a notify.
+enum class BusWait { Spin, Yield, Block };
+
+// Where orders are decided: ExchangeApi inside the process, an
+// ExchangeServer process reached over shared memory (RemoteExchange), or
+// one ExchangeApi of this process shared by strategies on several threads
+// (SharedVenue).
+enum class ExchangeVenue { Local, Remote, Shared };
+
+// Parameters a scenario switches to once it forks off the shared prefix.
+struct ScenarioBranch {
+  std::string name;
+  double average_trend_value;
+  double price_variation;
+  double rejection_probability;
+};
+
 struct Config {
   // Price
   Price initial_price = 100;
@@ -21,18 +73,82 @@ struct Config {
   // Trade
   std::chrono::nanoseconds fast_ema = 1s;
   std::chrono::nanoseconds slow_ema = 5s;
+  std::chrono::nanoseconds timer_interval = 0ns;  // Strategy::onTimer, 0 - off
+  AlphaTableMode alpha_table = AlphaTableMode::Off;
+  std::chrono::nanoseconds alpha_table_step = 1us;
   Volume min_volume = 10;
   Volume max_volume = 1000;
   Volume min_position = -1000;
   Volume max_position = 1000;
+  // Pre-trade risk (RiskEngine), each 0 - off. The position limits above
+  // also count orders still in flight or resting.
+  Price max_order_notional = 0;
+  double max_orders_per_second = 0;  // simulated time, token bucket
+  uint64_t order_burst = 10;         // tokens the bucket holds
+  Price max_loss = 0;  // no new orders once the marked PnL falls this low
 
   // Exchange
   double rejection_probability = 1.0;
+  ExchangeVenue venue = ExchangeVenue::Local;
+  // Shared-memory channel to the venue process: /dev/shm/<venue_name>, with
+  // venue_capacity (a power of two) messages per direction
+  std::string venue_name = "tsim_venue";
+  uint64_t venue_capacity = 4096;
+  // venue = shared: strategies trading on one SharedVenue, each on a thread
+  // of its own
+  uint64_t venue_sessions = 4;
+  // Loopback TCP port of the --gateway order entry, 0 - any free port
+  uint16_t gateway_port = 30003;
 
   // Simulation
   uint64_t steps_count = 100000;
   std::filesystem::path price_evolution_path = "output/price_evolution.csv";
   std::filesystem::path orders_log_path = "output/orders.csv";
+  TickLogFormat tick_log_format = TickLogFormat::Csv;
+  // Bars written with tick_log_format = bars, one file per resolution
+  std::vector<std::chrono::nanoseconds> bar_resolutions = {1s, 1min, 1h};
+  // Shared-memory ring of tick_log_format = feed: /dev/shm/<name>, holding
+  // the last tick_feed_capacity (a power of two) ticks
+  std::string tick_feed_name = "tsim_ticks";
+  uint64_t tick_feed_capacity = 65536;
+  // Loopback UDP feed of tick_log_format = udp: udp_feed_batch ticks per
+  // datagram, the last udp_replay_capacity (a power of two) kept for
+  // replays over TCP
+  uint16_t udp_feed_port = 30001;
+  uint16_t udp_replay_port = 30002;
+  uint64_t udp_feed_batch = 32;
+  uint64_t udp_replay_capacity = 65536;
+  FileSinkBackend tick_log_backend = FileSinkBackend::Stream;
+  FileSinkBackend order_log_backend = FileSinkBackend::Stream;
+  LogDurability order_log_durability = LogDurability::None;
+  // Group commit: sync after this many orders or this much wall time since
+  // the previous commit, whichever comes first
+  uint64_t group_commit_orders = 64;
+  std::chrono::nanoseconds group_commit_interval = 100ms;
+  bool metrics_only = false;  // no price/order logs, summary only
+  uint64_t seed = 0;          // 0 - seed from std::random_device
+  std::filesystem::path checkpoint_path = "output/checkpoint.bin";
+  uint64_t checkpoint_interval = 0;  // steps between checkpoints, 0 - off
+  // Threads generating the price path, 0 - serial mt19937 stream. Any
+  // non-zero value gives the same (counter-based) path for a given seed.
+  uint64_t path_threads = 0;
+  TickDelivery tick_delivery = TickDelivery::Every;
+  // With Latest: a delivered tick carries the volume of the ticks it
+  // replaced as well as its own
+  bool conflate_volume = false;
+  // With Bus: events in the ring (a power of two) and how the generator and
+  // the consumers wait for each other
+  uint64_t bus_capacity = 4096;
+  BusWait bus_wait = BusWait::Block;
+  // Simulated time skipped before the first tick, in one exact GBM draw
+  std::chrono::nanoseconds warmup = 0ns;
+
+  // Scenarios ([Branch.<name>] sections), forked after branch_step ticks
+  uint64_t branch_step = 0;
+  std::vector<ScenarioBranch> branches;
+
+  // Runtime (set from the command line, not stored in the INI file)
+  bool resume = false;
 };
 
 #endif  // TRADINGSIMULATOR_CONFIG_H
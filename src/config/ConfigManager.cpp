@@ -1,9 +1,12 @@
 #include "ConfigManager.h"
 
+#include <algorithm>
+#include <bit>
 #include <charconv>
 #include <format>
 #include <regex>
 
+#include "feed/UdpFeed.h"
 #include "ini.h"
 
 namespace {
@@ -77,6 +80,32 @@ std::string DurationToString(std::chrono::nanoseconds ns) {
   return std::format("{}ns", ns.count());
 }
 
+// Comma-separated durations, e.g. "1s, 1min, 1h"
+std::expected<std::vector<std::chrono::nanoseconds>, std::string>
+ParseDurationList(const std::string& str) {
+  std::vector<std::chrono::nanoseconds> durations;
+  std::string_view rest = str;
+  while (true) {
+    const size_t comma = rest.find(',');
+    auto duration = ParseDuration(rest.substr(0, comma));
+    if (!duration) return std::unexpected(duration.error());
+    durations.push_back(*duration);
+    if (comma == std::string_view::npos) break;
+    rest.remove_prefix(comma + 1);
+  }
+  return durations;
+}
+
+std::string DurationListToString(
+    const std::vector<std::chrono::nanoseconds>& durations) {
+  std::string result;
+  for (const auto duration : durations) {
+    if (!result.empty()) result += ", ";
+    result += DurationToString(duration);
+  }
+  return result;
+}
+
 template <typename T>
 std::expected<T, std::string> ParseNumber(const std::string& str) {
   T value;
@@ -87,6 +116,174 @@ std::expected<T, std::string> ParseNumber(const std::string& str) {
   return std::unexpected(std::format("Failed to parse number: {}", str));
 }
 
+std::expected<bool, std::string> ParseBool(const std::string& str) {
+  if (str == "true" || str == "1") return true;
+  if (str == "false" || str == "0") return false;
+  return std::unexpected(std::format("Failed to parse boolean: {}", str));
+}
+
+// Upper limit on AlphaTable entries (8 bytes each, twice for Linear)
+constexpr int64_t kMaxAlphaTableEntries = int64_t{1} << 22;
+
+std::expected<AlphaTableMode, std::string> ParseAlphaTableMode(
+    const std::string& str) {
+  if (str == "off") return AlphaTableMode::Off;
+  if (str == "nearest") return AlphaTableMode::Nearest;
+  if (str == "linear") return AlphaTableMode::Linear;
+  return std::unexpected(std::format(
+      "Unknown alpha table mode: {} (expected off, nearest or linear)", str));
+}
+
+std::string AlphaTableModeToString(AlphaTableMode mode) {
+  switch (mode) {
+    case AlphaTableMode::Off:
+      return "off";
+    case AlphaTableMode::Nearest:
+      return "nearest";
+    case AlphaTableMode::Linear:
+      return "linear";
+  }
+  return "off";
+}
+
+std::expected<TickLogFormat, std::string> ParseTickLogFormat(
+    const std::string& str) {
+  if (str == "csv") return TickLogFormat::Csv;
+  if (str == "compressed") return TickLogFormat::Compressed;
+  if (str == "bars") return TickLogFormat::Bars;
+  if (str == "feed") return TickLogFormat::Feed;
+  if (str == "udp") return TickLogFormat::Udp;
+  return std::unexpected(std::format(
+      "Unknown tick log format: {} (expected csv, compressed, bars, feed or "
+      "udp)",
+      str));
+}
+
+std::string TickLogFormatToString(TickLogFormat format) {
+  switch (format) {
+    case TickLogFormat::Csv:
+      return "csv";
+    case TickLogFormat::Compressed:
+      return "compressed";
+    case TickLogFormat::Bars:
+      return "bars";
+    case TickLogFormat::Feed:
+      return "feed";
+    case TickLogFormat::Udp:
+      return "udp";
+  }
+  return "csv";
+}
+
+std::expected<FileSinkBackend, std::string> ParseFileSinkBackend(
+    const std::string& str) {
+  if (str == "stream") return FileSinkBackend::Stream;
+  if (str == "pwrite") return FileSinkBackend::Pwrite;
+  if (str == "mmap") return FileSinkBackend::Mmap;
+  if (str == "io_uring") return FileSinkBackend::IoUring;
+  return std::unexpected(std::format(
+      "Unknown file sink backend: {} (expected stream, pwrite, mmap or "
+      "io_uring)",
+      str));
+}
+
+std::string FileSinkBackendToString(FileSinkBackend backend) {
+  switch (backend) {
+    case FileSinkBackend::Stream:
+      return "stream";
+    case FileSinkBackend::Pwrite:
+      return "pwrite";
+    case FileSinkBackend::Mmap:
+      return "mmap";
+    case FileSinkBackend::IoUring:
+      return "io_uring";
+  }
+  return "stream";
+}
+
+std::expected<TickDelivery, std::string> ParseTickDelivery(
+    const std::string& str) {
+  if (str == "every") return TickDelivery::Every;
+  if (str == "latest") return TickDelivery::Latest;
+  if (str == "bus") return TickDelivery::Bus;
+  return std::unexpected(std::format(
+      "Unknown tick delivery: {} (expected every, latest or bus)", str));
+}
+
+std::string TickDeliveryToString(TickDelivery delivery) {
+  switch (delivery) {
+    case TickDelivery::Every:
+      return "every";
+    case TickDelivery::Latest:
+      return "latest";
+    case TickDelivery::Bus:
+      return "bus";
+  }
+  return "every";
+}
+
+std::expected<BusWait, std::string> ParseBusWait(const std::string& str) {
+  if (str == "spin") return BusWait::Spin;
+  if (str == "yield") return BusWait::Yield;
+  if (str == "block") return BusWait::Block;
+  return std::unexpected(std::format(
+      "Unknown bus wait strategy: {} (expected spin, yield or block)", str));
+}
+
+std::string BusWaitToString(BusWait wait) {
+  switch (wait) {
+    case BusWait::Spin:
+      return "spin";
+    case BusWait::Yield:
+      return "yield";
+    case BusWait::Block:
+      return "block";
+  }
+  return "block";
+}
+
+std::expected<ExchangeVenue, std::string> ParseExchangeVenue(
+    const std::string& str) {
+  if (str == "local") return ExchangeVenue::Local;
+  if (str == "remote") return ExchangeVenue::Remote;
+  if (str == "shared") return ExchangeVenue::Shared;
+  return std::unexpected(std::format(
+      "Unknown exchange venue: {} (expected local, remote or shared)", str));
+}
+
+std::string ExchangeVenueToString(ExchangeVenue venue) {
+  switch (venue) {
+    case ExchangeVenue::Local:
+      return "local";
+    case ExchangeVenue::Remote:
+      return "remote";
+    case ExchangeVenue::Shared:
+      return "shared";
+  }
+  return "local";
+}
+
+std::expected<LogDurability, std::string> ParseLogDurability(
+    const std::string& str) {
+  if (str == "none") return LogDurability::None;
+  if (str == "group") return LogDurability::Group;
+  if (str == "fsync") return LogDurability::Fsync;
+  return std::unexpected(std::format(
+      "Unknown log durability: {} (expected none, group or fsync)", str));
+}
+
+std::string LogDurabilityToString(LogDurability durability) {
+  switch (durability) {
+    case LogDurability::None:
+      return "none";
+    case LogDurability::Group:
+      return "group";
+    case LogDurability::Fsync:
+      return "fsync";
+  }
+  return "none";
+}
+
 }  // namespace
 
 std::expected<Config, std::string> ConfigManager::Load(
@@ -144,6 +341,15 @@ std::expected<Config, std::string> ConfigManager::Load(
   if (auto err =
           parse_value("Trade", "slow_ema", config.slow_ema, ParseDuration))
     return std::unexpected(*err);
+  if (auto err = parse_value("Trade", "timer_interval", config.timer_interval,
+                             ParseDuration))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Trade", "alpha_table", config.alpha_table,
+                             ParseAlphaTableMode))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Trade", "alpha_table_step",
+                             config.alpha_table_step, ParseDuration))
+    return std::unexpected(*err);
   if (auto err = parse_value("Trade", "min_volume", config.min_volume,
                              ParseNumber<Volume>))
     return std::unexpected(*err);
@@ -156,11 +362,39 @@ std::expected<Config, std::string> ConfigManager::Load(
   if (auto err = parse_value("Trade", "max_position", config.max_position,
                              ParseNumber<Volume>))
     return std::unexpected(*err);
+  if (auto err = parse_value("Trade", "max_order_notional",
+                             config.max_order_notional, ParseNumber<Price>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Trade", "max_orders_per_second",
+                             config.max_orders_per_second,
+                             ParseNumber<double>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Trade", "order_burst", config.order_burst,
+                             ParseNumber<uint64_t>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Trade", "max_loss", config.max_loss,
+                             ParseNumber<Price>))
+    return std::unexpected(*err);
 
   // Exchange
   if (auto err = parse_value("Exchange", "rejection_probability",
                              config.rejection_probability, ParseNumber<double>))
     return std::unexpected(*err);
+  if (auto err = parse_value("Exchange", "venue", config.venue,
+                             ParseExchangeVenue))
+    return std::unexpected(*err);
+  if (ini.has("Exchange") && ini["Exchange"].has("venue_name")) {
+    config.venue_name = ini["Exchange"]["venue_name"];
+  }
+  if (auto err = parse_value("Exchange", "venue_capacity",
+                             config.venue_capacity, ParseNumber<uint64_t>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Exchange", "venue_sessions",
+                             config.venue_sessions, ParseNumber<uint64_t>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Exchange", "gateway_port", config.gateway_port,
+                             ParseNumber<uint16_t>))
+    return std::unexpected(*err);
 
   // Simulation
   if (auto err = parse_value("Simulation", "steps_count", config.steps_count,
@@ -173,6 +407,103 @@ std::expected<Config, std::string> ConfigManager::Load(
   if (ini.has("Simulation") && ini["Simulation"].has("orders_log_path")) {
     config.orders_log_path = ini["Simulation"]["orders_log_path"];
   }
+  if (auto err = parse_value("Simulation", "tick_log_format",
+                             config.tick_log_format, ParseTickLogFormat))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "bar_resolutions",
+                             config.bar_resolutions, ParseDurationList))
+    return std::unexpected(*err);
+  if (ini.has("Simulation") && ini["Simulation"].has("tick_feed_name")) {
+    config.tick_feed_name = ini["Simulation"]["tick_feed_name"];
+  }
+  if (auto err = parse_value("Simulation", "tick_feed_capacity",
+                             config.tick_feed_capacity, ParseNumber<uint64_t>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "udp_feed_port",
+                             config.udp_feed_port, ParseNumber<uint16_t>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "udp_replay_port",
+                             config.udp_replay_port, ParseNumber<uint16_t>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "udp_feed_batch",
+                             config.udp_feed_batch, ParseNumber<uint64_t>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "udp_replay_capacity",
+                             config.udp_replay_capacity, ParseNumber<uint64_t>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "tick_log_backend",
+                             config.tick_log_backend, ParseFileSinkBackend))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "order_log_backend",
+                             config.order_log_backend, ParseFileSinkBackend))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "order_log_durability",
+                             config.order_log_durability, ParseLogDurability))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "group_commit_orders",
+                             config.group_commit_orders, ParseNumber<uint64_t>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "group_commit_interval",
+                             config.group_commit_interval, ParseDuration))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "metrics_only", config.metrics_only,
+                             ParseBool))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "seed", config.seed,
+                             ParseNumber<uint64_t>))
+    return std::unexpected(*err);
+  if (ini.has("Simulation") && ini["Simulation"].has("checkpoint_path")) {
+    config.checkpoint_path = ini["Simulation"]["checkpoint_path"];
+  }
+  if (auto err = parse_value("Simulation", "path_threads", config.path_threads,
+                             ParseNumber<uint64_t>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "tick_delivery",
+                             config.tick_delivery, ParseTickDelivery))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "conflate_volume",
+                             config.conflate_volume, ParseBool))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "bus_capacity", config.bus_capacity,
+                             ParseNumber<uint64_t>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "bus_wait", config.bus_wait,
+                             ParseBusWait))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "warmup", config.warmup,
+                             ParseDuration))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "checkpoint_interval",
+                             config.checkpoint_interval, ParseNumber<uint64_t>))
+    return std::unexpected(*err);
+  if (auto err = parse_value("Simulation", "branch_step", config.branch_step,
+                             ParseNumber<uint64_t>))
+    return std::unexpected(*err);
+
+  // Branches inherit every parameter they do not override
+  constexpr std::string_view kBranchPrefix = "branch.";
+  for (const auto& [section, values] : ini) {
+    if (!section.starts_with(kBranchPrefix)) continue;
+
+    ScenarioBranch branch{
+        .name = section.substr(kBranchPrefix.size()),
+        .average_trend_value = config.average_trend_value,
+        .price_variation = config.price_variation,
+        .rejection_probability = config.rejection_probability};
+
+    if (auto err = parse_value(section, "average_trend_value",
+                               branch.average_trend_value, ParseNumber<double>))
+      return std::unexpected(*err);
+    if (auto err = parse_value(section, "price_variation",
+                               branch.price_variation, ParseNumber<double>))
+      return std::unexpected(*err);
+    if (auto err =
+            parse_value(section, "rejection_probability",
+                        branch.rejection_probability, ParseNumber<double>))
+      return std::unexpected(*err);
+
+    config.branches.push_back(std::move(branch));
+  }
 
   // Validation
   if (config.initial_price < 0)
@@ -190,12 +521,30 @@ std::expected<Config, std::string> ConfigManager::Load(
   if (config.slow_ema <= config.fast_ema)
     return std::unexpected("slow_ema must be > fast_ema");
 
+  if (config.alpha_table != AlphaTableMode::Off) {
+    if (config.alpha_table_step < std::chrono::nanoseconds(1))
+      return std::unexpected("alpha_table_step must be >= 1ns");
+    if ((config.max_diff_time - config.min_diff_time) /
+            config.alpha_table_step >=
+        kMaxAlphaTableEntries)
+      return std::unexpected(std::format(
+          "alpha_table_step is too small: the table would exceed {} entries",
+          kMaxAlphaTableEntries));
+  }
+
   if (config.max_volume < config.min_volume)
     return std::unexpected("max_volume must be >= min_volume");
   if (config.min_volume < 0) return std::unexpected("min_volume must be >= 0");
 
   if (config.max_position < config.min_position)
     return std::unexpected("max_position must be >= min_position");
+  if (config.max_order_notional < 0)
+    return std::unexpected("max_order_notional must be >= 0");
+  if (config.max_orders_per_second < 0)
+    return std::unexpected("max_orders_per_second must be >= 0");
+  if (config.order_burst < 1)
+    return std::unexpected("order_burst must be >= 1");
+  if (config.max_loss < 0) return std::unexpected("max_loss must be >= 0");
 
   if (config.rejection_probability < 0.0 ||
       config.rejection_probability > 100.0) {
@@ -209,6 +558,114 @@ std::expected<Config, std::string> ConfigManager::Load(
   if (config.steps_count < 1)
     return std::unexpected("steps_count must be >= 1");
 
+  if (config.tick_log_format == TickLogFormat::Bars) {
+    if (config.bar_resolutions.empty())
+      return std::unexpected("bar_resolutions must not be empty");
+    // Bar times are written with millisecond precision
+    for (size_t i = 0; i < config.bar_resolutions.size(); ++i) {
+      if (config.bar_resolutions[i] < 1ms)
+        return std::unexpected("bar_resolutions must be >= 1ms");
+      if (std::ranges::find(config.bar_resolutions.begin(),
+                            config.bar_resolutions.begin() + i,
+                            config.bar_resolutions[i]) !=
+          config.bar_resolutions.begin() + i)
+        return std::unexpected(
+            "bar_resolutions must not contain duplicates");
+    }
+  }
+
+  if (config.tick_log_format == TickLogFormat::Feed) {
+    if (config.tick_feed_name.empty())
+      return std::unexpected("tick_feed_name must not be empty");
+    if (config.tick_feed_capacity < 2 ||
+        !std::has_single_bit(config.tick_feed_capacity))
+      return std::unexpected(
+          "tick_feed_capacity must be a power of two >= 2");
+  }
+
+  if (config.tick_log_format == TickLogFormat::Udp) {
+    if (config.udp_feed_port == 0 || config.udp_replay_port == 0)
+      return std::unexpected("udp_feed_port and udp_replay_port must be set");
+    if (config.udp_feed_batch < 1 || config.udp_feed_batch > kUdpFeedMaxBatch)
+      return std::unexpected(std::format("udp_feed_batch must be in [1, {}]",
+                                         kUdpFeedMaxBatch));
+    if (config.udp_replay_capacity < 2 ||
+        !std::has_single_bit(config.udp_replay_capacity))
+      return std::unexpected(
+          "udp_replay_capacity must be a power of two >= 2");
+    // Every branch would publish to the same ports
+    if (!config.branches.empty())
+      return std::unexpected(
+          "tick_log_format = udp does not support [Branch.*] scenarios");
+  }
+
+  if (config.venue_name.empty())
+    return std::unexpected("venue_name must not be empty");
+  if (config.venue_capacity < 2 || !std::has_single_bit(config.venue_capacity))
+    return std::unexpected("venue_capacity must be a power of two >= 2");
+  // One venue process serves one client, and remote runs always write the
+  // CSV price log (or none with metrics_only). The venue process draws the
+  // rejections from a generator of its own, which a snapshot cannot hold.
+  if (config.venue == ExchangeVenue::Remote) {
+    if (config.checkpoint_interval != 0)
+      return std::unexpected(
+          "venue = remote does not support checkpoint_interval");
+    if (!config.branches.empty())
+      return std::unexpected(
+          "venue = remote does not support [Branch.*] scenarios");
+    if (!config.metrics_only && config.tick_log_format != TickLogFormat::Csv)
+      return std::unexpected("venue = remote requires tick_log_format = csv");
+  }
+  // Shared runs start venue_sessions simulations at once, each writing CSV
+  // logs of its own. Which order meets which random decision depends on
+  // thread timing, so there is no reproducible state to checkpoint.
+  if (config.venue == ExchangeVenue::Shared) {
+    if (config.venue_sessions < 1)
+      return std::unexpected("venue_sessions must be >= 1");
+    if (config.checkpoint_interval != 0)
+      return std::unexpected(
+          "venue = shared does not support checkpoint_interval");
+    if (!config.branches.empty())
+      return std::unexpected(
+          "venue = shared does not support [Branch.*] scenarios");
+    if (!config.metrics_only && config.tick_log_format != TickLogFormat::Csv)
+      return std::unexpected("venue = shared requires tick_log_format = csv");
+  }
+
+  // Which ticks a conflating run delivers depends on thread timing, so it
+  // has no reproducible state to checkpoint or branch from
+  if (config.tick_delivery == TickDelivery::Latest) {
+    if (config.checkpoint_interval != 0)
+      return std::unexpected(
+          "tick_delivery = latest does not support checkpoint_interval");
+    if (!config.branches.empty())
+      return std::unexpected(
+          "tick_delivery = latest does not support [Branch.*] scenarios");
+  }
+  if (config.tick_delivery == TickDelivery::Bus &&
+      (config.bus_capacity < 2 || !std::has_single_bit(config.bus_capacity)))
+    return std::unexpected("bus_capacity must be a power of two >= 2");
+
+  if (config.order_log_durability == LogDurability::Group &&
+      config.group_commit_orders < 1)
+    return std::unexpected("group_commit_orders must be >= 1");
+
+  if (!config.branches.empty() && config.branch_step >= config.steps_count)
+    return std::unexpected("branch_step must be < steps_count");
+
+  for (const auto& branch : config.branches) {
+    if (branch.name.empty())
+      return std::unexpected("branch name must not be empty");
+    if (branch.price_variation <= 0)
+      return std::unexpected(
+          std::format("[Branch.{}] price_variation must be > 0", branch.name));
+    if (branch.rejection_probability < 0.0 ||
+        branch.rejection_probability > 100.0)
+      return std::unexpected(std::format(
+          "[Branch.{}] rejection_probability must be between 0.0 and 100.0",
+          branch.name));
+  }
+
   return config;
 }
 
@@ -228,18 +685,68 @@ std::expected<Config, std::string> ConfigManager::CreateDefaultConfig(
 
   ini["Trade"]["fast_ema"] = DurationToString(config.fast_ema);
   ini["Trade"]["slow_ema"] = DurationToString(config.slow_ema);
+  ini["Trade"]["timer_interval"] = DurationToString(config.timer_interval);
+  ini["Trade"]["alpha_table"] = AlphaTableModeToString(config.alpha_table);
+  ini["Trade"]["alpha_table_step"] = DurationToString(config.alpha_table_step);
   ini["Trade"]["min_volume"] = std::to_string(config.min_volume);
   ini["Trade"]["max_volume"] = std::to_string(config.max_volume);
   ini["Trade"]["min_position"] = std::to_string(config.min_position);
   ini["Trade"]["max_position"] = std::to_string(config.max_position);
+  ini["Trade"]["max_order_notional"] =
+      std::format("{}", config.max_order_notional);
+  ini["Trade"]["max_orders_per_second"] =
+      std::format("{}", config.max_orders_per_second);
+  ini["Trade"]["order_burst"] = std::to_string(config.order_burst);
+  ini["Trade"]["max_loss"] = std::format("{}", config.max_loss);
 
   ini["Exchange"]["rejection_probability"] =
       std::format("{}", config.rejection_probability);
+  ini["Exchange"]["venue"] = ExchangeVenueToString(config.venue);
+  ini["Exchange"]["venue_name"] = config.venue_name;
+  ini["Exchange"]["venue_capacity"] = std::to_string(config.venue_capacity);
+  ini["Exchange"]["venue_sessions"] = std::to_string(config.venue_sessions);
+  ini["Exchange"]["gateway_port"] = std::to_string(config.gateway_port);
 
   ini["Simulation"]["steps_count"] = std::to_string(config.steps_count);
   ini["Simulation"]["price_evolution_path"] =
       config.price_evolution_path.string();
   ini["Simulation"]["orders_log_path"] = config.orders_log_path.string();
+  ini["Simulation"]["tick_log_format"] =
+      TickLogFormatToString(config.tick_log_format);
+  ini["Simulation"]["bar_resolutions"] =
+      DurationListToString(config.bar_resolutions);
+  ini["Simulation"]["tick_feed_name"] = config.tick_feed_name;
+  ini["Simulation"]["tick_feed_capacity"] =
+      std::to_string(config.tick_feed_capacity);
+  ini["Simulation"]["udp_feed_port"] = std::to_string(config.udp_feed_port);
+  ini["Simulation"]["udp_replay_port"] = std::to_string(config.udp_replay_port);
+  ini["Simulation"]["udp_feed_batch"] = std::to_string(config.udp_feed_batch);
+  ini["Simulation"]["udp_replay_capacity"] =
+      std::to_string(config.udp_replay_capacity);
+  ini["Simulation"]["tick_log_backend"] =
+      FileSinkBackendToString(config.tick_log_backend);
+  ini["Simulation"]["order_log_backend"] =
+      FileSinkBackendToString(config.order_log_backend);
+  ini["Simulation"]["order_log_durability"] =
+      LogDurabilityToString(config.order_log_durability);
+  ini["Simulation"]["group_commit_orders"] =
+      std::to_string(config.group_commit_orders);
+  ini["Simulation"]["group_commit_interval"] =
+      DurationToString(config.group_commit_interval);
+  ini["Simulation"]["metrics_only"] = config.metrics_only ? "true" : "false";
+  ini["Simulation"]["seed"] = std::to_string(config.seed);
+  ini["Simulation"]["checkpoint_path"] = config.checkpoint_path.string();
+  ini["Simulation"]["path_threads"] = std::to_string(config.path_threads);
+  ini["Simulation"]["tick_delivery"] =
+      TickDeliveryToString(config.tick_delivery);
+  ini["Simulation"]["conflate_volume"] =
+      config.conflate_volume ? "true" : "false";
+  ini["Simulation"]["bus_capacity"] = std::to_string(config.bus_capacity);
+  ini["Simulation"]["bus_wait"] = BusWaitToString(config.bus_wait);
+  ini["Simulation"]["warmup"] = DurationToString(config.warmup);
+  ini["Simulation"]["checkpoint_interval"] =
+      std::to_string(config.checkpoint_interval);
+  ini["Simulation"]["branch_step"] = std::to_string(config.branch_step);
 
   if (!file.generate(ini, true)) {
     return std::unexpected("Failed to write default config file");
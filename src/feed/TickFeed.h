@@ -0,0 +1,51 @@
+#ifndef TRADINGSIMULATOR_TICKFEED_H
+#define TRADINGSIMULATOR_TICKFEED_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Layout of the shared-memory tick feed written by TickFeedPublisher and
+// read by TickFeedSubscriber: a header followed by `capacity` slots. Tick n
+// goes to slot n % capacity, whose sequence word is 2n + 1 while it is being
+// written and 2n + 2 once it is complete, so readers detect both unfinished
+// and overwritten slots without any lock. The publisher never waits for
+// subscribers; a subscriber that falls more than `capacity` ticks behind
+// loses the overwritten ones.
+//
+// Words shared between processes are accessed through std::atomic_ref.
+
+inline constexpr uint64_t kTickFeedMagic = 0x4445'4546'4d49'5354;  // TSIMFEED
+inline constexpr uint32_t kTickFeedVersion = 1;
+
+struct alignas(64) TickFeedHeader {
+  uint64_t magic;  // stored last, once the rest is initialized
+  uint32_t version;
+  uint32_t slot_size;
+  uint64_t capacity;        // power of two
+  uint64_t first_sequence;  // sequence of the first tick in this segment
+
+  alignas(64) uint64_t write_sequence;  // ticks published so far
+  alignas(64) uint32_t closed;          // no more ticks follow
+};
+
+// One tick per cache line, so neighbouring slots never share one
+struct alignas(64) TickFeedSlot {
+  uint64_t sequence;
+  int64_t timestamp;  // nanoseconds
+  uint64_t price;     // bit pattern of the double
+  uint64_t volume;
+};
+
+inline size_t TickFeedSize(uint64_t capacity) {
+  return sizeof(TickFeedHeader) + capacity * sizeof(TickFeedSlot);
+}
+
+// shm_open() name: a leading slash is added if missing
+inline std::string TickFeedShmName(std::string_view name) {
+  return name.starts_with('/') ? std::string(name)
+                               : "/" + std::string(name);
+}
+
+#endif  // TRADINGSIMULATOR_TICKFEED_H
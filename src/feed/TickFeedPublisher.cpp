@@ -0,0 +1,163 @@
+#include "TickFeedPublisher.h"
+
+#include <stdexcept>
+
+#ifdef __linux__
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <format>
+
+namespace {
+
+// Whether `name` holds a feed whose publisher has closed it
+bool IsClosedFeed(const std::string& name) {
+  const int fd = ::shm_open(name.c_str(), O_RDONLY | O_CLOEXEC, 0);
+  if (fd < 0) return false;
+  struct stat st {};
+  const bool sized = ::fstat(fd, &st) == 0 &&
+                     static_cast<size_t>(st.st_size) >= sizeof(TickFeedHeader);
+  void* map = sized ? ::mmap(nullptr, sizeof(TickFeedHeader), PROT_READ,
+                             MAP_SHARED, fd, 0)
+                    : MAP_FAILED;
+  ::close(fd);
+  if (map == MAP_FAILED) return false;
+
+  auto& header = *static_cast<TickFeedHeader*>(map);
+  const bool closed =
+      std::atomic_ref(header.magic).load(std::memory_order_acquire) ==
+          kTickFeedMagic &&
+      std::atomic_ref(header.closed).load(std::memory_order_acquire) != 0;
+  ::munmap(map, sizeof(TickFeedHeader));
+  return closed;
+}
+
+}  // namespace
+
+TickFeedPublisher::TickFeedPublisher(const Config& config)
+    : name_(TickFeedShmName(config.tick_feed_name)),
+      capacity_(config.tick_feed_capacity) {
+  if (auto error = create(0)) {
+    throw std::runtime_error(error.value());
+  }
+}
+
+TickFeedPublisher::~TickFeedPublisher() { close(); }
+
+std::optional<std::string> TickFeedPublisher::create(uint64_t first_sequence) {
+  // A feed closed by its publisher (an earlier run, or this one before
+  // load()) is replaced; its subscribers keep their mapping. An open one
+  // belongs to a running publisher, which would lose its subscribers, or to
+  // one that crashed; only the user can tell which
+  if (IsClosedFeed(name_)) {
+    ::shm_unlink(name_.c_str());
+  }
+  const int fd =
+      ::shm_open(name_.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+  if (fd < 0 && errno == EEXIST) {
+    return std::format(
+        "TickFeedPublisher: {} already exists: another publisher is running, "
+        "or remove /dev/shm{} left by one that crashed",
+        name_, name_);
+  }
+  if (fd < 0) {
+    return std::format("TickFeedPublisher: cannot create {}: {}", name_,
+                       std::strerror(errno));
+  }
+
+  size_ = TickFeedSize(capacity_);
+  if (::ftruncate(fd, static_cast<off_t>(size_)) != 0) {
+    const int error = errno;
+    ::close(fd);
+    return std::format("TickFeedPublisher: cannot size {}: {}", name_,
+                       std::strerror(error));
+  }
+  map_ = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (map_ == MAP_FAILED) {
+    map_ = nullptr;
+    return std::format("TickFeedPublisher: cannot map {}: {}", name_,
+                       std::strerror(errno));
+  }
+
+  // The segment starts zeroed: every slot reads as not yet published
+  header_ = static_cast<TickFeedHeader*>(map_);
+  slots_ = reinterpret_cast<TickFeedSlot*>(static_cast<char*>(map_) +
+                                           sizeof(TickFeedHeader));
+  header_->version = kTickFeedVersion;
+  header_->slot_size = sizeof(TickFeedSlot);
+  header_->capacity = capacity_;
+  header_->first_sequence = first_sequence;
+  header_->write_sequence = first_sequence;
+  std::atomic_ref(header_->magic).store(kTickFeedMagic,
+                                        std::memory_order_release);
+  sequence_ = first_sequence;
+  return std::nullopt;
+}
+
+void TickFeedPublisher::close() {
+  if (map_ == nullptr) return;
+  std::atomic_ref(header_->closed).store(1, std::memory_order_release);
+  ::munmap(map_, size_);
+  map_ = nullptr;
+}
+
+std::optional<std::string> TickFeedPublisher::writeTick(const Tick& tick) {
+  TickFeedSlot& slot = slots_[sequence_ & (capacity_ - 1)];
+  std::atomic_ref(slot.sequence)
+      .store(2 * sequence_ + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  std::atomic_ref(slot.timestamp)
+      .store(tick.timestamp.count(), std::memory_order_relaxed);
+  std::atomic_ref(slot.price)
+      .store(std::bit_cast<uint64_t>(tick.price), std::memory_order_relaxed);
+  std::atomic_ref(slot.volume)
+      .store(std::bit_cast<uint64_t>(tick.volume), std::memory_order_relaxed);
+  std::atomic_ref(slot.sequence)
+      .store(2 * sequence_ + 2, std::memory_order_release);
+
+  ++sequence_;
+  std::atomic_ref(header_->write_sequence)
+      .store(sequence_, std::memory_order_release);
+  return std::nullopt;
+}
+
+void TickFeedPublisher::save(SnapshotWriter& writer) const {
+  writer.write(sequence_);
+}
+
+std::optional<std::string> TickFeedPublisher::load(SnapshotReader& reader) {
+  uint64_t sequence = 0;
+  if (!reader.read(sequence)) {
+    return std::format("TickFeedPublisher: corrupted snapshot");
+  }
+  close();
+  return create(sequence);
+}
+
+#else
+
+TickFeedPublisher::TickFeedPublisher(const Config&) {
+  throw std::runtime_error("TickFeedPublisher: only available on Linux");
+}
+
+TickFeedPublisher::~TickFeedPublisher() = default;
+
+std::optional<std::string> TickFeedPublisher::writeTick(const Tick&) {
+  return std::nullopt;
+}
+
+void TickFeedPublisher::save(SnapshotWriter&) const {}
+
+std::optional<std::string> TickFeedPublisher::load(SnapshotReader&) {
+  return std::nullopt;
+}
+
+#endif
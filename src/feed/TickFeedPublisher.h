@@ -0,0 +1,47 @@
+#ifndef TRADINGSIMULATOR_TICKFEEDPUBLISHER_H
+#define TRADINGSIMULATOR_TICKFEEDPUBLISHER_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "TickFeed.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+#include "config/Config.h"
+
+// Price output to a shared-memory broadcast ring ([Simulation]
+// tick_log_format = feed) instead of a file: /dev/shm/<tick_feed_name>
+// holds the last tick_feed_capacity ticks for TickFeedSubscriber processes.
+// A previous segment of the same name is unlinked first, so subscribers
+// still attached to it see it closed. The segment is left in place when
+// the run ends, so late subscribers can still read the ring. Linux-only.
+class TickFeedPublisher {
+ public:
+  explicit TickFeedPublisher(const Config& config);
+  ~TickFeedPublisher();  // closes the feed
+
+  TickFeedPublisher(const TickFeedPublisher&) = delete;
+  TickFeedPublisher& operator=(const TickFeedPublisher&) = delete;
+
+  std::optional<std::string> writeTick(const Tick& tick);
+
+  // Only the sequence number is stored: a resumed run continues numbering
+  // in a fresh segment.
+  void save(SnapshotWriter& writer) const;
+  std::optional<std::string> load(SnapshotReader& reader);
+
+ private:
+  std::optional<std::string> create(uint64_t first_sequence);
+  void close();
+
+  std::string name_;
+  uint64_t capacity_;
+  void* map_ = nullptr;
+  size_t size_ = 0;
+  TickFeedHeader* header_ = nullptr;
+  TickFeedSlot* slots_ = nullptr;
+  uint64_t sequence_ = 0;
+};
+
+#endif  // TRADINGSIMULATOR_TICKFEEDPUBLISHER_H
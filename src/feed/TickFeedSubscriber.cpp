@@ -0,0 +1,141 @@
+#include "TickFeedSubscriber.h"
+
+#ifdef __linux__
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <format>
+#include <thread>
+
+std::expected<std::unique_ptr<TickFeedSubscriber>, std::string>
+TickFeedSubscriber::Open(std::string_view name) {
+  const auto shm_name = TickFeedShmName(name);
+  const int fd = ::shm_open(shm_name.c_str(), O_RDONLY | O_CLOEXEC, 0);
+  if (fd < 0) {
+    return std::unexpected(std::format("TickFeedSubscriber: cannot open {}: {}",
+                                       shm_name, std::strerror(errno)));
+  }
+  struct stat st {};
+  const bool sized = ::fstat(fd, &st) == 0 &&
+                     static_cast<size_t>(st.st_size) >= sizeof(TickFeedHeader);
+  void* map = sized ? ::mmap(nullptr, static_cast<size_t>(st.st_size),
+                             PROT_READ, MAP_SHARED, fd, 0)
+                    : MAP_FAILED;
+  ::close(fd);
+  if (map == MAP_FAILED) {
+    return std::unexpected(
+        std::format("TickFeedSubscriber: cannot map {}", shm_name));
+  }
+
+  std::unique_ptr<TickFeedSubscriber> subscriber(
+      new TickFeedSubscriber(map, static_cast<size_t>(st.st_size)));
+  auto& header = *subscriber->header_;
+  if (std::atomic_ref(header.magic).load(std::memory_order_acquire) !=
+          kTickFeedMagic ||
+      header.version != kTickFeedVersion ||
+      header.slot_size != sizeof(TickFeedSlot) ||
+      !std::has_single_bit(header.capacity) ||
+      header.capacity > (subscriber->size_ - sizeof(TickFeedHeader)) /
+                            sizeof(TickFeedSlot)) {
+    return std::unexpected(
+        std::format("TickFeedSubscriber: {} is not a tick feed", shm_name));
+  }
+
+  subscriber->slots_ = reinterpret_cast<TickFeedSlot*>(
+      static_cast<char*>(map) + sizeof(TickFeedHeader));
+  subscriber->mask_ = header.capacity - 1;
+  const uint64_t written =
+      std::atomic_ref(header.write_sequence).load(std::memory_order_acquire);
+  subscriber->next_ =
+      std::max(header.first_sequence,
+               written > header.capacity ? written - header.capacity : 0);
+  return subscriber;
+}
+
+TickFeedSubscriber::TickFeedSubscriber(void* map, size_t size)
+    : map_(map),
+      size_(size),
+      header_(static_cast<TickFeedHeader*>(map)),
+      slots_(nullptr),
+      mask_(0),
+      next_(0) {}
+
+TickFeedSubscriber::~TickFeedSubscriber() { ::munmap(map_, size_); }
+
+std::optional<Tick> TickFeedSubscriber::poll() {
+  while (true) {
+    TickFeedSlot& slot = slots_[next_ & mask_];
+    const uint64_t complete = 2 * next_ + 2;
+    const uint64_t before =
+        std::atomic_ref(slot.sequence).load(std::memory_order_acquire);
+    if (before < complete) {
+      return std::nullopt;  // not published yet, or still being written
+    }
+
+    if (before == complete) {
+      const int64_t timestamp =
+          std::atomic_ref(slot.timestamp).load(std::memory_order_relaxed);
+      const uint64_t price =
+          std::atomic_ref(slot.price).load(std::memory_order_relaxed);
+      const uint64_t volume =
+          std::atomic_ref(slot.volume).load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (std::atomic_ref(slot.sequence).load(std::memory_order_relaxed) ==
+          before) {
+        ++next_;
+        return Tick{std::chrono::nanoseconds(timestamp),
+                    std::bit_cast<double>(price),
+                    std::bit_cast<double>(volume)};
+      }
+    }
+
+    // The publisher lapped us: skip to the oldest tick still in the ring
+    const uint64_t written = std::atomic_ref(header_->write_sequence)
+                                 .load(std::memory_order_acquire);
+    const uint64_t oldest = written - std::min(written, header_->capacity);
+    const uint64_t resume = std::max(oldest, next_ + 1);
+    lost_ += resume - next_;
+    next_ = resume;
+  }
+}
+
+std::optional<Tick> TickFeedSubscriber::next() {
+  while (true) {
+    if (auto tick = poll()) {
+      return tick;
+    }
+    if (std::atomic_ref(header_->closed).load(std::memory_order_acquire)) {
+      // Ticks published before the close are visible now
+      return poll();
+    }
+    std::this_thread::yield();
+  }
+}
+
+uint64_t TickFeedSubscriber::sequence() const { return next_; }
+
+uint64_t TickFeedSubscriber::lost() const { return lost_; }
+
+#else
+
+std::expected<std::unique_ptr<TickFeedSubscriber>, std::string>
+TickFeedSubscriber::Open(std::string_view) {
+  return std::unexpected("TickFeedSubscriber: only available on Linux");
+}
+
+TickFeedSubscriber::~TickFeedSubscriber() = default;
+
+std::optional<Tick> TickFeedSubscriber::poll() { return std::nullopt; }
+std::optional<Tick> TickFeedSubscriber::next() { return std::nullopt; }
+uint64_t TickFeedSubscriber::sequence() const { return 0; }
+uint64_t TickFeedSubscriber::lost() const { return 0; }
+
+#endif
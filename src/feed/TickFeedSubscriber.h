@@ -0,0 +1,52 @@
+#ifndef TRADINGSIMULATOR_TICKFEEDSUBSCRIBER_H
+#define TRADINGSIMULATOR_TICKFEEDSUBSCRIBER_H
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "TickFeed.h"
+#include "common/Types.h"
+
+// Client side of the shared-memory tick feed, built on its own as the
+// TickFeedClient library for strategy processes. Any number of subscribers
+// may read one feed; each keeps its own position and never slows the
+// publisher down. A new subscriber starts at the oldest tick still held in
+// the ring. Linux-only.
+class TickFeedSubscriber {
+ public:
+  static std::expected<std::unique_ptr<TickFeedSubscriber>, std::string> Open(
+      std::string_view name);
+  ~TickFeedSubscriber();
+
+  TickFeedSubscriber(const TickFeedSubscriber&) = delete;
+  TickFeedSubscriber& operator=(const TickFeedSubscriber&) = delete;
+
+  // The next tick if it has been published, without waiting
+  std::optional<Tick> poll();
+
+  // Spins until the next tick is published; nullopt once the publisher has
+  // closed the feed and every remaining tick was read.
+  std::optional<Tick> next();
+
+  // Sequence number of the tick the next poll() returns
+  [[nodiscard]] uint64_t sequence() const;
+  // Ticks overwritten before this subscriber got to them
+  [[nodiscard]] uint64_t lost() const;
+
+ private:
+  TickFeedSubscriber(void* map, size_t size);
+
+  void* map_;
+  size_t size_;
+  TickFeedHeader* header_;
+  TickFeedSlot* slots_;
+  uint64_t mask_;
+  uint64_t next_;
+  uint64_t lost_ = 0;
+};
+
+#endif  // TRADINGSIMULATOR_TICKFEEDSUBSCRIBER_H
@@ -0,0 +1,96 @@
+#ifndef TRADINGSIMULATOR_UDPFEED_H
+#define TRADINGSIMULATOR_UDPFEED_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#ifdef __linux__
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+// Wire format of the loopback UDP tick feed written by UdpFeedPublisher and
+// read by UdpFeedSubscriber. Each datagram holds a header and up to
+// kUdpFeedMaxBatch consecutive ticks; tick sequence numbers count from 0
+// over the whole run, so a subscriber spots a lost datagram as a jump in
+// first_sequence and asks the publisher's TCP replay port for the missing
+// range. Numbers are in host byte order: both ends run on the same machine.
+
+inline constexpr uint32_t kUdpFeedMagic = 0x5544'5054;  // TPDU
+inline constexpr uint16_t kUdpFeedEnd = 1;  // flag: no ticks follow
+
+struct UdpFeedHeader {
+  uint32_t magic;
+  uint16_t count;  // ticks in this datagram
+  uint16_t flags;
+  uint64_t first_sequence;  // of the first tick; with kUdpFeedEnd, the total
+};
+
+struct UdpFeedTick {
+  int64_t timestamp;  // nanoseconds
+  double price;
+  double volume;
+};
+
+static_assert(sizeof(UdpFeedHeader) == 16);
+static_assert(sizeof(UdpFeedTick) == 24);
+static_assert(std::is_trivially_copyable_v<UdpFeedTick>);
+
+// Largest batch that keeps a datagram within a 1500-byte MTU
+inline constexpr size_t kUdpFeedMaxBatch = 60;
+inline constexpr size_t kUdpFeedMaxDatagram =
+    sizeof(UdpFeedHeader) + kUdpFeedMaxBatch * sizeof(UdpFeedTick);
+
+// Replay request over TCP: ticks [first_sequence, first_sequence + count).
+// The reply gives the range actually available, followed by that many
+// UdpFeedTick records, and the connection is closed. It also tells how far
+// the feed has got, so a subscriber that missed the kUdpFeedEnd datagrams
+// still learns where the feed ends.
+struct UdpReplayRange {
+  uint64_t first_sequence;
+  uint64_t count;
+};
+
+struct UdpReplayReply {
+  uint64_t first_sequence;  // of the ticks that follow
+  uint64_t count;
+  uint64_t sent;   // ticks published so far; with kUdpFeedEnd, the total
+  uint16_t flags;  // kUdpFeedEnd once the feed has ended
+  uint16_t reserved[3];
+};
+
+static_assert(sizeof(UdpReplayReply) == 32);
+
+#ifdef __linux__
+
+// Blocking transfer of exactly `size` bytes over the replay connection
+inline bool UdpReplayRead(int fd, void* data, size_t size) {
+  auto* bytes = static_cast<std::byte*>(data);
+  while (size > 0) {
+    const ssize_t n = ::read(fd, bytes, size);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    bytes += n;
+    size -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+inline bool UdpReplayWrite(int fd, const void* data, size_t size) {
+  const auto* bytes = static_cast<const std::byte*>(data);
+  while (size > 0) {
+    const ssize_t n = ::send(fd, bytes, size, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    bytes += n;
+    size -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+#endif
+
+#endif  // TRADINGSIMULATOR_UDPFEED_H
@@ -0,0 +1,265 @@
+#include "UdpFeedPublisher.h"
+
+#include <stdexcept>
+
+#ifdef __linux__
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <format>
+
+namespace {
+
+sockaddr_in Loopback(uint16_t port) {
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  return address;
+}
+
+}  // namespace
+
+UdpFeedPublisher::UdpFeedPublisher(const Config& config)
+    : batch_(config.udp_feed_batch),
+      packets_(kPacketsPerSend * kUdpFeedMaxDatagram),
+      replay_(config.udp_replay_capacity) {
+  const auto feed = Loopback(config.udp_feed_port);
+  const auto replay = Loopback(config.udp_replay_port);
+  const int one = 1;
+
+  socket_ = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+  listener_ = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  const char* failed = nullptr;
+  if (socket_ < 0 || listener_ < 0) {
+    failed = "create sockets";
+  } else if (::connect(socket_, reinterpret_cast<const sockaddr*>(&feed),
+                       sizeof(feed)) != 0) {
+    failed = "address the feed port";
+  } else if (::setsockopt(listener_, SOL_SOCKET, SO_REUSEADDR, &one,
+                          sizeof(one)) != 0 ||
+             ::bind(listener_, reinterpret_cast<const sockaddr*>(&replay),
+                    sizeof(replay)) != 0 ||
+             ::listen(listener_, 16) != 0) {
+    failed = "listen on the replay port";
+  }
+  if (failed != nullptr) {
+    const int error = errno;
+    if (socket_ >= 0) ::close(socket_);
+    if (listener_ >= 0) ::close(listener_);
+    throw std::runtime_error(std::format("UdpFeedPublisher: cannot {}: {}",
+                                         failed, std::strerror(error)));
+  }
+
+  replay_thread_ =
+      std::jthread([this](std::stop_token stop) { serveReplays(stop); });
+}
+
+UdpFeedPublisher::~UdpFeedPublisher() {
+  finishPacket();
+  flush();
+
+  // Subscribers recovering the tail of the feed still get their replays,
+  // which tell them the feed has ended if they miss the datagrams below
+  {
+    std::lock_guard lock(replay_mutex_);
+    ended_ = true;
+    last_replay_ = std::chrono::steady_clock::now();
+  }
+
+  const UdpFeedHeader end{.magic = kUdpFeedMagic,
+                          .count = 0,
+                          .flags = kUdpFeedEnd,
+                          .first_sequence = sequence_};
+  for (int i = 0; i < 3; ++i) {
+    ::send(socket_, &end, sizeof(end), 0);
+  }
+
+  while (true) {
+    std::chrono::steady_clock::duration idle;
+    {
+      std::lock_guard lock(replay_mutex_);
+      idle = std::chrono::steady_clock::now() - last_replay_;
+    }
+    if (idle >= kReplayLinger) break;
+    std::this_thread::sleep_for(kReplayLinger - idle);
+  }
+
+  replay_thread_.request_stop();
+  replay_thread_.join();
+  ::close(socket_);
+  ::close(listener_);
+}
+
+std::optional<std::string> UdpFeedPublisher::writeTick(const Tick& tick) {
+  const UdpFeedTick wire{.timestamp = tick.timestamp.count(),
+                         .price = tick.price,
+                         .volume = tick.volume};
+  std::byte* packet = packets_.data() + full_packets_ * kUdpFeedMaxDatagram;
+  std::memcpy(packet + sizeof(UdpFeedHeader) +
+                  packet_ticks_ * sizeof(UdpFeedTick),
+              &wire, sizeof(wire));
+  if (++packet_ticks_ == batch_) {
+    finishPacket();
+  }
+  return std::nullopt;
+}
+
+void UdpFeedPublisher::finishPacket() {
+  if (packet_ticks_ == 0) return;
+
+  std::byte* packet = packets_.data() + full_packets_ * kUdpFeedMaxDatagram;
+  const UdpFeedHeader header{.magic = kUdpFeedMagic,
+                             .count = static_cast<uint16_t>(packet_ticks_),
+                             .flags = 0,
+                             .first_sequence = sequence_};
+  std::memcpy(packet, &header, sizeof(header));
+
+  {
+    std::lock_guard lock(replay_mutex_);
+    const uint64_t mask = replay_.size() - 1;
+    const auto* ticks = packet + sizeof(UdpFeedHeader);
+    for (size_t i = 0; i < packet_ticks_; ++i) {
+      std::memcpy(&replay_[(sequence_ + i) & mask],
+                  ticks + i * sizeof(UdpFeedTick), sizeof(UdpFeedTick));
+    }
+    replay_end_ = sequence_ + packet_ticks_;
+    replay_begin_ = std::max(
+        replay_begin_, replay_end_ - std::min(replay_end_, mask + 1));
+  }
+
+  sequence_ += packet_ticks_;
+  packet_ticks_ = 0;
+  if (++full_packets_ == kPacketsPerSend) {
+    flush();
+  }
+}
+
+// Datagrams sent while no receiver is bound are dropped like on any UDP
+// feed: subscribers recover them by replay. The ICMP error they cause is
+// reported by a later send without sending its datagram, which is retried.
+void UdpFeedPublisher::flush() {
+  std::array<iovec, kPacketsPerSend> iov{};
+  std::array<mmsghdr, kPacketsPerSend> messages{};
+  for (size_t i = 0; i < full_packets_; ++i) {
+    std::byte* packet = packets_.data() + i * kUdpFeedMaxDatagram;
+    UdpFeedHeader header{};
+    std::memcpy(&header, packet, sizeof(header));
+    iov[i] = {.iov_base = packet,
+              .iov_len = sizeof(UdpFeedHeader) +
+                         header.count * sizeof(UdpFeedTick)};
+    messages[i].msg_hdr.msg_iov = &iov[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  size_t sent = 0;
+  while (sent < full_packets_) {
+    const int n = ::sendmmsg(socket_, messages.data() + sent,
+                             static_cast<unsigned>(full_packets_ - sent), 0);
+    if (n > 0) {
+      sent += static_cast<size_t>(n);
+    } else if (errno != EINTR && errno != ECONNREFUSED) {
+      ++sent;
+    }
+  }
+  datagrams_ += full_packets_;
+  full_packets_ = 0;
+}
+
+void UdpFeedPublisher::serveReplays(std::stop_token stop) {
+  while (!stop.stop_requested()) {
+    pollfd ready{.fd = listener_, .events = POLLIN, .revents = 0};
+    if (::poll(&ready, 1, 50) <= 0) continue;
+    const int connection =
+        ::accept4(listener_, nullptr, nullptr, SOCK_CLOEXEC);
+    if (connection < 0) continue;
+    replay(connection);
+    ::close(connection);
+  }
+}
+
+void UdpFeedPublisher::replay(int connection) {
+  const timeval timeout{.tv_sec = 1, .tv_usec = 0};
+  ::setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout,
+               sizeof(timeout));
+  UdpReplayRange request{};
+  if (!UdpReplayRead(connection, &request, sizeof(request))) return;
+
+  UdpReplayReply reply{};
+  std::vector<UdpFeedTick> ticks;
+  {
+    std::lock_guard lock(replay_mutex_);
+    const uint64_t first = std::max(request.first_sequence, replay_begin_);
+    const uint64_t end =
+        std::min(request.first_sequence + request.count, replay_end_);
+    if (first < end) {
+      reply.first_sequence = first;
+      reply.count = end - first;
+      ticks.reserve(reply.count);
+      const uint64_t mask = replay_.size() - 1;
+      for (uint64_t sequence = first; sequence < end; ++sequence) {
+        ticks.push_back(replay_[sequence & mask]);
+      }
+    }
+    reply.sent = replay_end_;
+    reply.flags = ended_ ? kUdpFeedEnd : 0;
+    ++replays_;
+    last_replay_ = std::chrono::steady_clock::now();
+  }
+
+  if (UdpReplayWrite(connection, &reply, sizeof(reply))) {
+    UdpReplayWrite(connection, ticks.data(),
+                   ticks.size() * sizeof(UdpFeedTick));
+  }
+}
+
+void UdpFeedPublisher::save(SnapshotWriter& writer) const {
+  writer.write(sequence_);
+}
+
+std::optional<std::string> UdpFeedPublisher::load(SnapshotReader& reader) {
+  if (!reader.read(sequence_)) {
+    return std::format("UdpFeedPublisher: corrupted snapshot");
+  }
+  std::lock_guard lock(replay_mutex_);
+  replay_begin_ = replay_end_ = sequence_;
+  return std::nullopt;
+}
+
+uint64_t UdpFeedPublisher::datagrams() const { return datagrams_; }
+
+uint64_t UdpFeedPublisher::replays() const {
+  std::lock_guard lock(replay_mutex_);
+  return replays_;
+}
+
+#else
+
+UdpFeedPublisher::UdpFeedPublisher(const Config&) {
+  throw std::runtime_error("UdpFeedPublisher: only available on Linux");
+}
+
+UdpFeedPublisher::~UdpFeedPublisher() = default;
+
+std::optional<std::string> UdpFeedPublisher::writeTick(const Tick&) {
+  return std::nullopt;
+}
+
+void UdpFeedPublisher::save(SnapshotWriter&) const {}
+
+std::optional<std::string> UdpFeedPublisher::load(SnapshotReader&) {
+  return std::nullopt;
+}
+
+uint64_t UdpFeedPublisher::datagrams() const { return 0; }
+uint64_t UdpFeedPublisher::replays() const { return 0; }
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef TRADINGSIMULATOR_UDPFEEDPUBLISHER_H
+#define TRADINGSIMULATOR_UDPFEEDPUBLISHER_H
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "UdpFeed.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+#include "config/Config.h"
+
+// Price output as UDP datagrams to 127.0.0.1:udp_feed_port ([Simulation]
+// tick_log_format = udp) instead of a file, standing in for an exchange
+// multicast feed. Ticks are packed udp_feed_batch per datagram and the
+// datagrams handed to the kernel kPacketsPerSend at a time with sendmmsg.
+//
+// The last udp_replay_capacity sent ticks are kept for a TCP replay server
+// on 127.0.0.1:udp_replay_port, served by a background thread, from which
+// subscribers recover lost datagrams. The end of the feed is announced
+// with a kUdpFeedEnd datagram, sent several times in case one is dropped,
+// and in every replay reply from then on; replays are still served until
+// none has been asked for during kReplayLinger. Linux-only.
+class UdpFeedPublisher {
+ public:
+  explicit UdpFeedPublisher(const Config& config);
+  ~UdpFeedPublisher();  // ends the feed
+
+  UdpFeedPublisher(const UdpFeedPublisher&) = delete;
+  UdpFeedPublisher& operator=(const UdpFeedPublisher&) = delete;
+
+  std::optional<std::string> writeTick(const Tick& tick);
+
+  // Only the sequence number is stored: a resumed run continues numbering
+  void save(SnapshotWriter& writer) const;
+  std::optional<std::string> load(SnapshotReader& reader);
+
+  [[nodiscard]] uint64_t datagrams() const;
+  [[nodiscard]] uint64_t replays() const;
+
+  static constexpr size_t kPacketsPerSend = 16;
+  static constexpr std::chrono::milliseconds kReplayLinger{200};
+
+ private:
+  void finishPacket();
+  void flush();
+  void serveReplays(std::stop_token stop);
+  void replay(int connection);
+
+  int socket_ = -1;
+  int listener_ = -1;
+  size_t batch_;
+
+  // Datagrams waiting for the next sendmmsg; the last one is being filled
+  std::vector<std::byte> packets_;
+  size_t full_packets_ = 0;
+  size_t packet_ticks_ = 0;
+  uint64_t sequence_ = 0;  // of the next tick
+  uint64_t datagrams_ = 0;
+
+  // Ticks already sent, indexed by sequence & (replay_.size() - 1)
+  mutable std::mutex replay_mutex_;
+  std::vector<UdpFeedTick> replay_;
+  uint64_t replay_end_ = 0;    // sequence after the last sent tick
+  uint64_t replay_begin_ = 0;  // first sequence the ring still holds
+  uint64_t replays_ = 0;
+  bool ended_ = false;
+  std::chrono::steady_clock::time_point last_replay_;
+  std::jthread replay_thread_;
+};
+
+#endif  // TRADINGSIMULATOR_UDPFEEDPUBLISHER_H
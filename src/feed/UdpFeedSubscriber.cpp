@@ -0,0 +1,209 @@
+#include "UdpFeedSubscriber.h"
+
+#ifdef __linux__
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <format>
+#include <limits>
+
+namespace {
+
+sockaddr_in Loopback(uint16_t port) {
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  return address;
+}
+
+Tick FromWire(const std::byte* data) {
+  UdpFeedTick wire{};
+  std::memcpy(&wire, data, sizeof(wire));
+  return {std::chrono::nanoseconds(wire.timestamp), wire.price, wire.volume};
+}
+
+}  // namespace
+
+std::expected<std::unique_ptr<UdpFeedSubscriber>, std::string>
+UdpFeedSubscriber::Open(uint16_t feed_port, uint16_t replay_port,
+                        int receive_buffer) {
+  const int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    return std::unexpected(std::format(
+        "UdpFeedSubscriber: cannot create socket: {}", std::strerror(errno)));
+  }
+  const auto address = Loopback(feed_port);
+  const auto idle = std::chrono::duration_cast<std::chrono::microseconds>(
+      kIdleTimeout);
+  const timeval timeout{.tv_sec = 0, .tv_usec = idle.count()};
+  if (::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) !=
+          0 ||
+      (receive_buffer > 0 &&
+       ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &receive_buffer,
+                    sizeof(receive_buffer)) != 0) ||
+      ::bind(fd, reinterpret_cast<const sockaddr*>(&address),
+             sizeof(address)) != 0) {
+    const int error = errno;
+    ::close(fd);
+    return std::unexpected(std::format("UdpFeedSubscriber: cannot bind {}: {}",
+                                       feed_port, std::strerror(error)));
+  }
+  return std::unique_ptr<UdpFeedSubscriber>(
+      new UdpFeedSubscriber(fd, replay_port));
+}
+
+UdpFeedSubscriber::UdpFeedSubscriber(int socket, uint16_t replay_port)
+    : socket_(socket),
+      replay_port_(replay_port),
+      buffers_(kReceiveBatch * kUdpFeedMaxDatagram) {}
+
+UdpFeedSubscriber::~UdpFeedSubscriber() { ::close(socket_); }
+
+std::optional<Tick> UdpFeedSubscriber::next() {
+  while (ready_pos_ == ready_.size()) {
+    ready_.clear();
+    ready_pos_ = 0;
+    if (ended_) return std::nullopt;
+    receive();
+  }
+  ++stats_.ticks;
+  return ready_[ready_pos_++];
+}
+
+const UdpFeedStats& UdpFeedSubscriber::stats() const { return stats_; }
+
+// Waits for one datagram and takes whatever else is already queued
+void UdpFeedSubscriber::receive() {
+  std::array<iovec, kReceiveBatch> iov{};
+  std::array<mmsghdr, kReceiveBatch> messages{};
+  for (size_t i = 0; i < kReceiveBatch; ++i) {
+    iov[i] = {.iov_base = buffers_.data() + i * kUdpFeedMaxDatagram,
+              .iov_len = kUdpFeedMaxDatagram};
+    messages[i].msg_hdr.msg_iov = &iov[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  const int received = ::recvmmsg(socket_, messages.data(), kReceiveBatch,
+                                  MSG_WAITFORONE, nullptr);
+  if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+    // The end datagrams may have been dropped: ask how far the feed has
+    // got. A replay server gone after the feed started means the publisher
+    // has finished.
+    if (!replay(std::numeric_limits<uint64_t>::max()) &&
+        stats_.datagrams > 0) {
+      ended_ = true;
+    }
+    return;
+  }
+  for (int i = 0; i < received; ++i) {
+    const std::byte* data = buffers_.data() + i * kUdpFeedMaxDatagram;
+    const size_t length = messages[i].msg_len;
+    UdpFeedHeader header{};
+    if (length < sizeof(header)) continue;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != kUdpFeedMagic ||
+        length < sizeof(header) + header.count * sizeof(UdpFeedTick)) {
+      continue;
+    }
+    accept(header, data + sizeof(header));
+  }
+}
+
+void UdpFeedSubscriber::accept(const UdpFeedHeader& header,
+                               const std::byte* ticks) {
+  if (ended_) return;
+  ++stats_.datagrams;
+
+  if (header.flags & kUdpFeedEnd) {
+    if (header.first_sequence > expected_) {
+      ++stats_.gaps;
+      recover(header.first_sequence);
+    }
+    ended_ = true;
+    return;
+  }
+
+  const uint64_t first = header.first_sequence;
+  const uint64_t end = first + header.count;
+  if (end <= expected_) return;  // a duplicate, or already replayed
+  if (first > expected_) {
+    ++stats_.gaps;
+    recover(first);
+  }
+  for (uint64_t sequence = expected_; sequence < end; ++sequence) {
+    ready_.push_back(
+        FromWire(ticks + (sequence - first) * sizeof(UdpFeedTick)));
+  }
+  expected_ = end;
+}
+
+// Queues ticks [expected_, end) from the replay server, skipping them as
+// lost if it cannot be reached
+void UdpFeedSubscriber::recover(uint64_t end) {
+  if (!replay(end)) {
+    stats_.lost += end - expected_;
+    expected_ = end;
+  }
+}
+
+// Queues what the replay server still holds of ticks [expected_, end),
+// counting the rest up to end, or up to the ticks sent so far if fewer, as
+// lost. Ends the feed once the server says every tick has been sent.
+// False if the server did not answer.
+bool UdpFeedSubscriber::replay(uint64_t end) {
+  const UdpReplayRange request{.first_sequence = expected_,
+                               .count = end - expected_};
+  UdpReplayReply reply{};
+  const int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  const auto address = Loopback(replay_port_);
+  const bool answered =
+      fd >= 0 &&
+      ::connect(fd, reinterpret_cast<const sockaddr*>(&address),
+                sizeof(address)) == 0 &&
+      UdpReplayWrite(fd, &request, sizeof(request)) &&
+      UdpReplayRead(fd, &reply, sizeof(reply)) && reply.sent >= expected_ &&
+      (reply.count == 0 ||
+       (reply.first_sequence >= expected_ &&
+        reply.first_sequence + reply.count <= std::min(end, reply.sent)));
+  uint64_t read = 0;
+  if (answered) {
+    std::array<std::byte, sizeof(UdpFeedTick)> wire{};
+    while (read < reply.count &&
+           UdpReplayRead(fd, wire.data(), wire.size())) {
+      ready_.push_back(FromWire(wire.data()));
+      ++read;
+    }
+  }
+  if (fd >= 0) ::close(fd);
+  if (!answered) return false;
+
+  end = std::min(end, reply.sent);
+  stats_.recovered += read;
+  stats_.lost += (end - expected_) - read;
+  expected_ = end;
+  if ((reply.flags & kUdpFeedEnd) && expected_ == reply.sent) ended_ = true;
+  return true;
+}
+
+#else
+
+std::expected<std::unique_ptr<UdpFeedSubscriber>, std::string>
+UdpFeedSubscriber::Open(uint16_t, uint16_t, int) {
+  return std::unexpected("UdpFeedSubscriber: only available on Linux");
+}
+
+UdpFeedSubscriber::~UdpFeedSubscriber() = default;
+
+std::optional<Tick> UdpFeedSubscriber::next() { return std::nullopt; }
+
+const UdpFeedStats& UdpFeedSubscriber::stats() const { return stats_; }
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef TRADINGSIMULATOR_UDPFEEDSUBSCRIBER_H
+#define TRADINGSIMULATOR_UDPFEEDSUBSCRIBER_H
+
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "UdpFeed.h"
+#include "common/Types.h"
+
+// Feed handler counters
+struct UdpFeedStats {
+  uint64_t datagrams = 0;  // received
+  uint64_t ticks = 0;      // delivered by next()
+  uint64_t gaps = 0;       // sequence jumps detected
+  uint64_t recovered = 0;  // ticks obtained by replay
+  uint64_t lost = 0;       // ticks the replay server no longer had
+};
+
+// Client side of the loopback UDP tick feed, part of the TickFeedClient
+// library. Receives up to kReceiveBatch datagrams per recvmmsg call and
+// delivers ticks strictly in sequence order from 0: when a datagram starts
+// past the expected sequence, the missing range is fetched from the
+// publisher's replay port first. Ticks the publisher no longer holds are
+// counted as lost and skipped. When nothing arrives for kIdleTimeout the
+// replay port is asked for the tail of the feed, so the end is found even
+// if every kUdpFeedEnd datagram was dropped. Linux-only.
+class UdpFeedSubscriber {
+ public:
+  // Binds 127.0.0.1:feed_port; a receive buffer of 0 keeps the default
+  static std::expected<std::unique_ptr<UdpFeedSubscriber>, std::string> Open(
+      uint16_t feed_port, uint16_t replay_port, int receive_buffer = 0);
+  ~UdpFeedSubscriber();
+
+  UdpFeedSubscriber(const UdpFeedSubscriber&) = delete;
+  UdpFeedSubscriber& operator=(const UdpFeedSubscriber&) = delete;
+
+  // Blocks until the next tick arrives; nullopt once the publisher has
+  // ended the feed and every tick before the end was delivered or lost.
+  std::optional<Tick> next();
+
+  [[nodiscard]] const UdpFeedStats& stats() const;
+
+  static constexpr size_t kReceiveBatch = 16;
+  // Below UdpFeedPublisher::kReplayLinger, so the tail can still be asked for
+  static constexpr std::chrono::milliseconds kIdleTimeout{50};
+
+ private:
+  UdpFeedSubscriber(int socket, uint16_t replay_port);
+  void receive();
+  void accept(const UdpFeedHeader& header, const std::byte* ticks);
+  void recover(uint64_t end);
+  bool replay(uint64_t end);
+
+  int socket_;
+  uint16_t replay_port_;
+  std::vector<std::byte> buffers_;
+  std::vector<Tick> ready_;  // in sequence order, from ready_pos_
+  size_t ready_pos_ = 0;
+  uint64_t expected_ = 0;  // sequence of the next tick to queue
+  bool ended_ = false;
+  UdpFeedStats stats_;
+};
+
+#endif  // TRADINGSIMULATOR_UDPFEEDSUBSCRIBER_H
@@ -0,0 +1,52 @@
+#include "BarAggregator.h"
+
+#include <algorithm>
+
+BarAggregator::BarAggregator(std::chrono::nanoseconds resolution)
+    : resolution_(resolution) {}
+
+std::optional<Bar> BarAggregator::add(const Tick& tick) {
+  const auto start = tick.timestamp - tick.timestamp % resolution_;
+  if (open_ && start == bar_.start) {
+    bar_.high = std::max(bar_.high, tick.price);
+    bar_.low = std::min(bar_.low, tick.price);
+    bar_.close = tick.price;
+    bar_.volume += tick.volume;
+    notional_ += tick.price * tick.volume;
+    return std::nullopt;
+  }
+
+  auto completed = current();
+  bar_ = {.start = start,
+          .open = tick.price,
+          .high = tick.price,
+          .low = tick.price,
+          .close = tick.price,
+          .volume = tick.volume};
+  notional_ = tick.price * tick.volume;
+  open_ = true;
+  return completed;
+}
+
+std::optional<Bar> BarAggregator::current() const {
+  if (!open_) {
+    return std::nullopt;
+  }
+  Bar bar = bar_;
+  bar.vwap = bar.volume > 0 ? notional_ / bar.volume : bar.close;
+  return bar;
+}
+
+std::chrono::nanoseconds BarAggregator::resolution() const {
+  return resolution_;
+}
+
+void BarAggregator::save(SnapshotWriter& writer) const {
+  writer.write(open_);
+  writer.write(bar_);
+  writer.write(notional_);
+}
+
+bool BarAggregator::load(SnapshotReader& reader) {
+  return reader.read(open_) && reader.read(bar_) && reader.read(notional_);
+}
@@ -0,0 +1,45 @@
+#ifndef TRADINGSIMULATOR_BARAGGREGATOR_H
+#define TRADINGSIMULATOR_BARAGGREGATOR_H
+
+#include <chrono>
+#include <optional>
+
+#include "common/Snapshot.h"
+#include "common/Types.h"
+
+// OHLCV bar with the volume-weighted average price of its ticks.
+struct Bar {
+  std::chrono::nanoseconds start{0};  // a multiple of the resolution
+  Price open = 0;
+  Price high = 0;
+  Price low = 0;
+  Price close = 0;
+  Volume volume = 0;
+  Price vwap = 0;
+};
+
+// Folds a tick stream into bars of one resolution in O(1) per tick. Bars
+// are aligned to multiples of the resolution from time zero; intervals
+// without ticks produce no bar.
+class BarAggregator {
+ public:
+  explicit BarAggregator(std::chrono::nanoseconds resolution);
+
+  // Returns the previous bar once `tick` falls into a later interval.
+  std::optional<Bar> add(const Tick& tick);
+
+  // The bar still collecting ticks, if any
+  [[nodiscard]] std::optional<Bar> current() const;
+  [[nodiscard]] std::chrono::nanoseconds resolution() const;
+
+  void save(SnapshotWriter& writer) const;
+  bool load(SnapshotReader& reader);
+
+ private:
+  std::chrono::nanoseconds resolution_;
+  bool open_ = false;
+  Bar bar_;
+  Price notional_ = 0;  // sum of price * volume over the bar
+};
+
+#endif  // TRADINGSIMULATOR_BARAGGREGATOR_H
@@ -0,0 +1,154 @@
+#include "BarLogger.h"
+
+#include <format>
+#include <print>
+
+namespace {
+
+std::string ResolutionName(std::chrono::nanoseconds resolution) {
+  using namespace std::chrono;
+  if (resolution % hours(1) == 0ns)
+    return std::format("{}h", duration_cast<hours>(resolution).count());
+  if (resolution % minutes(1) == 0ns)
+    return std::format("{}min", duration_cast<minutes>(resolution).count());
+  if (resolution % seconds(1) == 0ns)
+    return std::format("{}s", duration_cast<seconds>(resolution).count());
+  if (resolution % milliseconds(1) == 0ns)
+    return std::format("{}ms",
+                       duration_cast<milliseconds>(resolution).count());
+  return std::format("{}ns", resolution.count());
+}
+
+}  // namespace
+
+BarLogger::BarLogger(const Config& config) : backend_(config.tick_log_backend) {
+  outputs_.reserve(config.bar_resolutions.size());
+  for (const auto resolution : config.bar_resolutions) {
+    outputs_.push_back({.bars = BarAggregator(resolution),
+                        .path = Path(config.price_evolution_path, resolution)});
+    auto error = openFile(outputs_.back(), config.resume);
+    if (error) {
+      throw std::runtime_error(error.value());
+    }
+  }
+}
+
+BarLogger::~BarLogger() {
+  for (auto& output : outputs_) {
+    const auto bar = output.bars.current();
+    if (!output.file || !bar) continue;  // a failed load() left no file
+    if (auto err = writeBar(output, *bar)) {
+      std::println(stderr, "{}", err.value());
+    }
+  }
+}
+
+std::optional<std::string> BarLogger::writeTick(const Tick& tick) {
+  for (auto& output : outputs_) {
+    if (const auto bar = output.bars.add(tick)) {
+      if (auto err = writeBar(output, *bar)) {
+        return err;
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<std::string> BarLogger::writeBar(Output& output,
+                                               const Bar& bar) {
+  const auto start_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(bar.start);
+  const auto line = std::format(
+      "{:%T},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f}\n", start_ms, bar.open,
+      bar.high, bar.low, bar.close, bar.volume, bar.vwap);
+  output.file_size += line.size();
+
+  if (auto err = output.file->write(line)) {
+    return std::format("BarLogger: {}", err.value());
+  }
+  return std::nullopt;
+}
+
+std::optional<std::string> BarLogger::openFile(Output& output, bool append) {
+  std::error_code ec;
+  fs::create_directories(output.path.parent_path(), ec);
+
+  if (ec) {
+    return std::format("BarLogger: error on folder creation for path: {}",
+                       output.path.string());
+  }
+
+  if (append) {
+    output.file_size = fs::file_size(output.path, ec);
+    if (ec) {
+      return std::format("BarLogger: cannot resume missing file: {}",
+                         output.path.string());
+    }
+  }
+
+  auto sink = OpenFileSink(backend_, output.path, append);
+  if (!sink) {
+    return std::format("BarLogger: {}", sink.error());
+  }
+  output.file = std::move(sink.value());
+
+  if (append) {
+    return std::nullopt;
+  }
+
+  const std::string header = "Time,Open,High,Low,Close,Volume,VWAP\n";
+  output.file_size = header.size();
+
+  if (auto err = output.file->write(header)) {
+    return std::format("BarLogger: {}", err.value());
+  }
+
+  return std::nullopt;
+}
+
+void BarLogger::save(SnapshotWriter& writer) const {
+  for (const auto& output : outputs_) {
+    if (auto err = output.file->flush()) {
+      std::println(stderr, "BarLogger: {}", err.value());
+    }
+    writer.write(output.file_size);
+    output.bars.save(writer);
+  }
+}
+
+std::optional<std::string> BarLogger::load(SnapshotReader& reader) {
+  for (auto& output : outputs_) {
+    uint64_t size = 0;
+    if (!reader.read(size) || !output.bars.load(reader)) {
+      return std::format("BarLogger: corrupted snapshot");
+    }
+
+    output.file.reset();
+    std::error_code ec;
+    if (fs::file_size(output.path, ec) < size || ec) {
+      return std::format("BarLogger: {} is shorter than the snapshot",
+                         output.path.string());
+    }
+    fs::resize_file(output.path, size, ec);
+    if (ec) {
+      return std::format("BarLogger: cannot truncate {}: {}",
+                         output.path.string(), ec.message());
+    }
+
+    auto sink = OpenFileSink(backend_, output.path, true);
+    if (!sink) {
+      return std::format("BarLogger: {}", sink.error());
+    }
+    output.file = std::move(sink.value());
+    output.file_size = size;
+  }
+  return std::nullopt;
+}
+
+fs::path BarLogger::Path(const fs::path& base,
+                         std::chrono::nanoseconds resolution) {
+  auto file_name = base.stem();
+  file_name += std::format(".{}", ResolutionName(resolution));
+  file_name += base.extension();
+  return base.parent_path() / file_name;
+}
@@ -0,0 +1,56 @@
+#ifndef TRADINGSIMULATOR_BARLOGGER_H
+#define TRADINGSIMULATOR_BARLOGGER_H
+
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "BarAggregator.h"
+#include "FileSink.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+#include "config/Config.h"
+
+namespace fs = std::filesystem;
+
+// Price log of OHLCV bars ([Simulation] tick_log_format = bars): ticks are
+// aggregated at every bar_resolutions entry and each resolution is written
+// to its own CSV file next to price_evolution_path. Raw ticks are not
+// written. The bars still open when the logger closes are written as well.
+class BarLogger {
+ public:
+  explicit BarLogger(const Config& config);
+  ~BarLogger();
+
+  BarLogger(const BarLogger&) = delete;
+  BarLogger& operator=(const BarLogger&) = delete;
+
+  std::optional<std::string> writeTick(const Tick& tick);
+
+  // Stores each file length and open bar: restoring truncates the files to
+  // the checkpoint and continues the bars in progress.
+  void save(SnapshotWriter& writer) const;
+  std::optional<std::string> load(SnapshotReader& reader);
+
+  // output/price_evolution.csv -> output/price_evolution.1min.csv
+  static fs::path Path(const fs::path& base,
+                       std::chrono::nanoseconds resolution);
+
+ private:
+  struct Output {
+    BarAggregator bars;
+    fs::path path;
+    std::optional<FileSink> file;
+    uint64_t file_size = 0;
+  };
+
+  std::optional<std::string> openFile(Output& output, bool append);
+  std::optional<std::string> writeBar(Output& output, const Bar& bar);
+
+  FileSinkBackend backend_;
+  std::vector<Output> outputs_;
+};
+
+#endif  // TRADINGSIMULATOR_BARLOGGER_H
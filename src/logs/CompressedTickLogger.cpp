@@ -0,0 +1,232 @@
+#include "CompressedTickLogger.h"
+
+#include <cmath>
+#include <cstring>
+#include <format>
+#include <print>
+
+#include "common/Parallel.h"
+
+namespace {
+
+constexpr std::string_view kTickMagic = "TSIMTICK";
+constexpr uint32_t kTickVersion = 1;
+constexpr size_t kHeaderSize =
+    kTickMagic.size() + sizeof(uint32_t) + sizeof(int64_t);
+
+struct BlockHeader {
+  uint32_t count;
+  uint32_t size;
+};
+
+template <typename T>
+std::string_view RawBytes(const T& value) {
+  return {reinterpret_cast<const char*>(&value), sizeof(T)};
+}
+
+template <typename T>
+bool ReadRaw(std::string_view& data, T& value) {
+  if (data.size() < sizeof(T)) return false;
+  std::memcpy(&value, data.data(), sizeof(T));
+  data.remove_prefix(sizeof(T));
+  return true;
+}
+
+double Quantize(double value) {
+  constexpr double kScale = 1.0 / CompressedTickLogger::kValueStep;
+  return std::round(value * kScale) / kScale;
+}
+
+}  // namespace
+
+CompressedTickLogger::CompressedTickLogger(const Config& config)
+    : file_path_(config.price_evolution_path),
+      backend_(config.tick_log_backend),
+      encoder_(kResolution) {
+  auto error = openFile(config.resume);
+  if (error) {
+    throw std::runtime_error(error.value());
+  }
+}
+
+CompressedTickLogger::~CompressedTickLogger() {
+  if (!file_) return;  // a failed load() left no file open
+  if (auto err = writeBlock()) {
+    std::println(stderr, "{}", err.value());
+  }
+}
+
+std::optional<std::string> CompressedTickLogger::writeTick(const Tick& tick) {
+  encoder_.encode(
+      {tick.timestamp, Quantize(tick.price), Quantize(tick.volume)});
+  if (encoder_.count() < kBlockTicks) {
+    return std::nullopt;
+  }
+  return writeBlock();
+}
+
+std::optional<std::string> CompressedTickLogger::writeBlock() {
+  if (encoder_.count() == 0) {
+    return std::nullopt;
+  }
+
+  const auto& bytes = encoder_.bytes();
+  const BlockHeader header{static_cast<uint32_t>(encoder_.count()),
+                           static_cast<uint32_t>(bytes.size())};
+  auto err = file_->write(RawBytes(header));
+  if (!err) {
+    err = file_->write(bytes);
+  }
+  file_size_ += sizeof(BlockHeader) + bytes.size();
+  encoder_.clear();
+
+  if (err) {
+    return std::format("CompressedTickLogger: {}", err.value());
+  }
+  return std::nullopt;
+}
+
+std::optional<std::string> CompressedTickLogger::openFile(bool append) {
+  std::error_code ec;
+  fs::create_directories(file_path_.parent_path(), ec);
+
+  if (ec) {
+    return std::format(
+        "CompressedTickLogger: error on folder creation for path: {}",
+        file_path_.string());
+  }
+
+  if (append) {
+    file_size_ = fs::file_size(file_path_, ec);
+    if (ec) {
+      return std::format("CompressedTickLogger: cannot resume missing file: {}",
+                         file_path_.string());
+    }
+  }
+
+  auto sink = OpenFileSink(backend_, file_path_, append);
+  if (!sink) {
+    return std::format("CompressedTickLogger: {}", sink.error());
+  }
+  file_ = std::move(sink.value());
+
+  if (append) {
+    return std::nullopt;
+  }
+
+  std::string header(kTickMagic);
+  header.append(RawBytes(kTickVersion));
+  header.append(RawBytes(static_cast<int64_t>(kResolution.count())));
+  file_size_ = kHeaderSize;
+
+  if (auto err = file_->write(header)) {
+    return std::format("CompressedTickLogger: {}", err.value());
+  }
+
+  return std::nullopt;
+}
+
+void CompressedTickLogger::save(SnapshotWriter& writer) const {
+  if (auto err = file_->flush()) {
+    std::println(stderr, "CompressedTickLogger: {}", err.value());
+  }
+  writer.write(file_size_);
+  encoder_.save(writer);
+}
+
+std::optional<std::string> CompressedTickLogger::load(SnapshotReader& reader) {
+  uint64_t size = 0;
+  if (!reader.read(size) || !encoder_.load(reader)) {
+    return std::format("CompressedTickLogger: corrupted snapshot");
+  }
+
+  file_.reset();
+  std::error_code ec;
+  if (fs::file_size(file_path_, ec) < size || ec) {
+    return std::format("CompressedTickLogger: {} is shorter than the snapshot",
+                       file_path_.string());
+  }
+  fs::resize_file(file_path_, size, ec);
+  if (ec) {
+    return std::format("CompressedTickLogger: cannot truncate {}: {}",
+                       file_path_.string(), ec.message());
+  }
+
+  auto sink = OpenFileSink(backend_, file_path_, true);
+  if (!sink) {
+    return std::format("CompressedTickLogger: {}", sink.error());
+  }
+  file_ = std::move(sink.value());
+  file_size_ = size;
+  return std::nullopt;
+}
+
+bool IsCompressedTickData(std::string_view data) {
+  return data.starts_with(kTickMagic);
+}
+
+std::expected<std::vector<Tick>, std::string> DecodeCompressedTicks(
+    std::string_view data, size_t threads) {
+  uint32_t version = 0;
+  int64_t resolution = 0;
+  if (!IsCompressedTickData(data)) {
+    return std::unexpected("CompressedTickLogger: missing file header");
+  }
+  data.remove_prefix(kTickMagic.size());
+  if (!ReadRaw(data, version) || !ReadRaw(data, resolution)) {
+    return std::unexpected("CompressedTickLogger: truncated file header");
+  }
+  if (version != kTickVersion) {
+    return std::unexpected(std::format(
+        "CompressedTickLogger: unsupported version {}", version));
+  }
+
+  // Block payloads and the index of their first tick
+  struct Block {
+    std::string_view bytes;
+    size_t first;
+    size_t count;
+  };
+  std::vector<Block> blocks;
+  size_t total = 0;
+  while (!data.empty()) {
+    BlockHeader header{};
+    if (!ReadRaw(data, header) || data.size() < header.size) {
+      return std::unexpected("CompressedTickLogger: truncated block");
+    }
+    // Every tick takes at least a byte, so a corrupt count cannot make the
+    // tick vector outgrow the file
+    if (header.count > CompressedTickLogger::kBlockTicks ||
+        header.count > header.size) {
+      return std::unexpected(std::format(
+          "CompressedTickLogger: corrupted block {}", blocks.size()));
+    }
+    blocks.push_back({data.substr(0, header.size), total, header.count});
+    data.remove_prefix(header.size);
+    total += header.count;
+  }
+
+  std::vector<Tick> ticks(total);
+  std::vector<char> corrupted(blocks.size(), 0);
+  const auto ranges = SplitRange(blocks.size(), ThreadCount(threads));
+  ForEachRange(ranges, [&](size_t r) {
+    for (size_t b = ranges[r].first; b < ranges[r].second; ++b) {
+      TickDecoder decoder(blocks[b].bytes,
+                          std::chrono::nanoseconds(resolution));
+      for (size_t i = 0; i < blocks[b].count; ++i) {
+        if (!decoder.decode(ticks[blocks[b].first + i])) {
+          corrupted[b] = 1;
+          break;
+        }
+      }
+    }
+  });
+
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    if (corrupted[b]) {
+      return std::unexpected(
+          std::format("CompressedTickLogger: corrupted block {}", b));
+    }
+  }
+  return ticks;
+}
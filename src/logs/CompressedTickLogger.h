@@ -0,0 +1,63 @@
+#ifndef TRADINGSIMULATOR_COMPRESSEDTICKLOGGER_H
+#define TRADINGSIMULATOR_COMPRESSEDTICKLOGGER_H
+
+#include <chrono>
+#include <expected>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "FileSink.h"
+#include "TickCodec.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+#include "config/Config.h"
+
+namespace fs = std::filesystem;
+
+// Binary price log ([Simulation] tick_log_format = compressed): a header
+// followed by blocks of up to kBlockTicks ticks, each one an independent
+// TickEncoder stream behind its tick count and byte size. Ticks are kept at
+// the resolution of the CSV log: whole milliseconds, and price and volume
+// rounded to kValueStep, which is finer than its three decimals.
+class CompressedTickLogger {
+ public:
+  static constexpr uint64_t kBlockTicks = 4096;
+  static constexpr std::chrono::nanoseconds kResolution = 1ms;
+  static constexpr double kValueStep = 1.0 / 4096;
+
+  explicit CompressedTickLogger(const Config& config);
+  ~CompressedTickLogger();
+
+  CompressedTickLogger(const CompressedTickLogger&) = delete;
+  CompressedTickLogger& operator=(const CompressedTickLogger&) = delete;
+
+  std::optional<std::string> writeTick(const Tick& tick);
+
+  // Stores the length of the complete blocks and the open block itself:
+  // restoring truncates the file to those blocks and continues the open one.
+  void save(SnapshotWriter& writer) const;
+  std::optional<std::string> load(SnapshotReader& reader);
+
+ private:
+  std::optional<std::string> openFile(bool append);
+  std::optional<std::string> writeBlock();
+
+  fs::path file_path_;
+  FileSinkBackend backend_;
+  std::optional<FileSink> file_;
+  uint64_t file_size_ = 0;  // header and complete blocks
+  TickEncoder encoder_;
+};
+
+// True if `data` starts with a CompressedTickLogger header.
+bool IsCompressedTickData(std::string_view data);
+
+// Decodes a whole CompressedTickLogger file. Blocks are independent, so
+// they are decoded on `threads` threads (0 - all hardware threads).
+std::expected<std::vector<Tick>, std::string> DecodeCompressedTicks(
+    std::string_view data, size_t threads = 0);
+
+#endif  // TRADINGSIMULATOR_COMPRESSEDTICKLOGGER_H
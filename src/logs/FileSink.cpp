@@ -0,0 +1,54 @@
+#include "FileSink.h"
+
+#include <format>
+
+namespace {
+
+template <typename Sink>
+std::expected<FileSink, std::string> Wrap(
+    std::expected<std::unique_ptr<Sink>, std::string> sink) {
+  if (!sink) return std::unexpected(sink.error());
+  return FileSink(std::move(sink.value()));
+}
+
+}  // namespace
+
+std::expected<FileSink, std::string> OpenFileSink(
+    FileSinkBackend backend, const std::filesystem::path& path, bool append) {
+  switch (backend) {
+    case FileSinkBackend::Stream:
+      return Wrap(StreamFileSink::Open(path, append));
+    case FileSinkBackend::Pwrite:
+      return Wrap(PwriteFileSink::Open(path, append));
+    case FileSinkBackend::Mmap:
+      return Wrap(MmapFileSink::Open(path, append));
+    case FileSinkBackend::IoUring:
+      return Wrap(IoUringFileSink::Open(path, append));
+  }
+  return std::unexpected("FileSink: unknown backend");
+}
+
+std::expected<std::unique_ptr<StreamFileSink>, std::string>
+StreamFileSink::Open(const std::filesystem::path& path, bool append) {
+  auto sink = std::make_unique<StreamFileSink>();
+  sink->file_.open(path, std::ios::binary |
+                             (append ? std::ios::app : std::ios::trunc));
+  if (!sink->file_) {
+    return std::unexpected(
+        std::format("error on file open for path: {}", path.string()));
+  }
+  return sink;
+}
+
+std::optional<std::string> StreamFileSink::write(std::string_view data) {
+  file_.write(data.data(), static_cast<std::streamsize>(data.size()));
+  return flush();
+}
+
+std::optional<std::string> StreamFileSink::flush() {
+  file_.flush();
+  if (file_.fail()) {
+    return std::format("file write error");
+  }
+  return std::nullopt;
+}
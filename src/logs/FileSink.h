@@ -0,0 +1,64 @@
+#ifndef TRADINGSIMULATOR_FILESINK_H
+#define TRADINGSIMULATOR_FILESINK_H
+
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include "PosixFileSinks.h"
+#include "config/Config.h"
+
+// std::ofstream flushed after every write
+class StreamFileSink {
+ public:
+  static std::expected<std::unique_ptr<StreamFileSink>, std::string> Open(
+      const std::filesystem::path& path, bool append);
+
+  std::optional<std::string> write(std::string_view data);
+  std::optional<std::string> flush();
+
+ private:
+  std::ofstream file_;
+};
+
+// Append-only output file behind TickLogger, OrderLogger and
+// CompressedTickLogger. The backend is chosen per log at run time and held
+// in a variant, so a write dispatches on its index next to formatting and
+// I/O. The backends own threads and mappings and are not movable, hence
+// the pointers.
+//
+// Only Stream makes every write visible in the file at once. The other
+// backends buffer and show the data after flush() or destruction; errors
+// of a buffered write are reported by a later call.
+class FileSink {
+ public:
+  using Backend = std::variant<
+      std::unique_ptr<StreamFileSink>, std::unique_ptr<PwriteFileSink>,
+      std::unique_ptr<MmapFileSink>, std::unique_ptr<IoUringFileSink>>;
+
+  explicit FileSink(Backend backend) : backend_(std::move(backend)) {}
+
+  std::optional<std::string> write(std::string_view data) {
+    return std::visit([data](auto& sink) { return sink->write(data); },
+                      backend_);
+  }
+  // A handle to the open file: const loggers (save()) may still flush it
+  std::optional<std::string> flush() const {
+    return std::visit([](const auto& sink) { return sink->flush(); },
+                      backend_);
+  }
+
+ private:
+  Backend backend_;
+};
+
+// Opens `path` for `backend`, truncating it unless `append` is set.
+std::expected<FileSink, std::string> OpenFileSink(
+    FileSinkBackend backend, const std::filesystem::path& path, bool append);
+
+#endif  // TRADINGSIMULATOR_FILESINK_H
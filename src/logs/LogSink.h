@@ -0,0 +1,40 @@
+#ifndef TRADINGSIMULATOR_LOGSINK_H
+#define TRADINGSIMULATOR_LOGSINK_H
+
+#include <concepts>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "LogSyncer.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+#include "config/Config.h"
+
+// Loggers are compile-time policies of Simulator and OrderManager, so a run
+// without output instantiates the loop with no I/O calls at all.
+template <typename T>
+concept TickSink =
+    std::constructible_from<T, const Config&> &&
+    requires(T sink, const T& const_sink, const Tick& tick,
+             SnapshotWriter& writer, SnapshotReader& reader) {
+      { sink.writeTick(tick) } -> std::same_as<std::optional<std::string>>;
+      const_sink.save(writer);
+      { sink.load(reader) } -> std::same_as<std::optional<std::string>>;
+    };
+
+template <typename T>
+concept OrderSink =
+    std::constructible_from<T, const Config&> &&
+    requires(T sink, const T& const_sink, OrderSide side, Price price,
+             Volume volume, Status status, std::string_view error_text,
+             SnapshotWriter& writer, SnapshotReader& reader) {
+      {
+        sink.writeOrder(side, price, volume, status, error_text, price)
+      } -> std::same_as<std::optional<std::string>>;
+      const_sink.save(writer);
+      { sink.load(reader) } -> std::same_as<std::optional<std::string>>;
+      { const_sink.getSyncStats() } -> std::same_as<LogSyncStats>;
+    };
+
+#endif  // TRADINGSIMULATOR_LOGSINK_H
@@ -0,0 +1,166 @@
+#include "LogSyncer.h"
+
+#ifdef __linux__
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <format>
+
+std::expected<std::unique_ptr<LogSyncer>, std::string> LogSyncer::Open(
+    const std::filesystem::path& path, FileSink sink,
+    std::chrono::nanoseconds commit_interval) {
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return std::unexpected(
+        std::format("error on file open for path: {}", path.string()));
+  }
+  return std::unique_ptr<LogSyncer>(
+      new LogSyncer(fd, std::move(sink), commit_interval));
+}
+
+LogSyncer::LogSyncer(int fd, FileSink sink,
+                     std::chrono::nanoseconds commit_interval)
+    : fd_(fd), commit_interval_(commit_interval), sink_(std::move(sink)) {
+  thread_ = std::jthread([this](std::stop_token stop) { syncLoop(stop); });
+}
+
+LogSyncer::~LogSyncer() {
+  commit();
+  thread_.request_stop();
+  thread_.join();
+  ::close(fd_);
+}
+
+std::optional<std::string> LogSyncer::append(std::string_view data) {
+  bool first = false;
+  std::optional<std::string> err;
+  {
+    std::lock_guard lock(mutex_);
+    first = appended_.empty();
+    if (first) appended_since_ = std::chrono::steady_clock::now();
+    appended_.append(data);
+    appended_end_ += data.size();
+    err = error_;
+  }
+  // Starts the thread's commit_interval timer
+  if (first && commit_interval_ > std::chrono::nanoseconds::zero()) {
+    changed_.notify_all();
+  }
+  return err;
+}
+
+std::optional<std::string> LogSyncer::commit() {
+  {
+    std::lock_guard lock(mutex_);
+    if (error_) return error_;
+    if (!pending_) {
+      pending_ = true;
+      pending_since_ = std::chrono::steady_clock::now();
+    }
+  }
+  changed_.notify_all();
+  return std::nullopt;
+}
+
+std::optional<std::string> LogSyncer::sync() {
+  if (auto err = commit()) return err;
+  return waitDurable(appendedEnd());
+}
+
+std::optional<std::string> LogSyncer::waitDurable(uint64_t end) {
+  std::unique_lock lock(mutex_);
+  changed_.wait(lock, [&] { return durable_end_ >= end || error_; });
+  return error_;
+}
+
+uint64_t LogSyncer::appendedEnd() const {
+  std::lock_guard lock(mutex_);
+  return appended_end_;
+}
+
+LogSyncStats LogSyncer::getStats() const {
+  std::lock_guard lock(mutex_);
+  return stats_;
+}
+
+// Keeps syncing after a stop request until no commit is left. A failed
+// write or sync is kept and reported to the caller; the thread goes on so
+// that waiters in sync() are released. Lines left uncommitted for
+// commit_interval_ are committed here, without waiting for the writer.
+void LogSyncer::syncLoop(std::stop_token stop) {
+  const bool timed = commit_interval_ > std::chrono::nanoseconds::zero();
+  std::unique_lock lock(mutex_);
+  while (true) {
+    if (!pending_ && timed && !appended_.empty()) {
+      const auto deadline = appended_since_ + commit_interval_;
+      if (!changed_.wait_until(lock, stop, deadline,
+                               [this] { return pending_; }) &&
+          !stop.stop_requested() && !appended_.empty()) {
+        pending_ = true;
+        pending_since_ = std::chrono::steady_clock::now();
+      }
+    } else if (!pending_) {
+      changed_.wait(lock, stop, [&] {
+        return pending_ || (timed && !appended_.empty());
+      });
+    }
+    if (!pending_) {
+      if (stop.stop_requested()) return;
+      continue;
+    }
+
+    pending_ = false;
+    const auto committed = pending_since_;
+    const uint64_t end = appended_end_;
+    std::swap(appended_, writing_);
+    lock.unlock();
+    auto err = sink_.write(writing_);
+    if (!err) err = sink_.flush();
+    writing_.clear();
+    const auto started = std::chrono::steady_clock::now();
+    if (!err && ::fdatasync(fd_) != 0) {
+      err = std::format("fdatasync failed: {}", std::strerror(errno));
+    }
+    const auto finished = std::chrono::steady_clock::now();
+    lock.lock();
+    if (err && !error_) error_ = std::move(err);
+    durable_end_ = end;
+    record(committed, started, finished);
+    changed_.notify_all();
+  }
+}
+
+void LogSyncer::record(std::chrono::steady_clock::time_point committed,
+                       std::chrono::steady_clock::time_point started,
+                       std::chrono::steady_clock::time_point finished) {
+  ++stats_.syncs;
+  stats_.sync_time += finished - started;
+  stats_.max_latency = std::max<std::chrono::nanoseconds>(
+      stats_.max_latency, finished - committed);
+}
+
+#else
+
+std::expected<std::unique_ptr<LogSyncer>, std::string> LogSyncer::Open(
+    const std::filesystem::path&, FileSink, std::chrono::nanoseconds) {
+  return std::unexpected("log durability is only available on Linux");
+}
+
+LogSyncer::~LogSyncer() = default;
+
+std::optional<std::string> LogSyncer::append(std::string_view) {
+  return std::nullopt;
+}
+std::optional<std::string> LogSyncer::commit() { return std::nullopt; }
+std::optional<std::string> LogSyncer::sync() { return std::nullopt; }
+std::optional<std::string> LogSyncer::waitDurable(uint64_t) {
+  return std::nullopt;
+}
+uint64_t LogSyncer::appendedEnd() const { return 0; }
+LogSyncStats LogSyncer::getStats() const { return {}; }
+
+#endif
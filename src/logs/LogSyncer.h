@@ -0,0 +1,84 @@
+#ifndef TRADINGSIMULATOR_LOGSYNCER_H
+#define TRADINGSIMULATOR_LOGSYNCER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "FileSink.h"
+
+// Cost of making a log durable, reported in the run summary.
+struct LogSyncStats {
+  uint64_t syncs = 0;                       // fdatasync calls
+  std::chrono::nanoseconds sync_time{0};    // spent inside them
+  std::chrono::nanoseconds max_latency{0};  // longest commit -> durable
+};
+
+// Writes a log file and makes it durable with fdatasync, both on a thread
+// of its own, so the caller never waits for the disk unless it asks to.
+// The log hands its open FileSink over and append()s lines from then on;
+// the fdatasync goes through a descriptor of its own, so it works with
+// every FileSink backend.
+//
+// commit() returns at once and the thread writes and syncs everything
+// appended so far; commits arriving while a sync runs are covered together
+// by the next one (group commit). With a nonzero commit_interval the
+// thread also commits by itself once appended lines have waited that long,
+// even if the writer goes quiet. sync() commits and waits until the
+// thread has made it durable. waitDurable() lets another thread wait for
+// an earlier commit, up to the appendedEnd() read when it was made.
+// Linux-only.
+class LogSyncer {
+ public:
+  static std::expected<std::unique_ptr<LogSyncer>, std::string> Open(
+      const std::filesystem::path& path, FileSink sink,
+      std::chrono::nanoseconds commit_interval = {});
+  ~LogSyncer();  // commits what is left and waits for it
+
+  LogSyncer(const LogSyncer&) = delete;
+  LogSyncer& operator=(const LogSyncer&) = delete;
+
+  // All three return the error of a failed background write or sync, if any
+  std::optional<std::string> append(std::string_view data);
+  std::optional<std::string> commit();
+  std::optional<std::string> sync();
+  std::optional<std::string> waitDurable(uint64_t end);
+
+  [[nodiscard]] uint64_t appendedEnd() const;
+
+  [[nodiscard]] LogSyncStats getStats() const;
+
+ private:
+  LogSyncer(int fd, FileSink sink, std::chrono::nanoseconds commit_interval);
+  void syncLoop(std::stop_token stop);
+  void record(std::chrono::steady_clock::time_point committed,
+              std::chrono::steady_clock::time_point started,
+              std::chrono::steady_clock::time_point finished);
+
+  int fd_;
+  std::chrono::nanoseconds commit_interval_;  // zero: only on commit()
+  FileSink sink_;        // only used by the thread
+  std::string writing_;  // likewise
+
+  mutable std::mutex mutex_;
+  std::condition_variable_any changed_;
+  std::string appended_;       // not yet taken by the thread
+  std::chrono::steady_clock::time_point appended_since_;  // its first line
+  uint64_t appended_end_ = 0;  // bytes appended in total
+  uint64_t durable_end_ = 0;   // of which synced
+  bool pending_ = false;       // a commit not yet picked up by the thread
+  std::chrono::steady_clock::time_point pending_since_;
+  LogSyncStats stats_;
+  std::optional<std::string> error_;
+  std::jthread thread_;
+};
+
+#endif  // TRADINGSIMULATOR_LOGSYNCER_H
@@ -0,0 +1,38 @@
+#ifndef TRADINGSIMULATOR_NULLLOGGER_H
+#define TRADINGSIMULATOR_NULLLOGGER_H
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "LogSyncer.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+#include "config/Config.h"
+
+// Sinks for metrics-only runs: no files are opened and every call inlines to
+// nothing.
+class NullTickLogger {
+ public:
+  explicit NullTickLogger(const Config&) {}
+  std::optional<std::string> writeTick(const Tick&) { return std::nullopt; }
+
+  void save(SnapshotWriter&) const {}
+  std::optional<std::string> load(SnapshotReader&) { return std::nullopt; }
+};
+
+class NullOrderLogger {
+ public:
+  explicit NullOrderLogger(const Config&) {}
+  std::optional<std::string> writeOrder(OrderSide, Price, Volume, Status,
+                                        std::string_view, Price) {
+    return std::nullopt;
+  }
+
+  void save(SnapshotWriter&) const {}
+  std::optional<std::string> load(SnapshotReader&) { return std::nullopt; }
+
+  [[nodiscard]] LogSyncStats getSyncStats() const { return {}; }
+};
+
+#endif  // TRADINGSIMULATOR_NULLLOGGER_H
@@ -1,16 +1,30 @@
 #include "OrderLogger.h"
 
+#include <format>
+#include <print>
+
 OrderLogger::OrderLogger(const Config& config)
-    : file_path_(config.orders_log_path) {
-  auto error = openFile();
+    : file_path_(config.orders_log_path),
+      backend_(config.order_log_backend),
+      durability_(config.order_log_durability),
+      group_commit_orders_(config.group_commit_orders),
+      group_commit_interval_(config.group_commit_interval) {
+  auto error = openFile(config.resume);
   if (error) {
     throw std::runtime_error(error.value());
   }
 }
 
+OrderLogger::~OrderLogger() {
+  if (!syncer_) return;
+  if (auto err = syncer_->commit()) {
+    std::println(stderr, "OrderLogger: {}", err.value());
+  }
+}
+
 std::optional<std::string> OrderLogger::writeOrder(
     OrderSide order_side, Price price, Volume volume, Status status,
-    const std::string& error_text, Price total_pnl) {
+    std::string_view error_text, Price total_pnl) {
   auto order_side_string = order_side == OrderSide::Buy ? "Buy" : "Sell";
   std::string status_string;
   switch (status) {
@@ -23,19 +37,60 @@ std::optional<std::string> OrderLogger::writeOrder(
     case Status::Pending:
       status_string = "Pending";
       break;
+    case Status::Acked:
+      status_string = "Acked";
+      break;
+    case Status::PartiallyFilled:
+      status_string = "PartiallyFilled";
+      break;
+    case Status::Replaced:
+      status_string = "Replaced";
+      break;
+    case Status::Cancelled:
+      status_string = "Cancelled";
+      break;
+    case Status::Expired:
+      status_string = "Expired";
+      break;
   }
-  file_ << std::format("{},{:.3f},{:.3f},{},{},{:.3f}", order_side_string,
-                       price, volume, status_string, error_text, total_pnl)
-        << std::endl;
+  const auto line =
+      std::format("{},{:.3f},{:.3f},{},{},{:.3f}\n", order_side_string, price,
+                  volume, status_string, error_text, total_pnl);
+  file_size_ += line.size();
 
-  if (file_.fail()) {
-    return std::format("OrderLogger: file write error");
+  if (!syncer_) {
+    if (auto err = file_->write(line)) {
+      return std::format("OrderLogger: {}", err.value());
+    }
+    return std::nullopt;
+  }
+  if (auto err = syncer_->append(line)) {
+    return std::format("OrderLogger: {}", err.value());
   }
+  ++uncommitted_orders_;
+  if (durability_ == LogDurability::Group &&
+      uncommitted_orders_ < group_commit_orders_) {
+    return std::nullopt;
+  }
+  return commit();
+}
+
+std::optional<std::string> OrderLogger::commit() {
+  uncommitted_orders_ = 0;
 
+  auto err = durability_ == LogDurability::Fsync ? syncer_->sync()
+                                                 : syncer_->commit();
+  if (err) {
+    return std::format("OrderLogger: {}", err.value());
+  }
   return std::nullopt;
 }
 
-std::optional<std::string> OrderLogger::openFile() {
+LogSyncStats OrderLogger::getSyncStats() const {
+  return syncer_ ? syncer_->getStats() : LogSyncStats{};
+}
+
+std::optional<std::string> OrderLogger::openFile(bool append) {
   std::error_code ec;
   fs::create_directories(file_path_.parent_path(), ec);
 
@@ -44,19 +99,95 @@ std::optional<std::string> OrderLogger::openFile() {
                        file_path_.string());
   }
 
-  file_.open(file_path_);
+  if (append) {
+    file_size_ = fs::file_size(file_path_, ec);
+    if (ec) {
+      return std::format("OrderLogger: cannot resume missing file: {}",
+                         file_path_.string());
+    }
+  }
 
-  if (!file_) {
-    return std::format("OrderLogger: error on file open for path: {}",
-                       file_path_.string());
+  auto sink = OpenFileSink(backend_, file_path_, append);
+  if (!sink) {
+    return std::format("OrderLogger: {}", sink.error());
+  }
+  file_ = std::move(sink.value());
+
+  if (append) {
+    return std::nullopt;
   }
 
-  file_ << std::format("{},{},{},{},{},{}\n", "Side", "Price", "Volume",
-                       "ReplyStatus", "ErrorText", "PnL");
+  const auto header = std::format("{},{},{},{},{},{}\n", "Side", "Price",
+                                  "Volume", "ReplyStatus", "ErrorText", "PnL");
+  file_size_ = header.size();
 
-  if (file_.fail()) {
-    return std::format("OrderLogger: file write error");
+  if (auto err = file_->write(header)) {
+    return std::format("OrderLogger: {}", err.value());
   }
 
+  return handOver();
+}
+
+// With durability the file moves to a LogSyncer, which writes it from then
+// on; file_ is left empty. In group mode the syncer also commits by itself
+// once lines have waited group_commit_interval.
+std::optional<std::string> OrderLogger::handOver() {
+  if (durability_ == LogDurability::None) {
+    return std::nullopt;
+  }
+  auto syncer = LogSyncer::Open(
+      file_path_, std::move(file_.value()),
+      durability_ == LogDurability::Group ? group_commit_interval_
+                                          : std::chrono::nanoseconds{});
+  file_.reset();
+  if (!syncer) {
+    return std::format("OrderLogger: {}", syncer.error());
+  }
+  syncer_ = std::move(syncer.value());
+  uncommitted_orders_ = 0;
   return std::nullopt;
-}
\ No newline at end of file
+}
+
+void OrderLogger::save(SnapshotWriter& writer) const {
+  if (auto err = syncer_ ? syncer_->commit() : file_->flush()) {
+    std::println(stderr, "OrderLogger: {}", err.value());
+  }
+  if (syncer_) {
+    writer.addBarrier([syncer = syncer_, end = syncer_->appendedEnd()]()
+                          -> std::optional<std::string> {
+      if (auto err = syncer->waitDurable(end)) {
+        return std::format("OrderLogger: {}", err.value());
+      }
+      return std::nullopt;
+    });
+  }
+  writer.write(file_size_);
+}
+
+std::optional<std::string> OrderLogger::load(SnapshotReader& reader) {
+  uint64_t size = 0;
+  if (!reader.read(size)) {
+    return std::format("OrderLogger: corrupted snapshot");
+  }
+
+  syncer_.reset();
+  file_.reset();
+  std::error_code ec;
+  if (fs::file_size(file_path_, ec) < size || ec) {
+    return std::format("OrderLogger: {} is shorter than the snapshot",
+                       file_path_.string());
+  }
+  fs::resize_file(file_path_, size, ec);
+  if (ec) {
+    return std::format("OrderLogger: cannot truncate {}: {}",
+                       file_path_.string(), ec.message());
+  }
+
+  auto sink = OpenFileSink(backend_, file_path_, true);
+  if (!sink) {
+    return std::format("OrderLogger: {}", sink.error());
+  }
+  file_ = std::move(sink.value());
+  file_size_ = size;
+  return handOver();
+}
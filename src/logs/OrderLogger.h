@@ -1,29 +1,68 @@
 #ifndef TRADINGSIMULATOR_ORDERLOGGER_H
 #define TRADINGSIMULATOR_ORDERLOGGER_H
 
+#include <chrono>
 #include <filesystem>
-#include <fstream>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 
+#include "FileSink.h"
+#include "LogSyncer.h"
+#include "common/Snapshot.h"
 #include "common/Types.h"
 #include "config/Config.h"
 
 namespace fs = std::filesystem;
 
+// With [Simulation] order_log_durability other than none, the file is
+// handed to a LogSyncer, which writes and fdatasyncs it on its own thread.
+// writeOrder() only queues the line and commits every group_commit_orders
+// orders; the syncer commits lines that have waited group_commit_interval
+// of wall time by itself, even if no further order arrives. In fsync mode it commits every order and waits until the
+// syncer has made it durable, so the caller still blocks for the disk. The
+// rest of the log is committed on destruction.
 class OrderLogger {
  public:
   explicit OrderLogger(const Config& config);
+  ~OrderLogger();
+
+  OrderLogger(const OrderLogger&) = delete;
+  OrderLogger& operator=(const OrderLogger&) = delete;
+
   std::optional<std::string> writeOrder(OrderSide order_side, Price price,
                                         Volume volume, Status status,
-                                        const std::string& error_text,
+                                        std::string_view error_text,
                                         Price total_pnl);
 
+  // Only the file length is stored: restoring truncates the log back to the
+  // checkpoint so lines written after it are not duplicated on resume.
+  // Without durability buffered lines are handed to the kernel first, so
+  // the file holds what is counted. With it, the lines are only committed
+  // and the snapshot gets a barrier that waits, on Checkpointer's thread,
+  // until the syncer has made them durable.
+  void save(SnapshotWriter& writer) const;
+  std::optional<std::string> load(SnapshotReader& reader);
+
+  [[nodiscard]] LogSyncStats getSyncStats() const;
+
  private:
-  std::optional<std::string> openFile();
+  std::optional<std::string> openFile(bool append);
+  std::optional<std::string> handOver();
+  std::optional<std::string> commit();
 
   fs::path file_path_;
-  std::ofstream file_;
+  FileSinkBackend backend_;
+  std::optional<FileSink> file_;  // empty once handed to syncer_
+  uint64_t file_size_ = 0;
+
+  LogDurability durability_;
+  uint64_t group_commit_orders_;
+  std::chrono::nanoseconds group_commit_interval_;
+  // Null without durability; shared with pending snapshot barriers
+  std::shared_ptr<LogSyncer> syncer_;
+  uint64_t uncommitted_orders_ = 0;
 };
 
 #endif  // TRADINGSIMULATOR_ORDERLOGGER_H
@@ -0,0 +1,434 @@
+#include "PosixFileSinks.h"
+
+#ifdef __linux__
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <format>
+
+namespace {
+
+std::string ErrnoText(std::string_view what) {
+  return std::format("{}: {}", what, std::strerror(errno));
+}
+
+// Opens the file and returns its descriptor with the offset to append at.
+std::expected<std::pair<int, uint64_t>, std::string> OpenFile(
+    const std::filesystem::path& path, bool append) {
+  const int fd = ::open(path.c_str(),
+                        O_WRONLY | O_CREAT | O_CLOEXEC | (append ? 0 : O_TRUNC),
+                        0644);
+  if (fd < 0) {
+    return std::unexpected(
+        std::format("error on file open for path: {}", path.string()));
+  }
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    return std::unexpected(ErrnoText("fstat failed"));
+  }
+  return std::pair{fd, static_cast<uint64_t>(st.st_size)};
+}
+
+std::optional<std::string> WriteAll(int fd, const char* data, size_t size,
+                                    uint64_t offset) {
+  while (size > 0) {
+    const ssize_t written =
+        ::pwrite(fd, data, size, static_cast<off_t>(offset));
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      return ErrnoText("pwrite failed");
+    }
+    data += written;
+    size -= static_cast<size_t>(written);
+    offset += static_cast<uint64_t>(written);
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+// ============================================================================
+// PwriteFileSink
+// ============================================================================
+
+std::expected<std::unique_ptr<PwriteFileSink>, std::string>
+PwriteFileSink::Open(const std::filesystem::path& path, bool append) {
+  auto file = OpenFile(path, append);
+  if (!file) return std::unexpected(file.error());
+  return std::unique_ptr<PwriteFileSink>(
+      new PwriteFileSink(file->first, file->second));
+}
+
+PwriteFileSink::PwriteFileSink(int fd, uint64_t offset)
+    : fd_(fd), offset_(offset) {
+  active_.reserve(kBufferSize);
+  in_flight_.reserve(kBufferSize);
+  writer_ = std::jthread([this](std::stop_token stop) { writerLoop(stop); });
+}
+
+PwriteFileSink::~PwriteFileSink() {
+  flush();
+  writer_.request_stop();
+  writer_.join();
+  ::close(fd_);
+}
+
+std::optional<std::string> PwriteFileSink::write(std::string_view data) {
+  while (!data.empty()) {
+    const size_t n = std::min(data.size(), kBufferSize - active_.size());
+    active_.append(data.substr(0, n));
+    data.remove_prefix(n);
+    if (active_.size() == kBufferSize) {
+      if (auto err = submit()) return err;
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<std::string> PwriteFileSink::flush() {
+  if (auto err = submit()) return err;
+  std::unique_lock lock(mutex_);
+  changed_.wait(lock, [this] { return !busy_; });
+  return error_;
+}
+
+// Hands active_ to the writer once it is done with the previous buffer.
+std::optional<std::string> PwriteFileSink::submit() {
+  if (active_.empty()) return std::nullopt;
+  {
+    std::unique_lock lock(mutex_);
+    changed_.wait(lock, [this] { return !busy_; });
+    if (error_) return error_;
+    std::swap(active_, in_flight_);
+    in_flight_offset_ = offset_;
+    offset_ += in_flight_.size();
+    busy_ = true;
+  }
+  changed_.notify_all();
+  active_.clear();
+  return std::nullopt;
+}
+
+void PwriteFileSink::writerLoop(std::stop_token stop) {
+  std::unique_lock lock(mutex_);
+  while (changed_.wait(lock, stop, [this] { return busy_; })) {
+    lock.unlock();
+    auto err = WriteAll(fd_, in_flight_.data(), in_flight_.size(),
+                        in_flight_offset_);
+    lock.lock();
+    if (err && !error_) error_ = std::move(err);
+    busy_ = false;
+    changed_.notify_all();
+  }
+}
+
+// ============================================================================
+// MmapFileSink
+// ============================================================================
+
+std::expected<std::unique_ptr<MmapFileSink>, std::string> MmapFileSink::Open(
+    const std::filesystem::path& path, bool append) {
+  // The mapping needs read access to the file as well
+  const int fd = ::open(path.c_str(),
+                        O_RDWR | O_CREAT | O_CLOEXEC | (append ? 0 : O_TRUNC),
+                        0644);
+  if (fd < 0) {
+    return std::unexpected(
+        std::format("error on file open for path: {}", path.string()));
+  }
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    return std::unexpected(ErrnoText("fstat failed"));
+  }
+
+  std::unique_ptr<MmapFileSink> sink(
+      new MmapFileSink(fd, static_cast<uint64_t>(st.st_size)));
+  if (auto err = sink->reserve(sink->size_ + kInitialCapacity)) {
+    return std::unexpected(err.value());
+  }
+  return sink;
+}
+
+MmapFileSink::MmapFileSink(int fd, uint64_t size) : fd_(fd), size_(size) {}
+
+MmapFileSink::~MmapFileSink() {
+  if (map_ != nullptr) {
+    ::munmap(map_, capacity_);
+  }
+  // Drop the preallocated tail
+  [[maybe_unused]] const int result =
+      ::ftruncate(fd_, static_cast<off_t>(size_));
+  ::close(fd_);
+}
+
+std::optional<std::string> MmapFileSink::write(std::string_view data) {
+  if (size_ + data.size() > capacity_) {
+    if (auto err = reserve(std::max(capacity_ * 2, size_ + data.size()))) {
+      return err;
+    }
+  }
+  std::memcpy(map_ + size_, data.data(), data.size());
+  size_ += data.size();
+  return std::nullopt;
+}
+
+// Dirty pages of a shared mapping are already in the page cache, which is
+// what readers of the file see; only the preallocated tail differs.
+std::optional<std::string> MmapFileSink::flush() { return std::nullopt; }
+
+std::optional<std::string> MmapFileSink::reserve(uint64_t capacity) {
+  const auto page = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+  capacity = (capacity + page - 1) / page * page;
+  if (::ftruncate(fd_, static_cast<off_t>(capacity)) != 0) {
+    return ErrnoText("ftruncate failed");
+  }
+
+  void* map = map_ == nullptr
+                  ? ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE,
+                           MAP_SHARED, fd_, 0)
+                  : ::mremap(map_, capacity_, capacity, MREMAP_MAYMOVE);
+  if (map == MAP_FAILED) {
+    return ErrnoText("mmap failed");
+  }
+  map_ = static_cast<char*>(map);
+  capacity_ = capacity;
+  return std::nullopt;
+}
+
+// ============================================================================
+// IoUringFileSink
+// ============================================================================
+
+// Submission and completion rings shared with the kernel
+struct IoUringFileSink::Ring {
+  int fd = -1;
+  void* sq_map = MAP_FAILED;
+  size_t sq_map_size = 0;
+  void* cq_map = MAP_FAILED;
+  size_t cq_map_size = 0;
+  io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+  size_t sqes_size = 0;
+
+  unsigned* sq_tail = nullptr;
+  unsigned* sq_mask = nullptr;
+  unsigned* sq_array = nullptr;
+  unsigned* cq_head = nullptr;
+  unsigned* cq_tail = nullptr;
+  unsigned* cq_mask = nullptr;
+  io_uring_cqe* cqes = nullptr;
+
+  ~Ring() {
+    if (sqes != MAP_FAILED) ::munmap(sqes, sqes_size);
+    if (cq_map != MAP_FAILED && cq_map != sq_map) ::munmap(cq_map, cq_map_size);
+    if (sq_map != MAP_FAILED) ::munmap(sq_map, sq_map_size);
+    if (fd >= 0) ::close(fd);
+  }
+
+  std::optional<std::string> setup(unsigned entries) {
+    io_uring_params params{};
+    fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) return ErrnoText("io_uring_setup failed");
+
+    sq_map_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_map_size =
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+      sq_map_size = cq_map_size = std::max(sq_map_size, cq_map_size);
+    }
+
+    sq_map = ::mmap(nullptr, sq_map_size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (sq_map == MAP_FAILED) return ErrnoText("io_uring mmap failed");
+    cq_map = (params.features & IORING_FEAT_SINGLE_MMAP)
+                 ? sq_map
+                 : ::mmap(nullptr, cq_map_size, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    if (cq_map == MAP_FAILED) return ErrnoText("io_uring mmap failed");
+    sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    sqes = static_cast<io_uring_sqe*>(
+        ::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+    if (sqes == MAP_FAILED) return ErrnoText("io_uring mmap failed");
+
+    auto* sq = static_cast<char*>(sq_map);
+    auto* cq = static_cast<char*>(cq_map);
+    sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    return std::nullopt;
+  }
+
+  // Waits for at least `min_complete` completions (0 - only submits).
+  std::optional<std::string> enter(unsigned to_submit, unsigned min_complete) {
+    const unsigned flags = min_complete > 0 ? IORING_ENTER_GETEVENTS : 0;
+    while (::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags,
+                     nullptr, 0) < 0) {
+      if (errno != EINTR) return ErrnoText("io_uring_enter failed");
+      to_submit = 0;
+    }
+    return std::nullopt;
+  }
+};
+
+std::expected<std::unique_ptr<IoUringFileSink>, std::string>
+IoUringFileSink::Open(const std::filesystem::path& path, bool append) {
+  auto ring = std::make_unique<Ring>();
+  if (auto err = ring->setup(kBuffers)) {
+    return std::unexpected(err.value());
+  }
+  auto file = OpenFile(path, append);
+  if (!file) return std::unexpected(file.error());
+  return std::unique_ptr<IoUringFileSink>(
+      new IoUringFileSink(file->first, file->second, std::move(ring)));
+}
+
+IoUringFileSink::IoUringFileSink(int fd, uint64_t offset,
+                                 std::unique_ptr<Ring> ring)
+    : fd_(fd), offset_(offset), ring_(std::move(ring)), buffers_(kBuffers) {
+  for (auto& buffer : buffers_) {
+    buffer.data = std::make_unique<char[]>(kBufferSize);
+  }
+}
+
+IoUringFileSink::~IoUringFileSink() {
+  flush();
+  ::close(fd_);
+}
+
+std::optional<std::string> IoUringFileSink::write(std::string_view data) {
+  while (!data.empty()) {
+    Buffer& buffer = buffers_[current_];
+    const size_t n = std::min(data.size(), kBufferSize - buffer.size);
+    std::memcpy(buffer.data.get() + buffer.size, data.data(), n);
+    buffer.size += n;
+    data.remove_prefix(n);
+    if (buffer.size == kBufferSize) {
+      if (auto err = submit()) return err;
+    }
+  }
+  return error_;
+}
+
+std::optional<std::string> IoUringFileSink::flush() {
+  if (auto err = submit()) return err;
+  while (in_flight_ > 0) {
+    if (auto err = reap(1)) return err;
+  }
+  return error_;
+}
+
+// Queues the current buffer and moves on to the next one, waiting for it
+// to complete if it is still in flight.
+std::optional<std::string> IoUringFileSink::submit() {
+  Buffer& buffer = buffers_[current_];
+  if (buffer.size == 0) return std::nullopt;
+
+  buffer.offset = offset_;
+  buffer.in_flight = true;
+  offset_ += buffer.size;
+
+  const unsigned tail = *ring_->sq_tail;
+  const unsigned slot = tail & *ring_->sq_mask;
+  io_uring_sqe& sqe = ring_->sqes[slot];
+  std::memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = IORING_OP_WRITE;
+  sqe.fd = fd_;
+  sqe.addr = reinterpret_cast<uint64_t>(buffer.data.get());
+  sqe.len = static_cast<uint32_t>(buffer.size);
+  sqe.off = buffer.offset;
+  sqe.user_data = current_;
+  ring_->sq_array[slot] = slot;
+  std::atomic_ref(*ring_->sq_tail).store(tail + 1, std::memory_order_release);
+  ++in_flight_;
+  if (auto err = ring_->enter(1, 0)) return err;
+
+  current_ = (current_ + 1) % buffers_.size();
+  while (buffers_[current_].in_flight) {
+    if (auto err = reap(1)) return err;
+  }
+  return std::nullopt;
+}
+
+std::optional<std::string> IoUringFileSink::reap(unsigned min_complete) {
+  if (auto err = ring_->enter(0, min_complete)) return err;
+
+  unsigned head = *ring_->cq_head;
+  const unsigned tail =
+      std::atomic_ref(*ring_->cq_tail).load(std::memory_order_acquire);
+  for (; head != tail; ++head) {
+    const io_uring_cqe& cqe = ring_->cqes[head & *ring_->cq_mask];
+    Buffer& buffer = buffers_[cqe.user_data];
+    if (cqe.res < 0) {
+      errno = -cqe.res;
+      if (!error_) error_ = ErrnoText("io_uring write failed");
+    } else if (static_cast<size_t>(cqe.res) < buffer.size) {
+      // Short write: finish it synchronously
+      const auto done = static_cast<size_t>(cqe.res);
+      auto err = WriteAll(fd_, buffer.data.get() + done, buffer.size - done,
+                          buffer.offset + done);
+      if (err && !error_) error_ = std::move(err);
+    }
+    buffer.size = 0;
+    buffer.in_flight = false;
+    --in_flight_;
+  }
+  std::atomic_ref(*ring_->cq_head).store(head, std::memory_order_release);
+  return std::nullopt;
+}
+
+#else
+
+std::expected<std::unique_ptr<PwriteFileSink>, std::string>
+PwriteFileSink::Open(const std::filesystem::path&, bool) {
+  return std::unexpected("the pwrite backend is only available on Linux");
+}
+
+PwriteFileSink::~PwriteFileSink() = default;
+
+std::optional<std::string> PwriteFileSink::write(std::string_view) {
+  return std::nullopt;
+}
+std::optional<std::string> PwriteFileSink::flush() { return std::nullopt; }
+
+std::expected<std::unique_ptr<MmapFileSink>, std::string> MmapFileSink::Open(
+    const std::filesystem::path&, bool) {
+  return std::unexpected("the mmap backend is only available on Linux");
+}
+
+MmapFileSink::~MmapFileSink() = default;
+
+std::optional<std::string> MmapFileSink::write(std::string_view) {
+  return std::nullopt;
+}
+std::optional<std::string> MmapFileSink::flush() { return std::nullopt; }
+
+struct IoUringFileSink::Ring {};
+
+std::expected<std::unique_ptr<IoUringFileSink>, std::string>
+IoUringFileSink::Open(const std::filesystem::path&, bool) {
+  return std::unexpected("the io_uring backend is only available on Linux");
+}
+
+IoUringFileSink::~IoUringFileSink() = default;
+
+std::optional<std::string> IoUringFileSink::write(std::string_view) {
+  return std::nullopt;
+}
+std::optional<std::string> IoUringFileSink::flush() { return std::nullopt; }
+
+#endif
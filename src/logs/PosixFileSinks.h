@@ -0,0 +1,111 @@
+#ifndef TRADINGSIMULATOR_POSIXFILESINKS_H
+#define TRADINGSIMULATOR_POSIXFILESINKS_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Linux file sink backends. Open() fails on other platforms and when the
+// kernel refuses the required facility (e.g. io_uring disabled by sysctl).
+
+// Writes fill one buffer while a background thread pwrite()s the other, so
+// the caller only blocks when both are full.
+class PwriteFileSink {
+ public:
+  static constexpr size_t kBufferSize = size_t{1} << 20;
+
+  static std::expected<std::unique_ptr<PwriteFileSink>, std::string> Open(
+      const std::filesystem::path& path, bool append);
+  ~PwriteFileSink();
+
+  std::optional<std::string> write(std::string_view data);
+  std::optional<std::string> flush();
+
+ private:
+  PwriteFileSink(int fd, uint64_t offset);
+  std::optional<std::string> submit();
+  void writerLoop(std::stop_token stop);
+
+  int fd_;
+  uint64_t offset_;  // file offset of active_
+  std::string active_;
+
+  std::mutex mutex_;
+  std::condition_variable_any changed_;
+  std::string in_flight_;  // owned by the writer while busy_
+  uint64_t in_flight_offset_ = 0;
+  bool busy_ = false;
+  std::optional<std::string> error_;
+  std::jthread writer_;
+};
+
+// Copies writes into a shared mapping of the file. The file is extended
+// (doubling) ahead of the data and trimmed to the written size on
+// destruction, so it is longer than its content while open.
+class MmapFileSink {
+ public:
+  static constexpr size_t kInitialCapacity = size_t{1} << 24;
+
+  static std::expected<std::unique_ptr<MmapFileSink>, std::string> Open(
+      const std::filesystem::path& path, bool append);
+  ~MmapFileSink();
+
+  std::optional<std::string> write(std::string_view data);
+  std::optional<std::string> flush();
+
+ private:
+  MmapFileSink(int fd, uint64_t size);
+  std::optional<std::string> reserve(uint64_t capacity);
+
+  int fd_;
+  uint64_t size_;
+  uint64_t capacity_ = 0;
+  char* map_ = nullptr;
+};
+
+// Fills fixed buffers and queues each full one as an IORING_OP_WRITE on a
+// ring set up with raw syscalls; a buffer is reused once its completion is
+// reaped, so up to kBuffers writes are in flight.
+class IoUringFileSink {
+ public:
+  static constexpr size_t kBufferSize = size_t{1} << 18;
+  static constexpr unsigned kBuffers = 8;
+
+  static std::expected<std::unique_ptr<IoUringFileSink>, std::string> Open(
+      const std::filesystem::path& path, bool append);
+  ~IoUringFileSink();
+
+  std::optional<std::string> write(std::string_view data);
+  std::optional<std::string> flush();
+
+ private:
+  struct Ring;
+  struct Buffer {
+    std::unique_ptr<char[]> data;
+    size_t size = 0;
+    uint64_t offset = 0;
+    bool in_flight = false;
+  };
+
+  IoUringFileSink(int fd, uint64_t offset, std::unique_ptr<Ring> ring);
+  std::optional<std::string> submit();
+  std::optional<std::string> reap(unsigned min_complete);
+
+  int fd_;
+  uint64_t offset_;  // file offset of the current buffer
+  std::unique_ptr<Ring> ring_;
+  std::vector<Buffer> buffers_;
+  size_t current_ = 0;
+  unsigned in_flight_ = 0;
+  std::optional<std::string> error_;
+};
+
+#endif  // TRADINGSIMULATOR_POSIXFILESINKS_H
@@ -0,0 +1,233 @@
+#include "TickCodec.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace {
+
+constexpr uint64_t LowBits(unsigned bits) {
+  return bits == 64 ? ~uint64_t{0} : (uint64_t{1} << bits) - 1;
+}
+
+uint64_t ZigZag(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^
+         static_cast<uint64_t>(value >> 63);
+}
+
+int64_t UnZigZag(uint64_t value) {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+// LEB128 groups of 7 bits, lowest first, each behind a continuation bit
+void WriteVarint(BitWriter& writer, uint64_t value) {
+  while (value >= 0x80) {
+    writer.write(0x80 | (value & 0x7F), 8);
+    value >>= 7;
+  }
+  writer.write(value, 8);
+}
+
+bool ReadVarint(BitReader& reader, uint64_t& value) {
+  value = 0;
+  for (unsigned shift = 0; shift < 64; shift += 7) {
+    uint64_t group = 0;
+    if (!reader.read(group, 8)) return false;
+    value |= (group & 0x7F) << shift;
+    if ((group & 0x80) == 0) return true;
+  }
+  return false;
+}
+
+// Leading zeros are stored in 5 bits
+constexpr unsigned kMaxLeading = 31;
+
+}  // namespace
+
+void BitWriter::write(uint64_t value, unsigned bits) {
+  while (bits > 0) {
+    const unsigned free = 8 - static_cast<unsigned>(bit_count_ % 8);
+    if (free == 8) bytes_.push_back(0);
+    const unsigned n = std::min(free, bits);
+    const uint64_t chunk = (value >> (bits - n)) & LowBits(n);
+    bytes_.back() = static_cast<char>(static_cast<uint8_t>(bytes_.back()) |
+                                      (chunk << (free - n)));
+    bits -= n;
+    bit_count_ += n;
+  }
+}
+
+void BitWriter::writeBit(bool bit) { write(bit ? 1 : 0, 1); }
+
+const std::string& BitWriter::bytes() const { return bytes_; }
+
+void BitWriter::clear() {
+  bytes_.clear();
+  bit_count_ = 0;
+}
+
+void BitWriter::save(SnapshotWriter& writer) const {
+  writer.writeString(bytes_);
+  writer.write(bit_count_);
+}
+
+bool BitWriter::load(SnapshotReader& reader) {
+  return reader.readString(bytes_) && reader.read(bit_count_) &&
+         (bit_count_ + 7) / 8 == bytes_.size();
+}
+
+BitReader::BitReader(std::string_view bytes) : bytes_(bytes) {}
+
+bool BitReader::read(uint64_t& value, unsigned bits) {
+  if (bytes_.size() * 8 - bit_offset_ < bits) return false;
+  value = 0;
+  while (bits > 0) {
+    const unsigned available = 8 - static_cast<unsigned>(bit_offset_ % 8);
+    const unsigned n = std::min(available, bits);
+    const auto byte = static_cast<uint8_t>(bytes_[bit_offset_ / 8]);
+    value = (value << n) | ((byte >> (available - n)) & LowBits(n));
+    bits -= n;
+    bit_offset_ += n;
+  }
+  return true;
+}
+
+bool BitReader::readBit(bool& bit) {
+  uint64_t value = 0;
+  if (!read(value, 1)) return false;
+  bit = value != 0;
+  return true;
+}
+
+TickEncoder::TickEncoder(std::chrono::nanoseconds resolution)
+    : resolution_(std::max<int64_t>(resolution.count(), 1)) {}
+
+void TickEncoder::encode(const Tick& tick) {
+  const int64_t time = tick.timestamp.count() / resolution_;
+  const uint64_t price = std::bit_cast<uint64_t>(tick.price);
+  const uint64_t volume = std::bit_cast<uint64_t>(tick.volume);
+
+  if (state_.count == 0) {
+    WriteVarint(writer_, ZigZag(time));
+    writer_.write(price, 64);
+    writer_.write(volume, 64);
+    state_.price.bits = price;
+    state_.volume.bits = volume;
+  } else {
+    const int64_t delta = time - state_.time;
+    WriteVarint(writer_, ZigZag(delta - state_.delta));
+    state_.delta = delta;
+    encodeValue(state_.price, tick.price);
+    encodeValue(state_.volume, tick.volume);
+  }
+  state_.time = time;
+  ++state_.count;
+}
+
+void TickEncoder::encodeValue(TickCodecState::Value& previous, double value) {
+  const uint64_t bits = std::bit_cast<uint64_t>(value);
+  const uint64_t xored = bits ^ previous.bits;
+  previous.bits = bits;
+
+  if (xored == 0) {
+    writer_.writeBit(false);
+    return;
+  }
+  writer_.writeBit(true);
+
+  const auto leading = std::min<unsigned>(std::countl_zero(xored), kMaxLeading);
+  const auto trailing = static_cast<unsigned>(std::countr_zero(xored));
+  if (previous.leading != 0xFF && leading >= previous.leading &&
+      trailing >= previous.trailing) {
+    writer_.writeBit(false);
+    writer_.write(xored >> previous.trailing,
+                  64 - previous.leading - previous.trailing);
+    return;
+  }
+
+  const unsigned meaningful = 64 - leading - trailing;
+  writer_.writeBit(true);
+  writer_.write(leading, 5);
+  writer_.write(meaningful - 1, 6);
+  writer_.write(xored >> trailing, meaningful);
+  previous.leading = static_cast<uint8_t>(leading);
+  previous.trailing = static_cast<uint8_t>(trailing);
+}
+
+uint64_t TickEncoder::count() const { return state_.count; }
+
+const std::string& TickEncoder::bytes() const { return writer_.bytes(); }
+
+void TickEncoder::clear() {
+  state_ = {};
+  writer_.clear();
+}
+
+void TickEncoder::save(SnapshotWriter& writer) const {
+  writer.write(state_);
+  writer_.save(writer);
+}
+
+bool TickEncoder::load(SnapshotReader& reader) {
+  return reader.read(state_) && writer_.load(reader);
+}
+
+TickDecoder::TickDecoder(std::string_view bytes,
+                         std::chrono::nanoseconds resolution)
+    : resolution_(std::max<int64_t>(resolution.count(), 1)), reader_(bytes) {}
+
+bool TickDecoder::decode(Tick& tick) {
+  uint64_t varint = 0;
+  if (!ReadVarint(reader_, varint)) return false;
+
+  if (state_.count == 0) {
+    state_.time = UnZigZag(varint);
+    if (!reader_.read(state_.price.bits, 64) ||
+        !reader_.read(state_.volume.bits, 64)) {
+      return false;
+    }
+    tick.price = std::bit_cast<double>(state_.price.bits);
+    tick.volume = std::bit_cast<double>(state_.volume.bits);
+  } else {
+    state_.delta += UnZigZag(varint);
+    state_.time += state_.delta;
+    if (!decodeValue(state_.price, tick.price) ||
+        !decodeValue(state_.volume, tick.volume)) {
+      return false;
+    }
+  }
+  tick.timestamp = std::chrono::nanoseconds(state_.time * resolution_);
+  ++state_.count;
+  return true;
+}
+
+bool TickDecoder::decodeValue(TickCodecState::Value& previous,
+                              double& value) {
+  bool changed = false;
+  if (!reader_.readBit(changed)) return false;
+
+  if (changed) {
+    bool new_window = false;
+    if (!reader_.readBit(new_window)) return false;
+    if (new_window) {
+      uint64_t leading = 0;
+      uint64_t meaningful = 0;
+      if (!reader_.read(leading, 5) || !reader_.read(meaningful, 6)) {
+        return false;
+      }
+      ++meaningful;
+      if (leading + meaningful > 64) return false;
+      previous.leading = static_cast<uint8_t>(leading);
+      previous.trailing = static_cast<uint8_t>(64 - leading - meaningful);
+    } else if (previous.leading == 0xFF) {
+      return false;
+    }
+
+    uint64_t xored = 0;
+    if (!reader_.read(xored, 64 - previous.leading - previous.trailing)) {
+      return false;
+    }
+    previous.bits ^= xored << previous.trailing;
+  }
+  value = std::bit_cast<double>(previous.bits);
+  return true;
+}
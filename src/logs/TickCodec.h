@@ -0,0 +1,108 @@
+#ifndef TRADINGSIMULATOR_TICKCODEC_H
+#define TRADINGSIMULATOR_TICKCODEC_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "common/Snapshot.h"
+#include "common/Types.h"
+
+// Gorilla-style tick compression. Timestamps are stored as zigzag varints
+// of their delta-of-delta in units of `resolution`, which is 0 for a steady
+// tick rate. Price and volume are XORed with the previous value and only
+// the meaningful bits of the XOR are stored, reusing the previous
+// leading/trailing zero window when it still fits.
+//
+// The first tick of a stream is stored in full, so every encoded stream
+// decodes on its own.
+
+// MSB-first bit stream over a byte buffer.
+class BitWriter {
+ public:
+  // Appends the low `bits` bits of `value`.
+  void write(uint64_t value, unsigned bits);
+  void writeBit(bool bit);
+
+  [[nodiscard]] const std::string& bytes() const;
+  void clear();
+
+  void save(SnapshotWriter& writer) const;
+  bool load(SnapshotReader& reader);
+
+ private:
+  std::string bytes_;
+  uint64_t bit_count_ = 0;
+};
+
+class BitReader {
+ public:
+  explicit BitReader(std::string_view bytes);
+
+  // False once the stream is exhausted; `value` is then unspecified.
+  bool read(uint64_t& value, unsigned bits);
+  bool readBit(bool& bit);
+
+ private:
+  std::string_view bytes_;
+  uint64_t bit_offset_ = 0;
+};
+
+// Everything the encoder and decoder carry from one tick to the next.
+struct TickCodecState {
+  struct Value {
+    uint64_t bits = 0;
+    uint8_t leading = 0xFF;  // 0xFF - no window yet
+    uint8_t trailing = 0;
+  };
+
+  uint64_t count = 0;
+  int64_t time = 0;  // in units of resolution
+  int64_t delta = 0;
+  Value price;
+  Value volume;
+};
+
+class TickEncoder {
+ public:
+  explicit TickEncoder(std::chrono::nanoseconds resolution);
+
+  // Timestamps are truncated to the resolution; price and volume are kept
+  // as given.
+  void encode(const Tick& tick);
+
+  [[nodiscard]] uint64_t count() const;
+  [[nodiscard]] const std::string& bytes() const;
+
+  // Starts a new, independently decodable stream.
+  void clear();
+
+  // The encoded bytes are stored too, so a stream can be continued.
+  void save(SnapshotWriter& writer) const;
+  bool load(SnapshotReader& reader);
+
+ private:
+  void encodeValue(TickCodecState::Value& previous, double value);
+
+  int64_t resolution_;
+  TickCodecState state_;
+  BitWriter writer_;
+};
+
+class TickDecoder {
+ public:
+  TickDecoder(std::string_view bytes, std::chrono::nanoseconds resolution);
+
+  // False at the end of the stream or on corrupted input.
+  bool decode(Tick& tick);
+
+ private:
+  bool decodeValue(TickCodecState::Value& previous, double& value);
+
+  int64_t resolution_;
+  TickCodecState state_;
+  BitReader reader_;
+};
+
+#endif  // TRADINGSIMULATOR_TICKCODEC_H
@@ -1,11 +1,12 @@
 #include "TickLogger.h"
 
-#include <fstream>
-#include <iostream>
+#include <format>
+#include <print>
 
 TickLogger::TickLogger(const Config& config)
-    : file_path_(config.price_evolution_path) {
-  auto error = openFile();
+    : file_path_(config.price_evolution_path),
+      backend_(config.tick_log_backend) {
+  auto error = openFile(config.resume);
   if (error) {
     throw std::runtime_error(error.value());
   }
@@ -15,17 +16,17 @@ std::optional<std::string> TickLogger::writeTick(const Tick& tick) {
   auto timestamp_ms =
       std::chrono::duration_cast<std::chrono::milliseconds>(tick.timestamp);
 
-  file_ << std::format("{:%T},{:.3f},{:.3f}", timestamp_ms, tick.price,
-                       tick.volume)
-        << std::endl;
+  const auto line = std::format("{:%T},{:.3f},{:.3f}\n", timestamp_ms,
+                                tick.price, tick.volume);
+  file_size_ += line.size();
 
-  if (file_.fail()) {
-    return std::format("TickLogger: file write error");
+  if (auto err = file_->write(line)) {
+    return std::format("TickLogger: {}", err.value());
   }
   return std::nullopt;
 }
 
-std::optional<std::string> TickLogger::openFile() {
+std::optional<std::string> TickLogger::openFile(bool append) {
   std::error_code ec;
   fs::create_directories(file_path_.parent_path(), ec);
 
@@ -34,18 +35,64 @@ std::optional<std::string> TickLogger::openFile() {
                        file_path_.string());
   }
 
-  file_.open(file_path_);
+  if (append) {
+    file_size_ = fs::file_size(file_path_, ec);
+    if (ec) {
+      return std::format("TickLogger: cannot resume missing file: {}",
+                         file_path_.string());
+    }
+  }
 
-  if (!file_) {
-    return std::format("TickLogger: error on file open for path: {}",
-                       file_path_.string());
+  auto sink = OpenFileSink(backend_, file_path_, append);
+  if (!sink) {
+    return std::format("TickLogger: {}", sink.error());
+  }
+  file_ = std::move(sink.value());
+
+  if (append) {
+    return std::nullopt;
+  }
+
+  const auto header = std::format("{},{},{}\n", "Time", "Price", "Volume");
+  file_size_ = header.size();
+
+  if (auto err = file_->write(header)) {
+    return std::format("TickLogger: {}", err.value());
+  }
+
+  return std::nullopt;
+}
+
+void TickLogger::save(SnapshotWriter& writer) const {
+  if (auto err = file_->flush()) {
+    std::println(stderr, "TickLogger: {}", err.value());
   }
+  writer.write(file_size_);
+}
 
-  file_ << std::format("{},{},{}\n", "Time", "Price", "Volume");
+std::optional<std::string> TickLogger::load(SnapshotReader& reader) {
+  uint64_t size = 0;
+  if (!reader.read(size)) {
+    return std::format("TickLogger: corrupted snapshot");
+  }
 
-  if (file_.fail()) {
-    return std::format("TickLogger: file write error");
+  file_.reset();
+  std::error_code ec;
+  if (fs::file_size(file_path_, ec) < size || ec) {
+    return std::format("TickLogger: {} is shorter than the snapshot",
+                       file_path_.string());
+  }
+  fs::resize_file(file_path_, size, ec);
+  if (ec) {
+    return std::format("TickLogger: cannot truncate {}: {}",
+                       file_path_.string(), ec.message());
   }
 
+  auto sink = OpenFileSink(backend_, file_path_, true);
+  if (!sink) {
+    return std::format("TickLogger: {}", sink.error());
+  }
+  file_ = std::move(sink.value());
+  file_size_ = size;
   return std::nullopt;
-}
\ No newline at end of file
+}
@@ -2,10 +2,11 @@
 #define TRADINGSIMULATOR_TICKLOGGER_H
 
 #include <filesystem>
-#include <fstream>
 #include <optional>
 #include <string>
 
+#include "FileSink.h"
+#include "common/Snapshot.h"
 #include "common/Types.h"
 #include "config/Config.h"
 
@@ -16,11 +17,19 @@ class TickLogger {
   explicit TickLogger(const Config& config);
   std::optional<std::string> writeTick(const Tick& tick);
 
+  // Only the file length is stored: restoring truncates the log back to the
+  // checkpoint so lines written after it are not duplicated on resume.
+  // Buffered lines are flushed first, so the file holds what is counted.
+  void save(SnapshotWriter& writer) const;
+  std::optional<std::string> load(SnapshotReader& reader);
+
  private:
-  std::optional<std::string> openFile();
+  std::optional<std::string> openFile(bool append);
 
   fs::path file_path_;
-  std::ofstream file_;
+  FileSinkBackend backend_;
+  std::optional<FileSink> file_;
+  uint64_t file_size_ = 0;
 };
 
 #endif  // TRADINGSIMULATOR_TICKLOGGER_H
@@ -1,7 +1,21 @@
+#include <algorithm>
 #include <print>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include "backtest/Backtester.h"
+#include "backtest/TickFile.h"
 #include "config/ConfigManager.h"
+#include "feed/TickFeedSubscriber.h"
+#include "feed/UdpFeedSubscriber.h"
+#include "logs/TickLogger.h"
+#include "simulation/ScenarioRunner.h"
 #include "simulation/Simulator.h"
+#include "trading/AlphaTable.h"
+#include "venue/ExchangeServer.h"
+#include "venue/OrderGateway.h"
+#include "venue/SharedVenue.h"
 
 std::filesystem::path GetExecutableDirectory(const char* argv0) {
   const std::filesystem::path exe_path(argv0);
@@ -33,12 +47,37 @@ std::expected<Config, std::string> LoadOrCreateConfig(
 }
 
 [[noreturn]] void PrintUsageAndExit() {
-  std::println("Usage: TradingSim [CONFIG_PATH]");
+  std::println(
+      "Usage: TradingSim [--resume | --backtest TICKS_CSV] [CONFIG_PATH]");
+  std::println("       TradingSim --decode TICKS_BIN OUTPUT_CSV");
+  std::println("       TradingSim --subscribe FEED_NAME [CONFIG_PATH]");
+  std::println("       TradingSim --subscribe-udp [CONFIG_PATH]");
+  std::println("       TradingSim --exchange [CONFIG_PATH]");
+  std::println("       TradingSim --gateway [CONFIG_PATH]");
   std::println("");
   std::println("Arguments:");
   std::println("  CONFIG_PATH    Optional path to configuration file");
   std::println(
       "                 (default: config.ini in executable directory)");
+  std::println("  --resume       Continue from [Simulation] checkpoint_path");
+  std::println("                 instead of starting a new run");
+  std::println("  --backtest     Replay a recorded price log (TickLogger CSV)");
+  std::println("                 through the strategy on all cores instead");
+  std::println("                 of simulating prices");
+  std::println("  --decode       Convert a compressed price log");
+  std::println("                 (tick_log_format = compressed) to CSV");
+  std::println("  --subscribe    Trade the ticks of a running simulation's");
+  std::println("                 shared-memory feed (tick_log_format = feed)");
+  std::println("                 instead of simulating prices");
+  std::println("  --subscribe-udp");
+  std::println("                 Trade the ticks of a simulation's loopback");
+  std::println("                 UDP feed (tick_log_format = udp)");
+  std::println("  --exchange     Run the simulated venue for a simulation");
+  std::println("                 with [Exchange] venue = remote until it");
+  std::println("                 finishes");
+  std::println("  --gateway      Accept FIX-like orders over loopback TCP on");
+  std::println("                 [Exchange] gateway_port until the clients");
+  std::println("                 disconnect");
   std::println("");
   std::println("Description:");
   std::println("  Runs a Geometric Brownian Motion trading simulation with");
@@ -55,27 +94,278 @@ std::expected<Config, std::string> LoadOrCreateConfig(
   std::println("Examples:");
   std::println("  TradingSim                     # Use default config.ini");
   std::println("  TradingSim my_config.ini       # Use custom configuration");
+  std::println("  TradingSim --resume sim.ini    # Continue interrupted run");
+  std::println(
+      "  TradingSim --backtest ticks.csv sim.ini  # Backtest recorded ticks");
+  std::println(
+      "  TradingSim --decode ticks.bin ticks.csv  # Decompress a price log");
+  std::println(
+      "  TradingSim --subscribe tsim_ticks sim.ini  # Trade a live tick feed");
+  std::println(
+      "  TradingSim --subscribe-udp sim.ini  # Trade a loopback UDP feed");
+  std::println(
+      "  TradingSim --exchange sim.ini  # Venue for a venue = remote run");
+  std::println(
+      "  TradingSim --gateway sim.ini   # Order entry for external clients");
   std::println("  TradingSim C:\\configs\\sim.ini  # Use absolute path");
 
   exit(1);
 }
 
+void PrintAlphaTableInfo(const Config& config) {
+  if (config.alpha_table == AlphaTableMode::Off) return;
+
+  for (const auto& [name, period] : {std::pair{"fast_ema", config.fast_ema},
+                                     std::pair{"slow_ema", config.slow_ema}}) {
+    std::println("Alpha table for {}: step {}, max alpha error {:.3e}", name,
+                 config.alpha_table_step,
+                 AlphaTable::ErrorBound(period, config.min_diff_time,
+                                        config.alpha_table_step,
+                                        config.alpha_table));
+  }
+  std::println("");
+}
+
+int DecodeTickLog(const std::filesystem::path& input,
+                  const std::filesystem::path& output) {
+  auto ticks = ReadTickFile(input);
+  if (!ticks) {
+    std::println("Error: {}", ticks.error());
+    return 1;
+  }
+
+  Config config;
+  config.price_evolution_path = output;
+  TickLogger logger(config);
+  for (const auto& tick : ticks.value()) {
+    if (auto err = logger.writeTick(tick)) {
+      std::println("Error: {}", err.value());
+      return 1;
+    }
+  }
+  std::println("Decoded {} ticks to {}", ticks->size(), output.string());
+  return 0;
+}
+
+template <typename StrategyT, typename FeedT>
+PerformanceSummary TradeFeed(const Config& config, FeedT& feed) {
+  StrategyT strategy(config);
+  while (auto tick = feed.next()) {
+    strategy.onTick(*tick);
+  }
+  return strategy.getSummary();
+}
+
+template <typename FeedT>
+PerformanceSummary TradeFeed(const Config& config, FeedT& feed) {
+  if (config.metrics_only) {
+    return TradeFeed<EmaTradingBot<NullOrderLogger>>(config, feed);
+  }
+  return TradeFeed<EmaTradingBot<>>(config, feed);
+}
+
+int RunSubscriber(const Config& config, std::string_view feed_name) {
+  auto subscriber = TickFeedSubscriber::Open(feed_name);
+  if (!subscriber) {
+    std::println("Error: {}", subscriber.error());
+    return 1;
+  }
+
+  const auto summary = TradeFeed(config, *subscriber.value());
+  std::println("Feed closed after {} ticks ({} lost to overruns).",
+               summary.ticks, subscriber.value()->lost());
+  std::println("");
+  std::println("{}", FormatSummary(summary));
+  return 0;
+}
+
+int RunUdpSubscriber(const Config& config) {
+  auto subscriber =
+      UdpFeedSubscriber::Open(config.udp_feed_port, config.udp_replay_port);
+  if (!subscriber) {
+    std::println("Error: {}", subscriber.error());
+    return 1;
+  }
+
+  const auto summary = TradeFeed(config, *subscriber.value());
+  const auto& stats = subscriber.value()->stats();
+  std::println(
+      "Feed ended after {} ticks in {} datagrams: {} gaps, {} ticks "
+      "recovered, {} lost.",
+      stats.ticks, stats.datagrams, stats.gaps, stats.recovered, stats.lost);
+  std::println("");
+  std::println("{}", FormatSummary(summary));
+  return 0;
+}
+
+int RunExchange(const Config& config) {
+  auto server = ExchangeServer::Open(config);
+  if (!server) {
+    std::println("Error: {}", server.error());
+    return 1;
+  }
+
+  std::println("Exchange listening on {}", config.venue_name);
+  server.value()->Run();
+  std::println("Client detached after {} orders ({} rejected).",
+               server.value()->orders(), server.value()->rejected());
+  return 0;
+}
+
+int RunGateway(const Config& config) {
+  auto gateway = OrderGateway::Open(config);
+  if (!gateway) {
+    std::println("Error: {}", gateway.error());
+    return 1;
+  }
+
+  std::println("Order gateway listening on 127.0.0.1:{}",
+               gateway.value()->port());
+  gateway.value()->Run();
+  const auto& stats = gateway.value()->stats();
+  std::println(
+      "Clients disconnected after {} orders ({} rejected), {} malformed "
+      "messages.",
+      stats.orders, stats.rejected, stats.malformed);
+  return 0;
+}
+
+// Session k of a shared run writes its logs next to the configured ones,
+// as output/orders.s<k>.csv, and draws prices from a seed of its own
+Config SessionConfig(const Config& config, uint64_t session) {
+  const auto name = std::format("s{}", session);
+  Config session_config = config;
+  session_config.price_evolution_path =
+      ScenarioRunner::BranchPath(config.price_evolution_path, name);
+  session_config.orders_log_path =
+      ScenarioRunner::BranchPath(config.orders_log_path, name);
+  if (config.seed != 0) {
+    session_config.seed = config.seed + 2 * session;
+  }
+  return session_config;
+}
+
+template <typename SimulatorT>
+int RunSharedVenue(const Config& config) {
+  auto venue = SharedVenue::Create(config);
+  if (!venue) {
+    std::println("Error: {}", venue.error());
+    return 1;
+  }
+
+  std::vector<PerformanceSummary> summaries(config.venue_sessions);
+  std::vector<std::string> errors(config.venue_sessions);
+  {
+    std::jthread venue_thread(
+        [&venue](std::stop_token stop) { venue.value()->Run(stop); });
+    std::vector<std::jthread> sessions;
+    for (uint64_t k = 0; k < config.venue_sessions; ++k) {
+      sessions.emplace_back([&, k] {
+        try {
+          SimulatorT simulator(SessionConfig(config, k));
+          simulator.Run();
+          summaries[k] = simulator.getSummary();
+        } catch (const std::exception& e) {
+          errors[k] = e.what();
+        }
+      });
+    }
+  }
+
+  std::println("Simulation finished.");
+  std::println("");
+  for (uint64_t k = 0; k < config.venue_sessions; ++k) {
+    if (!errors[k].empty()) {
+      std::println("Strategy {}: Error: {}\n", k, errors[k]);
+      continue;
+    }
+    std::println("Strategy {}:\n{}\n", k, FormatSummary(summaries[k]));
+  }
+  const auto stats = venue.value()->stats();
+  std::println("Shared venue: {} orders ({} rejected) in {} batches.",
+               stats.orders, stats.rejected, stats.batches);
+  return std::ranges::all_of(errors, &std::string::empty) ? 0 : 1;
+}
+
+template <typename SimulatorT>
+int RunSimulation(const Config& config) {
+  SimulatorT simulator(config);
+
+  if (config.resume) {
+    if (auto err = simulator.LoadCheckpoint(config.checkpoint_path)) {
+      std::println("Error: {}", err.value());
+      return 1;
+    }
+    std::println("Resuming from step {} of {}", simulator.getCurrentStep(),
+                 config.steps_count);
+  }
+
+  simulator.Run();
+
+  std::println("Simulation finished.");
+  std::println("");
+  std::println("{}", FormatSummary(simulator.getSummary()));
+  return 0;
+}
+
 int main(int argc, char* argv[]) {
   std::println("========================================");
   std::println("Trading Simulation - GBM with TimeMA Signals");
   std::println("========================================");
   std::println("");
 
-  if (argc > 2) {
-    std::println("Error: Too many arguments provided");
-    std::println("");
-    PrintUsageAndExit();
+  bool resume = false;
+  std::optional<std::filesystem::path> backtest_path;
+  std::optional<std::string> feed_name;
+  bool exchange = false;
+  bool gateway = false;
+  bool udp_feed = false;
+  std::optional<std::filesystem::path> config_arg;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    if (arg == "--resume") {
+      resume = true;
+    } else if (arg == "--backtest") {
+      if (++i == argc) {
+        std::println("Error: --backtest requires a tick file");
+        std::println("");
+        PrintUsageAndExit();
+      }
+      backtest_path = argv[i];
+    } else if (arg == "--subscribe") {
+      if (++i == argc) {
+        std::println("Error: --subscribe requires a feed name");
+        std::println("");
+        PrintUsageAndExit();
+      }
+      feed_name = argv[i];
+    } else if (arg == "--subscribe-udp") {
+      udp_feed = true;
+    } else if (arg == "--exchange") {
+      exchange = true;
+    } else if (arg == "--gateway") {
+      gateway = true;
+    } else if (arg == "--decode") {
+      if (argc - i != 3) {
+        std::println("Error: --decode requires an input and an output file");
+        std::println("");
+        PrintUsageAndExit();
+      }
+      return DecodeTickLog(argv[i + 1], argv[i + 2]);
+    } else if (!config_arg) {
+      config_arg = arg;
+    } else {
+      std::println("Error: Too many arguments provided");
+      std::println("");
+      PrintUsageAndExit();
+    }
   }
 
   std::filesystem::path config_path;
 
-  if (argc == 2) {
-    config_path = argv[1];
+  if (config_arg) {
+    config_path = *config_arg;
   } else {
     config_path = GetExecutableDirectory(argv[0]) / "config.ini";
   }
@@ -90,10 +380,110 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  const Config config = config_result.value();
-  Simulator simulator(config);
-  simulator.Run();
+  Config config = config_result.value();
+  config.resume = resume;
+  PrintAlphaTableInfo(config);
 
-  std::println("Simulation finished.");
-  return 0;
+  if (exchange) {
+    if (resume || backtest_path || feed_name || udp_feed || gateway) {
+      std::println(
+          "Error: --exchange cannot be combined with other run modes");
+      return 1;
+    }
+    return RunExchange(config);
+  }
+
+  if (gateway) {
+    if (resume || backtest_path || feed_name || udp_feed) {
+      std::println("Error: --gateway cannot be combined with other run modes");
+      return 1;
+    }
+    return RunGateway(config);
+  }
+
+  if (feed_name || udp_feed) {
+    if (resume || backtest_path || (feed_name && udp_feed)) {
+      std::println(
+          "Error: a subscriber cannot be combined with other run modes");
+      return 1;
+    }
+
+    if (udp_feed) {
+      std::println("Subscribing to UDP tick feed on port {}",
+                   config.udp_feed_port);
+      return RunUdpSubscriber(config);
+    }
+    std::println("Subscribing to tick feed {}", *feed_name);
+    return RunSubscriber(config, *feed_name);
+  }
+
+  if (backtest_path) {
+    if (resume) {
+      std::println("Error: --resume cannot be combined with --backtest");
+      return 1;
+    }
+
+    std::println("Backtesting {}", backtest_path->string());
+    auto summary = Backtester(config).Run(*backtest_path);
+    if (!summary) {
+      std::println("Error: {}", summary.error());
+      return 1;
+    }
+    std::println("Backtest finished.");
+    std::println("");
+    std::println("{}", FormatSummary(summary.value()));
+    return 0;
+  }
+
+  if (!config.branches.empty()) {
+    if (resume) {
+      std::println("Error: --resume is not supported for branched scenarios");
+      return 1;
+    }
+
+    std::println("Running shared prefix of {} steps, then {} scenarios",
+                 config.branch_step, config.branches.size());
+    auto errors = ScenarioRunner(config).Run();
+    for (const auto& error : errors) {
+      std::println("Error: {}", error);
+    }
+    std::println("Simulation finished.");
+    return errors.empty() ? 0 : 1;
+  }
+
+  if (config.venue == ExchangeVenue::Shared) {
+    if (resume) {
+      std::println("Error: --resume is not supported with venue = shared");
+      return 1;
+    }
+
+    std::println("Running {} strategies on one shared venue",
+                 config.venue_sessions);
+    if (config.metrics_only) {
+      return RunSharedVenue<SharedMetricsOnlySimulator>(config);
+    }
+    return RunSharedVenue<SharedExchangeSimulator>(config);
+  }
+  if (config.venue == ExchangeVenue::Remote) {
+    if (config.metrics_only) {
+      return RunSimulation<RemoteMetricsOnlySimulator>(config);
+    }
+    return RunSimulation<RemoteExchangeSimulator>(config);
+  }
+  if (config.metrics_only) {
+    return RunSimulation<MetricsOnlySimulator>(config);
+  }
+  if (config.tick_log_format == TickLogFormat::Compressed) {
+    return RunSimulation<CompressedLogSimulator>(config);
+  }
+  if (config.tick_log_format == TickLogFormat::Bars) {
+    return RunSimulation<BarLogSimulator>(config);
+  }
+  if (config.tick_log_format == TickLogFormat::Feed) {
+    return RunSimulation<FeedSimulator>(config);
+  }
+  if (config.tick_log_format == TickLogFormat::Udp) {
+    return RunSimulation<UdpFeedSimulator>(config);
+  }
+  return RunSimulation<Simulator<>>(config);
 }
@@ -0,0 +1,49 @@
+#include "BrownianBridge.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+BrownianBridge::BrownianBridge(const Tick& start, const Tick& end,
+                               double price_variation,
+                               std::chrono::nanoseconds time_horizon,
+                               uint64_t seed)
+    : variance_per_ns_(price_variation * price_variation /
+                       static_cast<double>(time_horizon.count())),
+      gen_(static_cast<std::mt19937::result_type>(seed)),
+      norm_dist_(0.0, 1.0) {
+  log_prices_.emplace(start.timestamp, std::log(start.price));
+  log_prices_.emplace(end.timestamp, std::log(end.price));
+}
+
+Price BrownianBridge::priceAt(std::chrono::nanoseconds time) {
+  time = std::clamp(time, getStartTime(), getEndTime());
+
+  auto right = log_prices_.lower_bound(time);
+  if (right->first == time) {
+    return std::exp(right->second);
+  }
+  auto left = std::prev(right);
+
+  // log S(t) given its neighbours is normal with the linearly interpolated
+  // mean and variance sigma^2 * (t - t0) * (t1 - t) / (t1 - t0).
+  const auto t0 = static_cast<double>(left->first.count());
+  const auto t1 = static_cast<double>(right->first.count());
+  const auto t = static_cast<double>(time.count());
+  const double weight = (t - t0) / (t1 - t0);
+  const double mean =
+      left->second + weight * (right->second - left->second);
+  const double variance = variance_per_ns_ * (t - t0) * (t1 - t) / (t1 - t0);
+
+  const double log_price = mean + std::sqrt(variance) * norm_dist_(gen_);
+  log_prices_.emplace_hint(right, time, log_price);
+  return std::exp(log_price);
+}
+
+std::chrono::nanoseconds BrownianBridge::getStartTime() const {
+  return log_prices_.begin()->first;
+}
+
+std::chrono::nanoseconds BrownianBridge::getEndTime() const {
+  return log_prices_.rbegin()->first;
+}
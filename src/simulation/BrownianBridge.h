@@ -0,0 +1,34 @@
+#ifndef TRADINGSIMULATOR_BROWNIANBRIDGE_H
+#define TRADINGSIMULATOR_BROWNIANBRIDGE_H
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <random>
+
+#include "common/Types.h"
+
+// GBM path between two known ticks, sampled on demand. Each query draws the
+// log-price from its exact distribution conditioned on the closest points
+// already known on either side, then remembers it, so later queries stay
+// consistent with earlier ones whatever order they come in. The drift
+// cancels out of the conditional law, only the volatility is needed.
+class BrownianBridge {
+ public:
+  BrownianBridge(const Tick& start, const Tick& end, double price_variation,
+                 std::chrono::nanoseconds time_horizon, uint64_t seed);
+
+  // Price at `time`, clamped to [start, end].
+  Price priceAt(std::chrono::nanoseconds time);
+
+  [[nodiscard]] std::chrono::nanoseconds getStartTime() const;
+  [[nodiscard]] std::chrono::nanoseconds getEndTime() const;
+
+ private:
+  double variance_per_ns_;
+  std::map<std::chrono::nanoseconds, double> log_prices_;
+  std::mt19937 gen_;
+  std::normal_distribution<double> norm_dist_;
+};
+
+#endif  // TRADINGSIMULATOR_BROWNIANBRIDGE_H
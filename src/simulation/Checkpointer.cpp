@@ -0,0 +1,41 @@
+#include "Checkpointer.h"
+
+#include <utility>
+
+Checkpointer::Checkpointer(std::filesystem::path path)
+    : path_(std::move(path)) {}
+
+Checkpointer::~Checkpointer() { wait(); }
+
+void Checkpointer::submit(std::string payload,
+                          std::vector<SnapshotBarrier> barriers) {
+  collect();
+  pending_ = std::async(
+      std::launch::async,
+      [path = path_, payload = std::move(payload),
+       barriers = std::move(barriers)]() -> std::optional<std::string> {
+        for (const auto& barrier : barriers) {
+          if (auto err = barrier()) return err;
+        }
+        return WriteSnapshotFile(path, payload);
+      });
+}
+
+std::optional<std::string> Checkpointer::wait() {
+  collect();
+  return std::exchange(last_error_, std::nullopt);
+}
+
+void Checkpointer::collect() {
+  if (!pending_.valid()) {
+    return;
+  }
+  auto error = pending_.get();
+  if (error) {
+    last_error_ = std::move(error);
+  } else {
+    ++written_count_;
+  }
+}
+
+uint64_t Checkpointer::getWrittenCount() const { return written_count_; }
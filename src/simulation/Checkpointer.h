@@ -0,0 +1,39 @@
+#ifndef TRADINGSIMULATOR_CHECKPOINTER_H
+#define TRADINGSIMULATOR_CHECKPOINTER_H
+
+#include <filesystem>
+#include <future>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/Snapshot.h"
+
+// Persists snapshots on a background thread, so the simulation loop only pays
+// for serializing its state into memory. The state is a few kilobytes, which
+// makes an in-memory copy cheaper than fork()-based copy-on-write. The
+// snapshot's barriers (e.g. the order log becoming durable up to the saved
+// length) are waited for on the same thread, before the file is written.
+class Checkpointer {
+ public:
+  explicit Checkpointer(std::filesystem::path path);
+  ~Checkpointer();
+
+  // Waits for the previous write only if it is still running. A failed
+  // barrier keeps the previous snapshot and is reported by wait().
+  void submit(std::string payload,
+              std::vector<SnapshotBarrier> barriers = {});
+  std::optional<std::string> wait();
+
+  [[nodiscard]] uint64_t getWrittenCount() const;
+
+ private:
+  void collect();
+
+  std::filesystem::path path_;
+  std::future<std::optional<std::string>> pending_;
+  std::optional<std::string> last_error_;
+  uint64_t written_count_ = 0;
+};
+
+#endif  // TRADINGSIMULATOR_CHECKPOINTER_H
@@ -0,0 +1,117 @@
+#include "PathGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "common/Parallel.h"
+
+PathGenerator::PathGenerator(const Config& config, uint64_t seed)
+    : rng_(seed),
+      min_diff_time_(config.min_diff_time),
+      max_diff_time_(config.max_diff_time),
+      inv_time_horizon_(1.0 /
+                        static_cast<double>(config.time_horizon.count())),
+      drift_(config.average_trend_value -
+             0.5 * config.price_variation * config.price_variation),
+      price_variation_(config.price_variation),
+      min_volume_(config.min_volume),
+      max_volume_(config.max_volume),
+      timestamp_(0),
+      block_base_(std::log(config.initial_price)) {}
+
+void PathGenerator::reset(const Tick& tick, uint64_t step) {
+  step_ = step;
+  timestamp_ = tick.timestamp;
+  block_base_ = std::log(tick.price);
+  block_sum_ = 0;
+}
+
+void PathGenerator::generate(std::span<Tick> out, size_t threads) {
+  if (out.empty()) return;
+
+  // Segments of `out` split at absolute block boundaries; the first and
+  // last may be partial blocks.
+  std::vector<IndexRange> segments;
+  for (size_t begin = 0; begin < out.size();) {
+    const uint64_t in_block = (step_ + begin) % kBlockSize;
+    const size_t end =
+        std::min<size_t>(out.size(), begin + (kBlockSize - in_block));
+    segments.emplace_back(begin, end);
+    begin = end;
+  }
+
+  // Pass 1: draw every step, leaving the running in-segment log-return sum
+  // in `price` and the in-segment elapsed time in `timestamp`.
+  struct SegmentTotal {
+    double log_return;
+    std::chrono::nanoseconds elapsed;
+  };
+  std::vector<SegmentTotal> totals(segments.size());
+  const auto groups = SplitRange(segments.size(), ThreadCount(threads));
+  ForEachRange(groups, [&](size_t g) {
+    for (size_t k = groups[g].first; k < groups[g].second; ++k) {
+      double sum = k == 0 ? block_sum_ : 0.0;
+      std::chrono::nanoseconds elapsed(0);
+      for (size_t i = segments[k].first; i < segments[k].second; ++i) {
+        const uint64_t counter = (step_ + i) * 4;
+        const std::chrono::nanoseconds deltaT(rng_.uniformInt(
+            counter, min_diff_time_.count(), max_diff_time_.count()));
+        const double t_fraction =
+            static_cast<double>(deltaT.count()) * inv_time_horizon_;
+        const double Z = rng_.normal(counter + 1, counter + 2);
+        sum += drift_ * t_fraction +
+               price_variation_ * std::sqrt(t_fraction) * Z;
+        elapsed += deltaT;
+
+        out[i].timestamp = elapsed;
+        out[i].price = sum;
+        out[i].volume = min_volume_ + rng_.uniform(counter + 3) *
+                                          (max_volume_ - min_volume_);
+      }
+      totals[k] = {sum, elapsed};
+    }
+  });
+
+  // Chain the segment bases
+  std::vector<double> bases(segments.size());
+  std::vector<std::chrono::nanoseconds> starts(segments.size());
+  for (size_t k = 0; k < segments.size(); ++k) {
+    bases[k] = block_base_;
+    starts[k] = timestamp_;
+    timestamp_ += totals[k].elapsed;
+    if ((step_ + segments[k].second) % kBlockSize == 0) {
+      block_base_ += totals[k].log_return;
+      block_sum_ = 0;
+    } else {
+      block_sum_ = totals[k].log_return;
+    }
+  }
+  step_ += out.size();
+
+  // Pass 2: absolute time and price
+  ForEachRange(groups, [&](size_t g) {
+    for (size_t k = groups[g].first; k < groups[g].second; ++k) {
+      for (size_t i = segments[k].first; i < segments[k].second; ++i) {
+        out[i].timestamp += starts[k];
+        out[i].price = std::exp(bases[k] + out[i].price);
+      }
+    }
+  });
+}
+
+void PathGenerator::save(SnapshotWriter& writer) const {
+  writer.write(rng_);
+  writer.write(step_);
+  writer.write(timestamp_);
+  writer.write(block_base_);
+  writer.write(block_sum_);
+}
+
+void PathGenerator::load(SnapshotReader& reader) {
+  reader.read(rng_);
+  reader.read(step_);
+  reader.read(timestamp_);
+  reader.read(block_base_);
+  reader.read(block_sum_);
+}
@@ -0,0 +1,57 @@
+#ifndef TRADINGSIMULATOR_PATHGENERATOR_H
+#define TRADINGSIMULATOR_PATHGENERATOR_H
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+
+#include "common/CounterRng.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+#include "config/Config.h"
+
+// GBM path generated in parallel. Step i draws its interval, shock and
+// volume from counters 4i..4i+3 of a CounterRng, so any thread can produce
+// any part of the path on its own.
+//
+// Floating-point sums are not associative, so the log-price is defined on
+// fixed blocks of kBlockSize steps rather than per thread: within a block
+// it is the block's base plus the left-to-right sum of the block's
+// log-returns, and each base is the previous base plus that block's total.
+// Threads reduce whole blocks, the bases are chained sequentially and the
+// blocks are then filled in parallel. The arithmetic depends only on the
+// step index, so the path is bit-identical for any thread count and any
+// way of splitting it into generate() calls.
+class PathGenerator {
+ public:
+  static constexpr uint64_t kBlockSize = 4096;
+
+  PathGenerator(const Config& config, uint64_t seed);
+
+  // Continues the path from `tick`; the next generated step is `step`.
+  void reset(const Tick& tick, uint64_t step);
+
+  // Fills `out` with the next out.size() ticks using `threads` threads
+  // (0 - all hardware threads).
+  void generate(std::span<Tick> out, size_t threads);
+
+  void save(SnapshotWriter& writer) const;
+  void load(SnapshotReader& reader);
+
+ private:
+  CounterRng rng_;
+  std::chrono::nanoseconds min_diff_time_;
+  std::chrono::nanoseconds max_diff_time_;
+  double inv_time_horizon_;
+  double drift_;
+  double price_variation_;
+  Volume min_volume_;
+  Volume max_volume_;
+
+  uint64_t step_ = 0;                    // index of the next step
+  std::chrono::nanoseconds timestamp_;   // time of the last tick
+  double block_base_;                    // log-price at the block start
+  double block_sum_ = 0;                 // log-returns since block start
+};
+
+#endif  // TRADINGSIMULATOR_PATHGENERATOR_H
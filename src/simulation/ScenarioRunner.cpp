@@ -0,0 +1,140 @@
+#include "ScenarioRunner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <format>
+#include <print>
+#include <thread>
+#include <utility>
+
+#include "Simulator.h"
+
+ScenarioRunner::ScenarioRunner(const Config& config) : config_(config) {}
+
+std::vector<std::string> ScenarioRunner::Run() {
+  if (config_.metrics_only) {
+    return run<MetricsOnlySimulator>();
+  }
+  if (config_.tick_log_format == TickLogFormat::Compressed) {
+    return run<CompressedLogSimulator>();
+  }
+  if (config_.tick_log_format == TickLogFormat::Bars) {
+    return run<BarLogSimulator>();
+  }
+  if (config_.tick_log_format == TickLogFormat::Feed) {
+    return run<FeedSimulator>();
+  }
+  return run<Simulator<>>();
+}
+
+template <typename SimulatorT>
+std::vector<std::string> ScenarioRunner::run() {
+  Config prefix = config_;
+  prefix.steps_count = config_.branch_step;
+  prefix.checkpoint_interval = 0;
+
+  std::string prefix_state;
+  {
+    // Scoped so the prefix logs are flushed and closed before branches copy
+    // them.
+    SimulatorT simulator(prefix);
+    simulator.Run();
+    SnapshotWriter writer;
+    simulator.save(writer);
+    prefix_state = std::move(writer).release();
+  }
+
+  std::vector<std::string> errors(config_.branches.size());
+  std::atomic<size_t> next_branch = 0;
+  const size_t workers = std::min<size_t>(
+      std::max(1u, std::thread::hardware_concurrency()),
+      config_.branches.size());
+  {
+    std::vector<std::jthread> threads;
+    for (size_t w = 0; w < workers; ++w) {
+      threads.emplace_back([&] {
+        for (size_t i = next_branch++; i < config_.branches.size();
+             i = next_branch++) {
+          if (auto err = runBranch<SimulatorT>(config_.branches[i],
+                                               prefix_state)) {
+            errors[i] = std::move(err.value());
+          }
+        }
+      });
+    }
+  }
+
+  std::erase_if(errors, [](const std::string& e) { return e.empty(); });
+  return errors;
+}
+
+template <typename SimulatorT>
+std::optional<std::string> ScenarioRunner::runBranch(
+    const ScenarioBranch& branch, const std::string& prefix_state) const {
+  const Config branch_config = BranchConfig(config_, branch);
+
+  // Each branch owns a full copy of the prefix history, truncated and
+  // continued by Simulator::load() exactly as on --resume.
+  if (!config_.metrics_only) {
+    std::vector<std::pair<fs::path, fs::path>> logs{
+        {config_.orders_log_path, branch_config.orders_log_path}};
+    if (config_.tick_log_format == TickLogFormat::Bars) {
+      for (const auto resolution : config_.bar_resolutions) {
+        logs.emplace_back(
+            BarLogger::Path(config_.price_evolution_path, resolution),
+            BarLogger::Path(branch_config.price_evolution_path, resolution));
+      }
+    } else if (config_.tick_log_format != TickLogFormat::Feed) {
+      logs.emplace_back(config_.price_evolution_path,
+                        branch_config.price_evolution_path);
+    }
+
+    std::error_code ec;
+    for (const auto& [from, to] : logs) {
+      fs::copy_file(from, to, fs::copy_options::overwrite_existing, ec);
+      if (ec) break;
+    }
+    if (ec) {
+      return std::format("Branch {}: cannot copy prefix logs: {}",
+                         branch.name, ec.message());
+    }
+  }
+
+  try {
+    SimulatorT simulator(branch_config);
+    SnapshotReader reader(prefix_state);
+    if (auto err = simulator.load(reader)) {
+      return std::format("Branch {}: {}", branch.name, err.value());
+    }
+    simulator.Run();
+    std::println("Scenario {}:\n{}\n", branch.name,
+                 FormatSummary(simulator.getSummary()));
+  } catch (const std::exception& e) {
+    return std::format("Branch {}: {}", branch.name, e.what());
+  }
+  return std::nullopt;
+}
+
+std::filesystem::path ScenarioRunner::BranchPath(
+    const std::filesystem::path& path, std::string_view branch_name) {
+  auto file_name = path.stem();
+  file_name += std::format(".{}", branch_name);
+  file_name += path.extension();
+  return path.parent_path() / file_name;
+}
+
+Config ScenarioRunner::BranchConfig(const Config& base,
+                                    const ScenarioBranch& branch) {
+  Config config = base;
+  config.average_trend_value = branch.average_trend_value;
+  config.price_variation = branch.price_variation;
+  config.rejection_probability = branch.rejection_probability;
+  config.price_evolution_path =
+      BranchPath(base.price_evolution_path, branch.name);
+  config.orders_log_path = BranchPath(base.orders_log_path, branch.name);
+  config.checkpoint_path = BranchPath(base.checkpoint_path, branch.name);
+  config.tick_feed_name = std::format("{}.{}", base.tick_feed_name, branch.name);
+  config.branches.clear();
+  config.resume = true;
+  return config;
+}
@@ -0,0 +1,39 @@
+#ifndef TRADINGSIMULATOR_SCENARIORUNNER_H
+#define TRADINGSIMULATOR_SCENARIORUNNER_H
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "config/Config.h"
+
+// Runs the first branch_step ticks once, then continues every
+// [Branch.<name>] scenario from a clone of that state on its own thread.
+// Branches keep the prefix's random stream, so they differ only by the
+// parameters they override.
+class ScenarioRunner {
+ public:
+  explicit ScenarioRunner(const Config& config);
+
+  // Returns one error message per failed branch.
+  std::vector<std::string> Run();
+
+  // Output paths get the branch name before the extension:
+  // output/orders.csv -> output/orders.<name>.csv
+  static std::filesystem::path BranchPath(const std::filesystem::path& path,
+                                          std::string_view branch_name);
+  static Config BranchConfig(const Config& base, const ScenarioBranch& branch);
+
+ private:
+  template <typename SimulatorT>
+  std::vector<std::string> run();
+  template <typename SimulatorT>
+  std::optional<std::string> runBranch(const ScenarioBranch& branch,
+                                       const std::string& prefix_state) const;
+
+  Config config_;
+};
+
+#endif  // TRADINGSIMULATOR_SCENARIORUNNER_H
@@ -1,33 +1,467 @@
 #ifndef TRADINGSIMULATOR_SIMULATOR_H
 #define TRADINGSIMULATOR_SIMULATOR_H
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <format>
+#include <optional>
+#include <print>
 #include <random>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
 
+#include "BrownianBridge.h"
+#include "Checkpointer.h"
+#include "PathGenerator.h"
+#include "common/ConflatingChannel.h"
+#include "common/EventBus.h"
+#include "common/LatencyHistogram.h"
+#include "common/Snapshot.h"
 #include "common/Types.h"
 #include "config/Config.h"
+#include "feed/TickFeedPublisher.h"
+#include "feed/UdpFeedPublisher.h"
+#include "logs/BarLogger.h"
+#include "logs/CompressedTickLogger.h"
+#include "logs/LogSink.h"
+#include "logs/NullLogger.h"
 #include "logs/TickLogger.h"
 #include "trading/EmaTradingBot.h"
+#include "trading/Strategy.h"
 
 using namespace std::chrono_literals;
 
+// Generates the price path and drives the strategy. Both the strategy and
+// the tick logger are template parameters, so the loop below is compiled
+// for the concrete types with no virtual dispatch.
+//
+// With [Simulation] path_threads set, prices come from a PathGenerator in
+// batches generated on that many threads instead of the serial mt19937
+// stream; the strategy still sees the ticks one by one.
+//
+// With [Simulation] tick_delivery = latest, generation and the tick log run
+// on a thread of their own and hand ticks to the strategy through a
+// ConflatingChannel: a strategy that falls behind gets the newest tick and
+// the ones in between are counted in the summary as conflated.
+//
+// With tick_delivery = bus, the generating thread publishes ticks to an
+// EventBus. The strategy, the tick log and a metrics consumer follow it on
+// threads of their own; the log and the metrics see a tick only after the
+// strategy is done with it. Every tick still reaches the strategy in
+// order, so the run trades exactly as with every. At a checkpoint the
+// generator waits for all three to catch up before saving.
+template <Strategy StrategyT = EmaTradingBot<>,
+          TickSink TickLoggerT = TickLogger>
 class Simulator {
  public:
   explicit Simulator(const Config& config);
   void Run();
 
+  // Advances the clock and price by `duration` with a single exact GBM draw;
+  // no ticks are emitted. The returned bridge fills in prices inside the
+  // skipped interval if anyone asks for them.
+  BrownianBridge fastForward(std::chrono::nanoseconds duration);
+
+  // Restores a checkpoint written by Run(); the loggers must have been
+  // opened with Config::resume so their files are continued, not recreated.
+  std::optional<std::string> LoadCheckpoint(const std::filesystem::path& path);
+
+  void save(SnapshotWriter& writer) const;
+  std::optional<std::string> load(SnapshotReader& reader);
+
+  [[nodiscard]] uint64_t getCurrentStep() const;
+  [[nodiscard]] PerformanceSummary getSummary() const;
+  [[nodiscard]] const StrategyT& getStrategy() const;
+
  private:
+  // A tick as handed over by the generator thread
+  struct PublishedTick {
+    Tick tick;
+    Volume total_volume;  // of every tick generated so far
+  };
+
+  struct BusTick {
+    Tick tick;
+    std::chrono::steady_clock::time_point published;
+  };
+
+  void generate();
+  void runSerialPath();
+  void runParallelPath();
+  void runConflated();
+  void runBus();
+  void processTick();
+  void logTick(const Tick& tick);
+  void deliver(const Tick& tick);
+  void checkpoint();
   Price calculateGBM(std::chrono::nanoseconds deltaT);
   std::chrono::nanoseconds getRandomDeltaT();
   double getRandomVolume();
 
   Tick currentTick_;
-  TickLogger logger_;
+  TickLoggerT logger_;
   Config config_;
-  EmaTradingBot tradingBot_;
+  StrategyT strategy_;
 
   std::mt19937 gen_;
   std::normal_distribution<double> norm_dist_;
+
+  std::optional<PathGenerator> path_;
+  std::vector<Tick> path_batch_;
+
+  uint64_t step_ = 0;
+  std::chrono::nanoseconds next_timer_;
+  Checkpointer checkpointer_;
+
+  std::optional<ConflatingChannel<PublishedTick>> channel_;
+  Volume total_volume_ = 0;
+
+  std::optional<EventBus<BusTick>> bus_;
+  LatencyHistogram bus_latency_;  // owned by the metrics consumer
+  uint64_t bus_batches_ = 0;
 };
 
+// Ticks generated per PathGenerator batch
+inline constexpr size_t kPathBatchSize = size_t{1} << 16;
+
+// Metrics-only runs: no price or order logs are written
+using MetricsOnlySimulator =
+    Simulator<EmaTradingBot<NullOrderLogger>, NullTickLogger>;
+
+// Price log written as CompressedTickLogger blocks instead of CSV
+using CompressedLogSimulator =
+    Simulator<EmaTradingBot<>, CompressedTickLogger>;
+
+// OHLCV bars at every bar_resolutions entry instead of the tick log
+using BarLogSimulator = Simulator<EmaTradingBot<>, BarLogger>;
+
+// Ticks published to the shared-memory feed instead of a price log
+using FeedSimulator = Simulator<EmaTradingBot<>, TickFeedPublisher>;
+
+// Ticks published as loopback UDP datagrams instead of a price log
+using UdpFeedSimulator = Simulator<EmaTradingBot<>, UdpFeedPublisher>;
+
+// Orders decided by an ExchangeServer process ([Exchange] venue = remote)
+using RemoteExchangeSimulator =
+    Simulator<EmaTradingBot<OrderLogger, RemoteExchange>, TickLogger>;
+using RemoteMetricsOnlySimulator =
+    Simulator<EmaTradingBot<NullOrderLogger, RemoteExchange>, NullTickLogger>;
+
+// One of several strategies on a SharedVenue ([Exchange] venue = shared)
+using SharedExchangeSimulator =
+    Simulator<EmaTradingBot<OrderLogger, SharedExchange>, TickLogger>;
+using SharedMetricsOnlySimulator =
+    Simulator<EmaTradingBot<NullOrderLogger, SharedExchange>, NullTickLogger>;
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+Simulator<StrategyT, TickLoggerT>::Simulator(const Config& config)
+    : currentTick_(0ns, config.initial_price, 0),
+      logger_(config),
+      config_(config),
+      strategy_(config),
+      gen_(config.seed == 0
+               ? std::random_device{}()
+               : static_cast<std::mt19937::result_type>(config.seed)),
+      norm_dist_(0.0, 1.0),
+      next_timer_(config.timer_interval),
+      checkpointer_(config.checkpoint_path) {
+  if (config.path_threads != 0) {
+    path_.emplace(config, config.seed == 0 ? std::random_device{}()
+                                           : config.seed);
+    path_batch_.resize(kPathBatchSize);
+  }
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+void Simulator<StrategyT, TickLoggerT>::Run() {
+  // Resumed runs are already past the warm-up
+  if (currentTick_.timestamp < config_.warmup) {
+    fastForward(config_.warmup - currentTick_.timestamp);
+  }
+
+  if (config_.tick_delivery == TickDelivery::Latest) {
+    runConflated();
+  } else if (config_.tick_delivery == TickDelivery::Bus) {
+    runBus();
+  } else {
+    generate();
+  }
+
+  if (auto err = checkpointer_.wait()) {
+    std::println(stderr, "{}", err.value());
+  }
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+void Simulator<StrategyT, TickLoggerT>::generate() {
+  if (path_) {
+    runParallelPath();
+  } else {
+    runSerialPath();
+  }
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+void Simulator<StrategyT, TickLoggerT>::runConflated() {
+  channel_.emplace();
+  std::jthread generator([this] {
+    generate();
+    channel_->close();
+  });
+
+  Volume taken_volume = 0;
+  while (auto published = channel_->wait()) {
+    Tick tick = published->tick;
+    if (config_.conflate_volume) {
+      tick.volume = published->total_volume - taken_volume;
+      taken_volume = published->total_volume;
+    }
+    deliver(tick);
+  }
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+void Simulator<StrategyT, TickLoggerT>::runBus() {
+  bus_.emplace(config_.bus_capacity, config_.bus_wait);
+  const size_t strategy = bus_->addConsumer();
+  const size_t logger = bus_->addConsumer({strategy});
+  const size_t metrics = bus_->addConsumer({strategy});
+  {
+    std::jthread strategy_thread([this, strategy] {
+      bus_->run(strategy,
+                [this](const BusTick& event, bool) { deliver(event.tick); });
+    });
+    std::jthread logger_thread([this, logger] {
+      bus_->run(logger,
+                [this](const BusTick& event, bool) { logTick(event.tick); });
+    });
+    std::jthread metrics_thread([this, metrics] {
+      bus_->run(metrics, [this](const BusTick& event, bool) {
+        bus_latency_.record(std::chrono::steady_clock::now() -
+                            event.published);
+      });
+    });
+
+    generate();
+    bus_->close();
+  }
+  bus_batches_ = bus_->batches(strategy);
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+void Simulator<StrategyT, TickLoggerT>::runSerialPath() {
+  while (step_ < config_.steps_count) {
+    std::chrono::nanoseconds deltaT = getRandomDeltaT();
+    currentTick_.timestamp += deltaT;
+    currentTick_.price = calculateGBM(deltaT);
+    currentTick_.volume = getRandomVolume();
+    processTick();
+  }
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+void Simulator<StrategyT, TickLoggerT>::runParallelPath() {
+  while (step_ < config_.steps_count) {
+    // Batches end on checkpoint steps, so a snapshot always matches the
+    // generator's position.
+    uint64_t count = std::min<uint64_t>(path_batch_.size(),
+                                        config_.steps_count - step_);
+    if (config_.checkpoint_interval != 0) {
+      count = std::min(count, config_.checkpoint_interval -
+                                  step_ % config_.checkpoint_interval);
+    }
+
+    const std::span<Tick> batch(path_batch_.data(), count);
+    path_->generate(batch, config_.path_threads);
+    for (const Tick& tick : batch) {
+      currentTick_ = tick;
+      processTick();
+    }
+  }
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+void Simulator<StrategyT, TickLoggerT>::processTick() {
+  if (bus_) {
+    bus_->claim() = {currentTick_, std::chrono::steady_clock::now()};
+    bus_->publish();
+  } else {
+    logTick(currentTick_);
+    if (channel_) {
+      total_volume_ += currentTick_.volume;
+      channel_->publish({currentTick_, total_volume_});
+    } else {
+      deliver(currentTick_);
+    }
+  }
+
+  ++step_;
+  if (config_.checkpoint_interval != 0 &&
+      step_ % config_.checkpoint_interval == 0) {
+    if (bus_) {
+      bus_->drain();
+    }
+    checkpoint();
+  }
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+void Simulator<StrategyT, TickLoggerT>::logTick(const Tick& tick) {
+  if (auto err = logger_.writeTick(tick)) {
+    std::println(stderr, "{}", err.value());
+  }
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+void Simulator<StrategyT, TickLoggerT>::deliver(const Tick& tick) {
+  strategy_.onTick(tick);
+
+  if (config_.timer_interval > 0ns) {
+    while (next_timer_ <= tick.timestamp) {
+      strategy_.onTimer(next_timer_);
+      next_timer_ += config_.timer_interval;
+    }
+  }
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+BrownianBridge Simulator<StrategyT, TickLoggerT>::fastForward(
+    std::chrono::nanoseconds duration) {
+  const Tick start = currentTick_;
+  currentTick_.timestamp += duration;
+  // log-GBM increments are Gaussian for any dt, so one draw is exact
+  currentTick_.price = calculateGBM(duration);
+  if (path_) {
+    path_->reset(currentTick_, step_);
+  }
+  return BrownianBridge(start, currentTick_, config_.price_variation,
+                        config_.time_horizon, gen_());
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+void Simulator<StrategyT, TickLoggerT>::checkpoint() {
+  SnapshotWriter writer;
+  save(writer);
+  auto barriers = writer.takeBarriers();
+  checkpointer_.submit(std::move(writer).release(), std::move(barriers));
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+std::optional<std::string> Simulator<StrategyT, TickLoggerT>::LoadCheckpoint(
+    const std::filesystem::path& path) {
+  auto payload = ReadSnapshotFile(path);
+  if (!payload) {
+    return payload.error();
+  }
+
+  SnapshotReader reader(std::move(payload.value()));
+  if (auto err = load(reader)) {
+    return err;
+  }
+  if (!reader.ok() || !reader.atEnd()) {
+    return std::format("Snapshot: corrupted snapshot file {}", path.string());
+  }
+  return std::nullopt;
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+void Simulator<StrategyT, TickLoggerT>::save(SnapshotWriter& writer) const {
+  writer.write(step_);
+  writer.write(currentTick_);
+  writer.write(next_timer_);
+  writer.writeEngine(gen_);
+  writer.writeDistribution(norm_dist_);
+  if (path_) {
+    path_->save(writer);
+  }
+  logger_.save(writer);
+  strategy_.save(writer);
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+std::optional<std::string> Simulator<StrategyT, TickLoggerT>::load(
+    SnapshotReader& reader) {
+  reader.read(step_);
+  reader.read(currentTick_);
+  reader.read(next_timer_);
+  reader.readEngine(gen_);
+  reader.readDistribution(norm_dist_);
+  if (path_) {
+    path_->load(reader);
+  }
+  if (auto err = logger_.load(reader)) {
+    return err;
+  }
+  return strategy_.load(reader);
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+uint64_t Simulator<StrategyT, TickLoggerT>::getCurrentStep() const {
+  return step_;
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+PerformanceSummary Simulator<StrategyT, TickLoggerT>::getSummary() const {
+  auto summary = strategy_.getSummary();
+  if (channel_) {
+    summary.conflated_ticks = channel_->conflated();
+  }
+  if (bus_) {
+    const auto latency = bus_latency_.summarize();
+    summary.bus_ticks = latency.count;
+    summary.mean_bus_latency =
+        std::chrono::duration<double>(latency.mean).count();
+    summary.p99_bus_latency =
+        std::chrono::duration<double>(latency.p99).count();
+    summary.max_bus_latency =
+        std::chrono::duration<double>(latency.max).count();
+    summary.bus_batches = bus_batches_;
+  }
+  return summary;
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+const StrategyT& Simulator<StrategyT, TickLoggerT>::getStrategy() const {
+  return strategy_;
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+Price Simulator<StrategyT, TickLoggerT>::calculateGBM(
+    std::chrono::nanoseconds deltaT) {
+  double t_fraction = static_cast<double>(deltaT.count()) /
+                      static_cast<double>(config_.time_horizon.count());
+
+  double Z = norm_dist_(gen_);
+
+  double drift_term = (config_.average_trend_value -
+                       0.5 * std::pow(config_.price_variation, 2)) *
+                      t_fraction;
+
+  double diffusion_term = config_.price_variation * std::sqrt(t_fraction) * Z;
+
+  return currentTick_.price * std::exp(drift_term + diffusion_term);
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+std::chrono::nanoseconds Simulator<StrategyT, TickLoggerT>::getRandomDeltaT() {
+  using RepType = std::chrono::nanoseconds::rep;
+
+  std::uniform_int_distribution<RepType> time_dist(
+      config_.min_diff_time.count(), config_.max_diff_time.count());
+  RepType random_ticks = time_dist(gen_);
+
+  return std::chrono::nanoseconds(random_ticks);
+}
+
+template <Strategy StrategyT, TickSink TickLoggerT>
+double Simulator<StrategyT, TickLoggerT>::getRandomVolume() {
+  std::uniform_real_distribution<double> volume_dist(config_.min_volume,
+                                                     config_.max_volume);
+  return volume_dist(gen_);
+}
+
 #endif  // TRADINGSIMULATOR_SIMULATOR_H
@@ -0,0 +1,61 @@
+#include "AlphaTable.h"
+
+#include <cmath>
+
+AlphaTable::AlphaTable(std::chrono::nanoseconds period,
+                       std::chrono::nanoseconds min_dt,
+                       std::chrono::nanoseconds max_dt,
+                       std::chrono::nanoseconds step, AlphaTableMode mode)
+    : min_dt_(min_dt),
+      max_dt_(max_dt),
+      inv_step_(1.0 / static_cast<double>(step.count())),
+      mode_(mode) {
+  const double neg_inv_tau =
+      -1.0 / std::chrono::duration<double>(period).count();
+
+  // One entry past max_dt, so the last interval can always interpolate
+  const size_t size = static_cast<size_t>((max_dt - min_dt) / step) + 2;
+  alpha_.resize(size);
+  for (size_t i = 0; i < size; ++i) {
+    const auto dt = min_dt + static_cast<int64_t>(i) * step;
+    const double dt_sec = std::chrono::duration<double>(dt).count();
+    alpha_[i] = 1.0 - std::exp(dt_sec * neg_inv_tau);
+  }
+
+  if (mode == AlphaTableMode::Linear) {
+    slope_.resize(size);
+    for (size_t i = 0; i + 1 < size; ++i) {
+      slope_[i] = alpha_[i + 1] - alpha_[i];
+    }
+  }
+}
+
+std::optional<AlphaTable> AlphaTable::FromConfig(
+    const Config& config, std::chrono::nanoseconds period) {
+  if (config.alpha_table == AlphaTableMode::Off) return std::nullopt;
+  return AlphaTable(period, config.min_diff_time, config.max_diff_time,
+                    config.alpha_table_step, config.alpha_table);
+}
+
+double AlphaTable::ErrorBound(std::chrono::nanoseconds period,
+                              std::chrono::nanoseconds min_dt,
+                              std::chrono::nanoseconds step,
+                              AlphaTableMode mode) {
+  const double tau = std::chrono::duration<double>(period).count();
+  const double h = std::chrono::duration<double>(step).count();
+  // |alpha'(dt)| = e^(-dt/tau) / tau, |alpha''(dt)| = e^(-dt/tau) / tau^2
+  const double decay =
+      std::exp(-std::chrono::duration<double>(min_dt).count() / tau);
+
+  switch (mode) {
+    case AlphaTableMode::Off:
+      return 0;
+    case AlphaTableMode::Nearest:
+      return decay / tau * h / 2;
+    case AlphaTableMode::Linear:
+      return decay / (tau * tau) * h * h / 8;
+  }
+  return 0;
+}
+
+size_t AlphaTable::size() const { return alpha_.size(); }
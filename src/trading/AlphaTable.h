@@ -0,0 +1,55 @@
+#ifndef TRADINGSIMULATOR_ALPHATABLE_H
+#define TRADINGSIMULATOR_ALPHATABLE_H
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "config/Config.h"
+
+// Precomputed EMA weights alpha(dt) = 1 - e^(-dt / tau) for one period,
+// sampled every `step` over [min_dt, max_dt]. Intervals outside that range
+// return std::nullopt and the caller falls back to std::exp.
+class AlphaTable {
+ public:
+  AlphaTable(std::chrono::nanoseconds period, std::chrono::nanoseconds min_dt,
+             std::chrono::nanoseconds max_dt, std::chrono::nanoseconds step,
+             AlphaTableMode mode);
+
+  // Table for `period` over the simulator's tick interval range, or
+  // std::nullopt when the table is disabled in the config.
+  static std::optional<AlphaTable> FromConfig(const Config& config,
+                                              std::chrono::nanoseconds period);
+
+  // Largest |table alpha - exact alpha| over [min_dt, max_dt]: half a step
+  // times the steepest slope for Nearest, step^2 / 8 times the largest
+  // curvature for Linear. Both extremes are at min_dt.
+  static double ErrorBound(std::chrono::nanoseconds period,
+                           std::chrono::nanoseconds min_dt,
+                           std::chrono::nanoseconds step, AlphaTableMode mode);
+
+  std::optional<double> lookup(std::chrono::nanoseconds dt) const {
+    if (dt < min_dt_ || dt > max_dt_) return std::nullopt;
+    const double position =
+        static_cast<double>((dt - min_dt_).count()) * inv_step_;
+    if (mode_ == AlphaTableMode::Nearest) {
+      return alpha_[static_cast<size_t>(position + 0.5)];
+    }
+    const auto index = static_cast<size_t>(position);
+    const double fraction = position - static_cast<double>(index);
+    return alpha_[index] + fraction * slope_[index];
+  }
+
+  [[nodiscard]] size_t size() const;
+
+ private:
+  std::chrono::nanoseconds min_dt_;
+  std::chrono::nanoseconds max_dt_;
+  double inv_step_;
+  AlphaTableMode mode_;
+  std::vector<double> alpha_;
+  std::vector<double> slope_;  // alpha_[i + 1] - alpha_[i], Linear only
+};
+
+#endif  // TRADINGSIMULATOR_ALPHATABLE_H
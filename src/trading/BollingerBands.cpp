@@ -0,0 +1,84 @@
+#include "BollingerBands.h"
+
+#include <algorithm>
+#include <cmath>
+
+BollingerBands::BollingerBands(std::chrono::nanoseconds window,
+                               std::chrono::nanoseconds min_tick_interval,
+                               double width)
+    : window_(window),
+      width_(width),
+      samples_(WindowCapacity(window, min_tick_interval)) {}
+
+Bands BollingerBands::update(const Tick& tick) {
+  if (samples_.empty()) {
+    // Nothing to carry over: start the sums afresh around this price
+    shift_ = tick.price;
+    sum_ = 0;
+    sum_sq_ = 0;
+    updates_since_shift_ = 0;
+  }
+
+  const double deviation = tick.price - shift_;
+  samples_.push_back({tick.timestamp, tick.price});
+  sum_ += deviation;
+  sum_sq_ += deviation * deviation;
+
+  const auto expired = tick.timestamp - window_;
+  while (!samples_.empty() && samples_.front().timestamp <= expired) {
+    const double old = samples_.front().price - shift_;
+    sum_ -= old;
+    sum_sq_ -= old * old;
+    samples_.pop_front();
+  }
+
+  if (++updates_since_shift_ >= samples_.capacity()) {
+    recentre();
+  }
+  return getBands();
+}
+
+// O(window) once per window of ticks; summing afresh also drops the
+// rounding the sums have accumulated.
+void BollingerBands::recentre() {
+  updates_since_shift_ = 0;
+  if (samples_.empty()) return;
+
+  shift_ += sum_ / static_cast<double>(samples_.size());
+  sum_ = 0;
+  sum_sq_ = 0;
+  for (size_t i = 0; i < samples_.size(); ++i) {
+    const double deviation = samples_[i].price - shift_;
+    sum_ += deviation;
+    sum_sq_ += deviation * deviation;
+  }
+}
+
+Bands BollingerBands::getBands() const {
+  if (samples_.empty()) return {0, 0, 0};
+
+  const double n = static_cast<double>(samples_.size());
+  const double mean = sum_ / n;
+  const double variance = std::max(0.0, sum_sq_ / n - mean * mean);
+  const double band = width_ * std::sqrt(variance);
+  const Price middle = shift_ + mean;
+  return {middle - band, middle, middle + band};
+}
+
+void BollingerBands::save(SnapshotWriter& writer) const {
+  writer.write(sum_);
+  writer.write(sum_sq_);
+  writer.write(shift_);
+  writer.write(static_cast<uint64_t>(updates_since_shift_));
+  samples_.save(writer);
+}
+
+void BollingerBands::load(SnapshotReader& reader) {
+  uint64_t updates_since_shift = 0;
+  reader.read(sum_);
+  reader.read(sum_sq_);
+  reader.read(shift_);
+  reader.read(updates_since_shift);
+  samples_.load(reader);
+  updates_since_shift_ = updates_since_shift;
+}
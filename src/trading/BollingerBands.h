@@ -0,0 +1,51 @@
+#ifndef TRADINGSIMULATOR_BOLLINGERBANDS_H
+#define TRADINGSIMULATOR_BOLLINGERBANDS_H
+
+#include <chrono>
+
+#include "common/RingBuffer.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+
+struct Bands {
+  Price lower;
+  Price middle;
+  Price upper;
+};
+
+// Moving average of the prices inside (now - window, now] plus/minus
+// `width` population standard deviations.
+class BollingerBands {
+ public:
+  BollingerBands(std::chrono::nanoseconds window,
+                 std::chrono::nanoseconds min_tick_interval,
+                 double width = 2.0);
+  Bands update(const Tick& tick);
+
+  [[nodiscard]] Bands getBands() const;
+
+  void save(SnapshotWriter& writer) const;
+  void load(SnapshotReader& reader);
+
+ private:
+  void recentre();
+
+  struct Sample {
+    std::chrono::nanoseconds timestamp;
+    Price price;
+  };
+
+  std::chrono::nanoseconds window_;
+  double width_;
+  RingBuffer<Sample> samples_;
+  // Sums are taken over price - shift_, which keeps sum_sq_ - sum_^2 / n
+  // from cancelling catastrophically at high prices. shift_ starts at the
+  // first price and is re-centred on the mean every window's worth of
+  // ticks, so it stays close however far the price drifts.
+  Price shift_ = 0;
+  double sum_ = 0;
+  double sum_sq_ = 0;
+  size_t updates_since_shift_ = 0;
+};
+
+#endif  // TRADINGSIMULATOR_BOLLINGERBANDS_H
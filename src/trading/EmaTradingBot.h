@@ -9,16 +9,85 @@ using namespace std::chrono_literals;
 
 enum class IndicatorHigher { Fast, Slow, None };
 
+template <OrderSink Logger = OrderLogger, Exchange ExchangeT = ExchangeApi>
 class EmaTradingBot {
  public:
   explicit EmaTradingBot(const Config& config);
   void onTick(const Tick& tick);
+  // The crossover logic is purely tick-driven; replies are already booked
+  // by the order manager, which calls onReply() directly, and there is no
+  // periodic work.
+  void onReply(OrderIdentifier id, Status status);
+  void onTimer(std::chrono::nanoseconds now);
+
+  [[nodiscard]] PerformanceSummary getSummary() const;
+
+  void save(SnapshotWriter& writer) const;
+  std::optional<std::string> load(SnapshotReader& reader);
 
  private:
   IndicatorHigher higher_ema_ = IndicatorHigher::None;
   TimeEMA fast_ema_;
   TimeEMA slow_ema_;
-  OrderManager order_manager_;
+  OrderManager<Logger, ExchangeT, EmaTradingBot> order_manager_;
 };
 
+template <OrderSink Logger, Exchange ExchangeT>
+EmaTradingBot<Logger, ExchangeT>::EmaTradingBot(const Config& config)
+    : fast_ema_(config.fast_ema,
+                AlphaTable::FromConfig(config, config.fast_ema)),
+      slow_ema_(config.slow_ema,
+                AlphaTable::FromConfig(config, config.slow_ema)),
+      order_manager_(config) {
+  order_manager_.setReplyListener(*this);
+}
+
+template <OrderSink Logger, Exchange ExchangeT>
+void EmaTradingBot<Logger, ExchangeT>::onTick(const Tick& tick) {
+  order_manager_.onTick(tick);
+  slow_ema_.update(tick);
+  fast_ema_.update(tick);
+
+  if (fast_ema_.getCurrentPrice() > slow_ema_.getCurrentPrice()) {
+    if (higher_ema_ == IndicatorHigher::Slow) {
+      order_manager_.onBuySignal(tick.price, tick.volume);
+    }
+    higher_ema_ = IndicatorHigher::Fast;
+    return;
+  }
+
+  if (higher_ema_ == IndicatorHigher::Fast) {
+    order_manager_.onSellSignal(tick.price, tick.volume);
+  }
+  higher_ema_ = IndicatorHigher::Slow;
+}
+
+template <OrderSink Logger, Exchange ExchangeT>
+void EmaTradingBot<Logger, ExchangeT>::onReply(OrderIdentifier, Status) {}
+
+template <OrderSink Logger, Exchange ExchangeT>
+void EmaTradingBot<Logger, ExchangeT>::onTimer(std::chrono::nanoseconds) {}
+
+template <OrderSink Logger, Exchange ExchangeT>
+PerformanceSummary EmaTradingBot<Logger, ExchangeT>::getSummary() const {
+  return order_manager_.getSummary();
+}
+
+template <OrderSink Logger, Exchange ExchangeT>
+void EmaTradingBot<Logger, ExchangeT>::save(SnapshotWriter& writer) const {
+  writer.write(higher_ema_);
+  fast_ema_.save(writer);
+  slow_ema_.save(writer);
+  order_manager_.save(writer);
+}
+
+template <OrderSink Logger, Exchange ExchangeT>
+std::optional<std::string> EmaTradingBot<Logger, ExchangeT>::load(
+    SnapshotReader& reader) {
+  reader.read(higher_ema_);
+  fast_ema_.load(reader);
+  slow_ema_.load(reader);
+  return order_manager_.load(reader);
+}
+
 #endif  // TRADINGSIMULATOR_TRADINGBOT_H
@@ -0,0 +1,51 @@
+#ifndef TRADINGSIMULATOR_EXCHANGE_H
+#define TRADINGSIMULATOR_EXCHANGE_H
+
+#include <chrono>
+#include <concepts>
+#include <span>
+
+#include "ExchangeApi.h"
+#include "common/LatencyHistogram.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+#include "config/Config.h"
+
+// Venue interface OrderManager routes orders to, built from the run's
+// Config. Replies are delivered through the callback when poll() is called.
+// sendOrders() sends a basket under consecutive ids, starting from the one
+// it returns.
+template <typename T>
+concept Exchange = std::constructible_from<T, const Config&> &&
+                   requires(T exchange, const T& const_exchange,
+                            const Order& order, std::span<const Order> orders,
+                            ExchangeCallback cb,
+                            SnapshotWriter& writer, SnapshotReader& reader) {
+  { exchange.sendOrder(order, cb) } -> std::same_as<OrderIdentifier>;
+  { exchange.sendOrders(orders, cb) } -> std::same_as<OrderIdentifier>;
+  exchange.poll();
+  const_exchange.save(writer);
+  exchange.load(reader, cb);
+  { const_exchange.getRoundTripStats() } -> std::same_as<LatencyStats>;
+};
+
+// Venue that also keeps orders resting on its book (see ExchangeApi): they
+// are cancelled and replaced by id and fill against the ticks it is shown.
+// Only the in-process ExchangeApi qualifies; the remote and shared venues
+// answer every order at once.
+template <typename T>
+concept RestingExchange =
+    Exchange<T> &&
+    requires(T exchange, const Order& order, OrderIdentifier id, Price price,
+             Volume volume, std::chrono::nanoseconds expires_at,
+             const Tick& tick, ReportCallback cb) {
+      exchange.setReportCallback(cb);
+      {
+        exchange.placeOrder(order, expires_at)
+      } -> std::same_as<OrderIdentifier>;
+      exchange.cancelOrder(id);
+      exchange.replaceOrder(id, price, volume);
+      exchange.onMarket(tick);
+    };
+
+#endif  // TRADINGSIMULATOR_EXCHANGE_H
@@ -1,28 +1,238 @@
 #include "ExchangeApi.h"
-ExchangeApi::ExchangeApi(double rejection_percent)
-    : rejection_percent_(rejection_percent), rng_(std::random_device{}()) {}
+
+#include <algorithm>
+
+namespace {
+
+std::string_view ReasonText(uint8_t reason) {
+  constexpr std::string_view kTexts[] = {"", "Random rejection",
+                                         "Too late to cancel",
+                                         "Too late to replace",
+                                         "Replace below filled volume"};
+  return kTexts[reason];
+}
+
+}  // namespace
+
+ExchangeApi::ExchangeApi(double rejection_percent, uint64_t seed)
+    : rejection_percent_(rejection_percent),
+      rng_(seed == 0 ? std::random_device{}()
+                     : static_cast<std::mt19937::result_type>(seed)) {}
+
+ExchangeApi::ExchangeApi(const Config& config)
+    : ExchangeApi(config.rejection_probability,
+                  config.seed == 0 ? 0 : config.seed + 1) {}
 
 OrderIdentifier ExchangeApi::sendOrder(const Order& order,
                                        ExchangeCallback cb) {
-  const OrderIdentifier current_id = nextId_++;
+  return sendOrders(std::span(&order, 1), std::move(cb));
+}
+
+OrderIdentifier ExchangeApi::sendOrders(std::span<const Order> orders,
+                                        ExchangeCallback cb) {
+  const OrderIdentifier first_id = nextId_;
+  const auto callback = static_cast<uint32_t>(callbacks_.size());
+  callbacks_.push_back(std::move(cb));
+
+  for (size_t i = 0; i < orders.size(); ++i) {
+    const Status rp_status =
+        drawRejection() ? Status::Rejected : Status::Executed;
+    pending_events_.push_back(
+        {.id = nextId_++, .reply_status = rp_status, .callback = callback});
+  }
+
+  return first_id;
+}
 
+bool ExchangeApi::drawRejection() {
   std::uniform_real_distribution<double> dist(0.0, 100.0);
-  const Status rp_status =
-      dist(rng_) < rejection_percent_ ? Status::Rejected : Status::Executed;
+  return dist(rng_) < rejection_percent_;
+}
 
-  pending_events_.push_back(
-      {.id = current_id, .reply_status = rp_status, .cb = std::move(cb)});
+void ExchangeApi::setReportCallback(ReportCallback cb) {
+  report_cb_ = std::move(cb);
+}
 
-  return current_id;
+OrderIdentifier ExchangeApi::placeOrder(const Order& order,
+                                        std::chrono::nanoseconds expires_at) {
+  const RestingOrder resting{.id = nextId_++,
+                             .order = order,
+                             .filled = 0,
+                             .expires_at = expires_at,
+                             .live = true};
+  if (drawRejection()) {
+    queueReport(resting, Status::Rejected, 0, ReportReason::RandomRejection);
+    return resting.id;
+  }
+  resting_index_.emplace(resting.id, resting_.size());
+  resting_.push_back(resting);
+  queueReport(resting, Status::Acked, 0);
+  return resting.id;
+}
+
+void ExchangeApi::cancelOrder(OrderIdentifier id) {
+  const auto it = resting_index_.find(id);
+  if (it == resting_index_.end()) {
+    reports_.push_back({.id = id,
+                        .status = Status::Rejected,
+                        .price = 0,
+                        .filled = 0,
+                        .leaves = 0,
+                        .reason = ReportReason::TooLateToCancel});
+    return;
+  }
+  const size_t index = it->second;
+  queueReport(resting_[index], Status::Cancelled, 0);
+  retire(index);
+}
+
+void ExchangeApi::replaceOrder(OrderIdentifier id, Price price,
+                               Volume volume) {
+  const auto it = resting_index_.find(id);
+  if (it == resting_index_.end()) {
+    reports_.push_back({.id = id,
+                        .status = Status::Rejected,
+                        .price = 0,
+                        .filled = 0,
+                        .leaves = 0,
+                        .reason = ReportReason::TooLateToReplace});
+    return;
+  }
+  RestingOrder& resting = resting_[it->second];
+  if (volume <= resting.filled || isVolumeEqual(volume, resting.filled)) {
+    queueReport(resting, Status::Rejected, 0, ReportReason::BelowFilled);
+    return;
+  }
+  resting.order.price = price;
+  resting.order.volume = volume;
+  queueReport(resting, Status::Replaced, 0);
+}
+
+void ExchangeApi::onMarket(const Tick& tick) {
+  Volume liquidity = tick.volume;
+  size_t kept = 0;
+  for (size_t i = 0; i < resting_.size(); ++i) {
+    RestingOrder& resting = resting_[i];
+    if (resting.live && resting.expires_at.count() != 0 &&
+        tick.timestamp >= resting.expires_at) {
+      queueReport(resting, Status::Expired, 0);
+      retire(i);
+    }
+    const bool marketable = resting.order.side == OrderSide::Buy
+                                ? tick.price <= resting.order.price
+                                : tick.price >= resting.order.price;
+    if (resting.live && marketable && liquidity > 0) {
+      const Volume fill =
+          std::min(resting.order.volume - resting.filled, liquidity);
+      liquidity -= fill;
+      resting.filled += fill;
+      const bool done = isVolumeEqual(resting.filled, resting.order.volume);
+      queueReport(resting, done ? Status::Executed : Status::PartiallyFilled,
+                  fill);
+      if (done) retire(i);
+    }
+    if (!resting.live) continue;
+    if (kept != i) {
+      resting_[kept] = resting;
+      resting_index_[resting.id] = kept;
+    }
+    ++kept;
+  }
+  resting_.resize(kept);
+}
+
+void ExchangeApi::retire(size_t index) {
+  resting_index_.erase(resting_[index].id);
+  resting_[index].live = false;
+}
+
+void ExchangeApi::queueReport(const RestingOrder& resting, Status status,
+                              Volume filled, ReportReason reason) {
+  reports_.push_back({.id = resting.id,
+                      .status = status,
+                      .price = resting.order.price,
+                      .filled = filled,
+                      .leaves = status == Status::Rejected
+                                    ? 0
+                                    : resting.order.volume - resting.filled,
+                      .reason = reason});
 }
 
 void ExchangeApi::poll() {
-  for (const auto& [id, reply_status, cb] : pending_events_) {
-    if (cb) {
+  for (const auto& [id, reply_status, callback] : pending_events_) {
+    if (const auto& cb = callbacks_[callback]) {
       cb(id, reply_status,
          reply_status == Status::Rejected ? "Random rejection" : "");
     }
   }
 
   pending_events_.clear();
-}
\ No newline at end of file
+  callbacks_.clear();
+
+  for (const auto& report : reports_) {
+    if (report_cb_) {
+      report_cb_({.id = report.id,
+                  .status = report.status,
+                  .price = report.price,
+                  .filled = report.filled,
+                  .leaves = report.leaves,
+                  .text = ReasonText(static_cast<uint8_t>(report.reason))});
+    }
+  }
+  reports_.clear();
+}
+
+void ExchangeApi::save(SnapshotWriter& writer) const {
+  writer.write(nextId_);
+  writer.writeEngine(rng_);
+  writer.write(static_cast<uint64_t>(pending_events_.size()));
+  for (const auto& event : pending_events_) {
+    writer.write(event.id);
+    writer.write(event.reply_status);
+  }
+  writer.write(static_cast<uint64_t>(resting_index_.size()));
+  for (const auto& resting : resting_) {
+    if (resting.live) writer.write(resting);
+  }
+  writer.write(static_cast<uint64_t>(reports_.size()));
+  for (const auto& report : reports_) {
+    writer.write(report);
+  }
+}
+
+void ExchangeApi::load(SnapshotReader& reader, const ExchangeCallback& cb) {
+  reader.read(nextId_);
+  reader.readEngine(rng_);
+
+  uint64_t pending_count = 0;
+  reader.read(pending_count);
+  pending_events_.clear();
+  callbacks_.assign(1, cb);
+  for (uint64_t i = 0; i < pending_count && reader.ok(); ++i) {
+    PendingEvent event{
+        .id = 0, .reply_status = Status::Pending, .callback = 0};
+    reader.read(event.id);
+    reader.read(event.reply_status);
+    pending_events_.push_back(event);
+  }
+
+  uint64_t resting_count = 0;
+  reader.read(resting_count);
+  resting_.clear();
+  resting_index_.clear();
+  for (uint64_t i = 0; i < resting_count && reader.ok(); ++i) {
+    RestingOrder resting{};
+    reader.read(resting);
+    resting_index_.emplace(resting.id, resting_.size());
+    resting_.push_back(resting);
+  }
+
+  uint64_t reports_count = 0;
+  reader.read(reports_count);
+  reports_.clear();
+  for (uint64_t i = 0; i < reports_count && reader.ok(); ++i) {
+    QueuedReport report{};
+    reader.read(report);
+    reports_.push_back(report);
+  }
+}
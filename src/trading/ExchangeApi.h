@@ -1,30 +1,126 @@
 #ifndef TRADINGSIMULATOR_EXCHANGEAPI_H
 #define TRADINGSIMULATOR_EXCHANGEAPI_H
 
+#include <chrono>
 #include <functional>
 #include <random>
+#include <span>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
+#include "common/LatencyHistogram.h"
+#include "common/Snapshot.h"
 #include "common/Types.h"
+#include "config/Config.h"
 
 using ExchangeCallback =
     std::function<void(OrderIdentifier, Status, std::string_view)>;
 
+// One event in the life of a resting order
+struct ExecutionReport {
+  OrderIdentifier id;
+  Status status;
+  Price price;    // of the fill; the limit price for any other event
+  Volume filled;  // by this event, 0 unless it is a fill
+  Volume leaves;  // still resting after it
+  std::string_view text;
+};
+
+using ReportCallback = std::function<void(const ExecutionReport&)>;
+
 class ExchangeApi {
  public:
-  explicit ExchangeApi(double rejection_percent);
+  // A zero seed draws one from std::random_device.
+  explicit ExchangeApi(double rejection_percent, uint64_t seed = 0);
+  // Seeded from config.seed + 1, apart from the price path
+  explicit ExchangeApi(const Config& config);
   OrderIdentifier sendOrder(const Order& order, ExchangeCallback cb);
+  // Sends a basket: the orders get consecutive ids starting from the one
+  // returned, their fates are drawn in one pass over the generator (the
+  // same draws as sending them one by one) and the next poll() answers all
+  // of them through one shared callback
+  OrderIdentifier sendOrders(std::span<const Order> orders,
+                             ExchangeCallback cb);
+
+  // Resting orders. placeOrder() answers Acked or Rejected; the order then
+  // rests at its limit price and fills against the ticks passed to
+  // onMarket(): a buy when the tick trades at or below the limit, a sell at
+  // or above, for at most the tick's volume, which orders earlier in the
+  // book use up first. It expires on the first tick at or after
+  // `expires_at` (0 - never). Cancel and replace are answered Cancelled or
+  // Replaced, or Rejected once the order is done; replace amends the order
+  // in place, keeping its id and place in the book, with `volume` the new
+  // total quantity.
+  // Every call costs O(1) apart from onMarket(), which walks the book.
+  // Reports are queued and delivered by poll() to the callback set here.
+  void setReportCallback(ReportCallback cb);
+  OrderIdentifier placeOrder(const Order& order,
+                             std::chrono::nanoseconds expires_at = {});
+  void cancelOrder(OrderIdentifier id);
+  void replaceOrder(OrderIdentifier id, Price price, Volume volume);
+  void onMarket(const Tick& tick);
 
   void poll();
 
+  // Callbacks cannot be serialized, so replies still pending at snapshot time
+  // are re-attached to `cb` on load.
+  void save(SnapshotWriter& writer) const;
+  void load(SnapshotReader& reader, const ExchangeCallback& cb);
+
+  // Replies are decided in the call itself: nothing to measure
+  [[nodiscard]] LatencyStats getRoundTripStats() const { return {}; }
+
  private:
   struct PendingEvent {
     OrderIdentifier id;
     Status reply_status;
-    ExchangeCallback cb;
+    uint32_t callback;  // index into callbacks_
+  };
+
+  // Kept apart from ExecutionReport so a snapshot can store it: the text is
+  // looked up from the reason when the report is delivered
+  enum class ReportReason : uint8_t {
+    None,
+    RandomRejection,
+    TooLateToCancel,
+    TooLateToReplace,
+    BelowFilled
   };
 
+  struct QueuedReport {
+    OrderIdentifier id;
+    Status status;
+    Price price;
+    Volume filled;
+    Volume leaves;
+    ReportReason reason;
+  };
+
+  struct RestingOrder {
+    OrderIdentifier id;
+    Order order;
+    Volume filled;
+    std::chrono::nanoseconds expires_at;
+    bool live;
+  };
+
+  // Takes the order at `index` out of the book; onMarket() drops the slot
+  void retire(size_t index);
+  void queueReport(const RestingOrder& resting, Status status, Volume filled,
+                   ReportReason reason = ReportReason::None);
+  bool drawRejection();
+
   std::vector<PendingEvent> pending_events_;
+  // One per sendOrder() or sendOrders() call since the last poll()
+  std::vector<ExchangeCallback> callbacks_;
+  // Resting orders in arrival order, which is the order they fill in, and
+  // where each live one sits. Orders that leave between ticks stay as dead
+  // slots until the next onMarket() compacts the book.
+  std::vector<RestingOrder> resting_;
+  std::unordered_map<OrderIdentifier, size_t> resting_index_;
+  std::vector<QueuedReport> reports_;
+  ReportCallback report_cb_;
   double rejection_percent_;
   std::mt19937 rng_;
   OrderIdentifier nextId_ = 1;
@@ -1,35 +1,624 @@
 #ifndef TRADINGSIMULATOR_ORDERMANAGER_H
 #define TRADINGSIMULATOR_ORDERMANAGER_H
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
+#include "Exchange.h"
 #include "ExchangeApi.h"
+#include "PerformanceStats.h"
+#include "RiskEngine.h"
 #include "common/Types.h"
+#include "logs/LogSink.h"
+#include "logs/NullLogger.h"
 #include "logs/OrderLogger.h"
+#include "venue/RemoteExchange.h"
+#include "venue/SharedVenue.h"
 
+// Listener of an OrderManager whose owner does not react to replies
+struct NoReplyListener {
+  void onReply(OrderIdentifier, Status) {}
+};
+
+// What one of the strategies sharing an OrderManager through SubmitIntent()
+// holds; its PnL at a price is cash + position * price
+struct StrategyBook {
+  Volume position = 0;
+  Price cash = 0;
+  uint64_t refused = 0;  // residual orders the risk checks kept back
+};
+
+// Listener's onReply(id, status) is called directly after each reply has
+// been booked, so it inlines into the reply handling; it runs inside the
+// exchange's poll(), so it must not send orders itself.
+template <OrderSink Logger = OrderLogger, Exchange ExchangeT = ExchangeApi,
+          typename Listener = NoReplyListener>
 class OrderManager : IHandler {
  public:
   explicit OrderManager(const Config& config);
   ~OrderManager() override;
 
+  // Orders pass the pre-trade checks of RiskEngine first; one they refuse
+  // is logged as rejected and never sent, and the call returns 0.
   OrderIdentifier SendOrder(const Order& order);
+  // Sends a basket (e.g. the legs of a spread) with one exchange call and
+  // one poll. The orders get consecutive ids starting from the returned
+  // one, 0 for an empty basket or one with a leg the risk checks refuse;
+  // every reply is booked before returning.
+  OrderIdentifier SendOrders(std::span<const Order> orders);
+
+  // Resting orders, on venues that keep them. The order rests at its limit
+  // price until it is filled, cancelled, or has rested for `time_in_force`
+  // of simulated time (0 - until cancelled); each fill is booked as the
+  // ticks passed to onTick() reach the price. Cancel and replace return
+  // false for ids no longer resting, replace also when `volume`, the new
+  // total quantity, is not above the filled one or the risk checks refuse
+  // it; it amends the record in place. Every call is answered before it
+  // returns.
+  OrderIdentifier PlaceOrder(const Order& order,
+                             std::chrono::nanoseconds time_in_force = {})
+    requires RestingExchange<ExchangeT>;
+  bool CancelOrder(OrderIdentifier id)
+    requires RestingExchange<ExchangeT>;
+  bool ReplaceOrder(OrderIdentifier id, Price price, Volume volume)
+    requires RestingExchange<ExchangeT>;
+
+  // Netting for several strategies trading one symbol through this
+  // manager, numbered from 0. SubmitIntent() only queues an order;
+  // FlushIntents(), called once the strategies have reacted to a tick,
+  // crosses buys against other strategies' sells at or below their price,
+  // in submission order, at the midpoint of the two prices and sends what
+  // is left as one basket, returning the number of orders sent. Each
+  // residual order passes the risk checks on its own; a refused one is
+  // logged, counted in its owner's book and left out of the basket.
+  // Crosses move no firm position and reach neither the exchange nor the
+  // order log; each strategy's book takes its crosses and its share of the
+  // fills.
+  void SubmitIntent(uint32_t strategy, const Order& order);
+  size_t FlushIntents();
+  [[nodiscard]] StrategyBook getStrategyBook(uint32_t strategy) const;
 
   void onBuySignal(Price price, Volume volume);
   void onSellSignal(Price price, Volume volume);
 
+  // Marks the position to market for the run statistics and the max-loss
+  // check, after matching resting orders against the tick.
+  void onTick(const Tick& tick);
+  [[nodiscard]] PerformanceSummary getSummary() const;
+
+  void setReplyListener(Listener& listener);
+
+  void save(SnapshotWriter& writer) const;
+  std::optional<std::string> load(SnapshotReader& reader);
+
  private:
   void HandleRequestReply(OrderIdentifier id, Status reply_status,
                           std::string_view reply_error) override;
+  ExchangeCallback replyCallback();
+  // Runs the risk checks, logging a refusal; `replacing` as in
+  // RiskEngine::check()
+  bool admit(const Order& order, Volume replacing = 0);
+  // SendOrders() without the poll
+  OrderIdentifier submitBasket(std::span<const Order> orders);
+  // Sends orders that have passed admit() as one basket, without the poll
+  OrderIdentifier sendAdmitted(std::span<const Order> orders);
+  void bookStrategy(uint32_t strategy, OrderSide side, Price price,
+                    Volume volume);
+  void HandleReport(const ExecutionReport& report);
   void fixOrder(OrderSide ordSide, Price price, Volume volume);
   [[nodiscard]] Price getTotalPnL(Price currentMarketPrice) const;
 
-  ExchangeApi exchange_api_;
+  ExchangeT exchange_api_;
   std::unordered_map<OrderIdentifier, Order> orders_;
-  OrderLogger logger_;
+
+  struct RestingRecord {
+    Order order;  // volume is the total quantity, filled or not
+    Volume filled;
+    bool acked;
+  };
+  std::unordered_map<OrderIdentifier, RestingRecord> resting_;
+  std::chrono::nanoseconds now_{0};  // of the last tick
+
+  struct Intent {
+    uint32_t strategy;
+    Order order;
+  };
+  std::vector<Intent> intents_;  // since the last FlushIntents()
+  std::vector<StrategyBook> strategy_books_;
+  // Scratch of FlushIntents(), kept to reuse the allocations
+  std::vector<size_t> intent_buys_;
+  std::vector<size_t> intent_sells_;
+  std::vector<Order> residual_;
+  // Owner of each leg of the residual basket while its replies come in
+  std::vector<uint32_t> residual_owners_;
+  OrderIdentifier residual_first_id_ = 0;
+  uint64_t intents_count_ = 0;
+  uint64_t crossed_intents_ = 0;  // crossed in full, never sent
+  Volume crossed_volume_ = 0;
+  Logger logger_;
+  PerformanceStats stats_;
+  Listener* reply_listener_ = nullptr;
   Price pnl_ = 0;
   Volume current_position_ = 0;
-
-  Volume min_position_;
-  Volume max_position_;
+  RiskEngine risk_;
 };
 
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+OrderManager<Logger, ExchangeT, Listener>::OrderManager(const Config& config)
+    : exchange_api_(config),
+      logger_(config),
+      risk_(config) {
+  if constexpr (RestingExchange<ExchangeT>) {
+    exchange_api_.setReportCallback(
+        [this](const ExecutionReport& report) { HandleReport(report); });
+  }
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+OrderManager<Logger, ExchangeT, Listener>::~OrderManager() = default;
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+Price OrderManager<Logger, ExchangeT, Listener>::getTotalPnL(
+    Price currentMarketPrice) const {
+  return pnl_ + currentMarketPrice * current_position_;
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+OrderIdentifier OrderManager<Logger, ExchangeT, Listener>::SendOrder(
+    const Order& order) {
+  if (!admit(order)) return 0;
+  risk_.onSent(order.side, order.volume);
+  auto order_id = exchange_api_.sendOrder(order, replyCallback());
+  orders_[order_id] = order;
+  exchange_api_.poll();
+  return order_id;
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+OrderIdentifier OrderManager<Logger, ExchangeT, Listener>::SendOrders(
+    std::span<const Order> orders) {
+  const auto first_id = submitBasket(orders);
+  if (first_id != 0) exchange_api_.poll();
+  return first_id;
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+OrderIdentifier OrderManager<Logger, ExchangeT, Listener>::submitBasket(
+    std::span<const Order> orders) {
+  if (orders.empty()) return 0;
+  for (size_t i = 0; i < orders.size(); ++i) {
+    if (!admit(orders[i])) {
+      for (size_t sent = 0; sent < i; ++sent) {
+        risk_.onUnsent(orders[sent].side, orders[sent].volume);
+      }
+      return 0;
+    }
+    risk_.onSent(orders[i].side, orders[i].volume);
+  }
+  return sendAdmitted(orders);
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+OrderIdentifier OrderManager<Logger, ExchangeT, Listener>::sendAdmitted(
+    std::span<const Order> orders) {
+  const auto first_id = exchange_api_.sendOrders(orders, replyCallback());
+  for (size_t i = 0; i < orders.size(); ++i) {
+    orders_[first_id + i] = orders[i];
+  }
+  return first_id;
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+void OrderManager<Logger, ExchangeT, Listener>::SubmitIntent(
+    uint32_t strategy, const Order& order) {
+  if (strategy >= strategy_books_.size()) {
+    strategy_books_.resize(strategy + 1);
+  }
+  intents_.push_back({.strategy = strategy, .order = order});
+  ++intents_count_;
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+size_t OrderManager<Logger, ExchangeT, Listener>::FlushIntents() {
+  intent_buys_.clear();
+  intent_sells_.clear();
+  for (size_t i = 0; i < intents_.size(); ++i) {
+    auto& side = intents_[i].order.side == OrderSide::Buy ? intent_buys_
+                                                           : intent_sells_;
+    side.push_back(i);
+  }
+
+  // A buy crosses only sells at or below its price, so neither side gets
+  // a worse price than its own order, and never a sell of its own strategy,
+  // which would only wash; the rest go to the exchange
+  for (const size_t buy : intent_buys_) {
+    Intent& buyer = intents_[buy];
+    for (const size_t sell : intent_sells_) {
+      if (isVolumeEqual(buyer.order.volume, 0)) break;
+      Intent& seller = intents_[sell];
+      if (isVolumeEqual(seller.order.volume, 0) ||
+          seller.order.price > buyer.order.price ||
+          seller.strategy == buyer.strategy) {
+        continue;
+      }
+      const Volume volume = std::min(buyer.order.volume, seller.order.volume);
+      const Price price = (buyer.order.price + seller.order.price) / 2;
+      bookStrategy(buyer.strategy, OrderSide::Buy, price, volume);
+      bookStrategy(seller.strategy, OrderSide::Sell, price, volume);
+      buyer.order.volume -= volume;
+      seller.order.volume -= volume;
+      crossed_volume_ += volume;
+    }
+  }
+
+  residual_.clear();
+  residual_owners_.clear();
+  for (const auto& intent : intents_) {
+    if (intent.order.volume <= 0 || isVolumeEqual(intent.order.volume, 0)) {
+      ++crossed_intents_;
+      continue;
+    }
+    // Checked one by one: a strategy's refused order must not hold back
+    // the others'
+    if (!admit(intent.order)) {
+      ++strategy_books_[intent.strategy].refused;
+      continue;
+    }
+    risk_.onSent(intent.order.side, intent.order.volume);
+    residual_.push_back(intent.order);
+    residual_owners_.push_back(intent.strategy);
+  }
+  intents_.clear();
+
+  const size_t sent = residual_.size();
+  if (sent != 0) {
+    residual_first_id_ = sendAdmitted(residual_);
+    exchange_api_.poll();
+  }
+  residual_owners_.clear();
+  residual_first_id_ = 0;
+  return sent;
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+StrategyBook OrderManager<Logger, ExchangeT, Listener>::getStrategyBook(
+    uint32_t strategy) const {
+  return strategy < strategy_books_.size() ? strategy_books_[strategy]
+                                           : StrategyBook{};
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+void OrderManager<Logger, ExchangeT, Listener>::bookStrategy(
+    uint32_t strategy, OrderSide side, Price price, Volume volume) {
+  StrategyBook& book = strategy_books_[strategy];
+  book.cash += price * volume * (side == OrderSide::Buy ? -1 : 1);
+  book.position += volume * (side == OrderSide::Buy ? 1 : -1);
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+OrderIdentifier OrderManager<Logger, ExchangeT, Listener>::PlaceOrder(
+    const Order& order, std::chrono::nanoseconds time_in_force)
+  requires RestingExchange<ExchangeT>
+{
+  if (!admit(order)) return 0;
+  risk_.onSent(order.side, order.volume);
+  const auto expires_at =
+      time_in_force.count() == 0 ? time_in_force : now_ + time_in_force;
+  const auto id = exchange_api_.placeOrder(order, expires_at);
+  resting_[id] = {.order = order, .filled = 0, .acked = false};
+  exchange_api_.poll();
+  return id;
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+bool OrderManager<Logger, ExchangeT, Listener>::CancelOrder(OrderIdentifier id)
+  requires RestingExchange<ExchangeT>
+{
+  if (!resting_.contains(id)) return false;
+  exchange_api_.cancelOrder(id);
+  exchange_api_.poll();
+  return true;
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+bool OrderManager<Logger, ExchangeT, Listener>::ReplaceOrder(
+    OrderIdentifier id, Price price, Volume volume)
+  requires RestingExchange<ExchangeT>
+{
+  const auto it = resting_.find(id);
+  if (it == resting_.end()) return false;
+  const RestingRecord& record = it->second;
+  const Volume open = record.order.volume - record.filled;
+  const Volume new_open = volume - record.filled;
+  if (new_open <= 0 || isVolumeEqual(new_open, 0)) return false;
+  if (!admit({record.order.side, price, new_open}, open)) return false;
+  risk_.onSent(record.order.side, new_open - open);
+  exchange_api_.replaceOrder(id, price, volume);
+  exchange_api_.poll();
+  return true;
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+bool OrderManager<Logger, ExchangeT, Listener>::admit(const Order& order,
+                                                      Volume replacing) {
+  const RiskReason reason = risk_.check(order, now_, replacing);
+  if (reason == RiskReason::None) return true;
+  logger_.writeOrder(order.side, order.price, order.volume, Status::Rejected,
+                     RiskReasonText(reason), getTotalPnL(order.price));
+  return false;
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+ExchangeCallback OrderManager<Logger, ExchangeT, Listener>::replyCallback() {
+  return std::bind(&OrderManager::HandleRequestReply, this,
+                   std::placeholders::_1, std::placeholders::_2,
+                   std::placeholders::_3);
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+void OrderManager<Logger, ExchangeT, Listener>::onBuySignal(Price price,
+                                                             Volume volume) {
+  // Room left counts the buys still open, not just the filled position
+  Volume volume_to_buy = std::min(volume, risk_.buyRoom());
+
+  if (volume_to_buy <= 0 || isVolumeEqual(volume_to_buy, 0)) return;
+
+  SendOrder({OrderSide::Buy, price, volume_to_buy});
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+void OrderManager<Logger, ExchangeT, Listener>::onSellSignal(Price price,
+                                                              Volume volume) {
+  Volume volume_to_sell = std::min(volume, risk_.sellRoom());
+
+  if (volume_to_sell <= 0 || isVolumeEqual(volume_to_sell, 0)) return;
+
+  SendOrder({OrderSide::Sell, price, volume_to_sell});
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+void OrderManager<Logger, ExchangeT, Listener>::onTick(const Tick& tick) {
+  now_ = tick.timestamp;
+  if constexpr (RestingExchange<ExchangeT>) {
+    if (!resting_.empty()) {
+      exchange_api_.onMarket(tick);
+      exchange_api_.poll();
+    }
+  }
+  stats_.onTick(tick.timestamp, tick.price);
+  risk_.onMark(getTotalPnL(tick.price));
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+PerformanceSummary OrderManager<Logger, ExchangeT, Listener>::getSummary()
+    const {
+  using std::chrono::duration;
+  auto summary = stats_.getSummary();
+  const auto sync = logger_.getSyncStats();
+  summary.log_syncs = sync.syncs;
+  summary.log_sync_seconds = duration<double>(sync.sync_time).count();
+  summary.max_commit_latency = duration<double>(sync.max_latency).count();
+  const auto round_trips = exchange_api_.getRoundTripStats();
+  summary.round_trips = round_trips.count;
+  summary.mean_round_trip = duration<double>(round_trips.mean).count();
+  summary.p99_round_trip = duration<double>(round_trips.p99).count();
+  summary.max_round_trip = duration<double>(round_trips.max).count();
+  summary.risk_position_refusals = risk_.refusals(RiskReason::Position);
+  summary.risk_notional_refusals = risk_.refusals(RiskReason::Notional);
+  summary.risk_rate_refusals = risk_.refusals(RiskReason::Rate);
+  summary.risk_loss_refusals = risk_.refusals(RiskReason::MaxLoss);
+  summary.kill_switch = risk_.killed();
+  summary.intents = intents_count_;
+  summary.crossed_intents = crossed_intents_;
+  summary.crossed_volume = crossed_volume_;
+  return summary;
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+void OrderManager<Logger, ExchangeT, Listener>::setReplyListener(
+    Listener& listener) {
+  reply_listener_ = &listener;
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+void OrderManager<Logger, ExchangeT, Listener>::fixOrder(OrderSide side,
+                                                         Price price,
+                                                         Volume volume) {
+  pnl_ += price * volume * (side == OrderSide::Buy ? -1 : 1);
+  current_position_ += volume * (side == OrderSide::Buy ? 1 : -1);
+  risk_.onFill(side, volume);
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+void OrderManager<Logger, ExchangeT, Listener>::HandleRequestReply(
+    OrderIdentifier id, Status reply_status, std::string_view reply_error) {
+  auto it = orders_.find(id);
+  if (it == orders_.end()) {
+    return;
+  }
+
+  const Order& order = it->second;
+
+  if (reply_status == Status::Executed) {
+    fixOrder(order.side, order.price, order.volume);
+    stats_.onFill(order.side, order.price, order.volume);
+    // A leg of the residual basket of FlushIntents()
+    if (const OrderIdentifier leg = id - residual_first_id_;
+        leg < residual_owners_.size()) {
+      bookStrategy(residual_owners_[leg], order.side, order.price,
+                   order.volume);
+    }
+  } else if (reply_status == Status::Rejected) {
+    stats_.onReject();
+    risk_.onDone(order.side, order.volume);
+  }
+
+  logger_.writeOrder(order.side, order.price, order.volume, reply_status,
+                     reply_error, getTotalPnL(order.price));
+
+  orders_.erase(it);
+
+  if constexpr (!std::same_as<Listener, NoReplyListener>) {
+    if (reply_listener_ != nullptr) reply_listener_->onReply(id, reply_status);
+  }
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+void OrderManager<Logger, ExchangeT, Listener>::HandleReport(
+    const ExecutionReport& report) {
+  auto it = resting_.find(report.id);
+  if (it == resting_.end()) {
+    return;
+  }
+
+  RestingRecord& record = it->second;
+  const OrderSide side = record.order.side;
+  Volume logged_volume = report.leaves;
+  bool done = false;
+  switch (report.status) {
+    case Status::Acked:
+      record.acked = true;
+      break;
+    case Status::PartiallyFilled:
+    case Status::Executed:
+      record.filled += report.filled;
+      fixOrder(side, report.price, report.filled);
+      stats_.onFill(side, report.price, report.filled);
+      logged_volume = report.filled;
+      done = report.status == Status::Executed;
+      break;
+    case Status::Replaced:
+      record.order.price = report.price;
+      record.order.volume = record.filled + report.leaves;
+      break;
+    case Status::Rejected:
+      // A refused cancel or replace leaves an acked order resting
+      done = !record.acked;
+      if (done) {
+        stats_.onReject();
+        risk_.onDone(side, record.order.volume);
+        logged_volume = record.order.volume;
+      }
+      break;
+    case Status::Cancelled:
+    case Status::Expired:
+      risk_.onDone(side, report.leaves);
+      done = true;
+      break;
+    case Status::Pending:
+      break;
+  }
+  stats_.onOrderEvent(report.status);
+
+  if (report.status != Status::Acked) {
+    logger_.writeOrder(side, report.price, logged_volume, report.status,
+                       report.text, getTotalPnL(report.price));
+  }
+
+  if (done) {
+    resting_.erase(it);
+  }
+
+  if constexpr (!std::same_as<Listener, NoReplyListener>) {
+    if (reply_listener_ != nullptr) {
+      reply_listener_->onReply(report.id, report.status);
+    }
+  }
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+void OrderManager<Logger, ExchangeT, Listener>::save(
+    SnapshotWriter& writer) const {
+  writer.write(pnl_);
+  writer.write(current_position_);
+  writer.write(static_cast<uint64_t>(orders_.size()));
+  for (const auto& [id, order] : orders_) {
+    writer.write(id);
+    writer.write(order);
+  }
+  writer.write(static_cast<uint64_t>(resting_.size()));
+  for (const auto& [id, record] : resting_) {
+    writer.write(id);
+    writer.write(record);
+  }
+  writer.write(now_);
+  writer.write(static_cast<uint64_t>(intents_.size()));
+  for (const auto& intent : intents_) {
+    writer.write(intent);
+  }
+  writer.write(static_cast<uint64_t>(strategy_books_.size()));
+  for (const auto& book : strategy_books_) {
+    writer.write(book);
+  }
+  writer.write(intents_count_);
+  writer.write(crossed_intents_);
+  writer.write(crossed_volume_);
+  stats_.save(writer);
+  risk_.save(writer);
+  exchange_api_.save(writer);
+  logger_.save(writer);
+}
+
+template <OrderSink Logger, Exchange ExchangeT, typename Listener>
+std::optional<std::string> OrderManager<Logger, ExchangeT, Listener>::load(
+    SnapshotReader& reader) {
+  reader.read(pnl_);
+  reader.read(current_position_);
+
+  uint64_t orders_count = 0;
+  reader.read(orders_count);
+  orders_.clear();
+  for (uint64_t i = 0; i < orders_count && reader.ok(); ++i) {
+    OrderIdentifier id = 0;
+    Order order{};
+    reader.read(id);
+    reader.read(order);
+    orders_[id] = order;
+  }
+
+  uint64_t resting_count = 0;
+  reader.read(resting_count);
+  resting_.clear();
+  for (uint64_t i = 0; i < resting_count && reader.ok(); ++i) {
+    OrderIdentifier id = 0;
+    RestingRecord record{};
+    reader.read(id);
+    reader.read(record);
+    resting_[id] = record;
+  }
+  reader.read(now_);
+
+  uint64_t intents_count = 0;
+  reader.read(intents_count);
+  intents_.clear();
+  for (uint64_t i = 0; i < intents_count && reader.ok(); ++i) {
+    Intent intent{};
+    reader.read(intent);
+    intents_.push_back(intent);
+  }
+  uint64_t books_count = 0;
+  reader.read(books_count);
+  strategy_books_.clear();
+  for (uint64_t i = 0; i < books_count && reader.ok(); ++i) {
+    StrategyBook book;
+    reader.read(book);
+    strategy_books_.push_back(book);
+  }
+  reader.read(intents_count_);
+  reader.read(crossed_intents_);
+  reader.read(crossed_volume_);
+
+  stats_.load(reader);
+  risk_.load(reader);
+  exchange_api_.load(reader, replyCallback());
+  return logger_.load(reader);
+}
+
 #endif  // TRADINGSIMULATOR_ORDERMANAGER_H
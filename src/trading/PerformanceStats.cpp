@@ -0,0 +1,259 @@
+#include "PerformanceStats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+
+void PerformanceStats::onTick(std::chrono::nanoseconds timestamp,
+                              Price price) {
+  const Price equity = markToMarket(price);
+  ++ticks_;
+
+  if (!last_tick_time_.has_value()) {
+    first_tick_time_ = timestamp;
+  } else {
+    if (!isVolumeEqual(position_, 0)) {
+      time_in_market_ += timestamp - *last_tick_time_;
+    }
+
+    const double ret = equity - last_equity_;
+    ++returns_count_;
+    const double delta = ret - returns_mean_;
+    returns_mean_ += delta / static_cast<double>(returns_count_);
+    returns_m2_ += delta * (ret - returns_mean_);
+  }
+
+  peak_equity_ = std::max(peak_equity_, equity);
+  max_drawdown_ = std::max(max_drawdown_, peak_equity_ - equity);
+  last_equity_ = equity;
+  last_tick_time_ = timestamp;
+}
+
+void PerformanceStats::onFill(OrderSide side, Price price, Volume volume) {
+  const double direction = side == OrderSide::Buy ? 1.0 : -1.0;
+  ++executed_orders_;
+  turnover_ += price * volume;
+  cash_ -= direction * price * volume;
+
+  const bool opening = isVolumeEqual(position_, 0) ||
+                       (position_ > 0) == (side == OrderSide::Buy);
+  if (opening) {
+    const Volume held = std::abs(position_);
+    average_entry_price_ =
+        (average_entry_price_ * held + price * volume) / (held + volume);
+    position_ += direction * volume;
+    return;
+  }
+
+  const Volume closed = std::min(volume, std::abs(position_));
+  const Price realized = (price - average_entry_price_) * closed *
+                         (position_ > 0 ? 1.0 : -1.0);
+  if (realized > 0) {
+    ++winning_trades_;
+  } else if (realized < 0) {
+    ++losing_trades_;
+  }
+
+  position_ += direction * volume;
+  if (isVolumeEqual(position_, 0)) {
+    position_ = 0;
+    average_entry_price_ = 0;
+  } else if (volume > closed) {
+    // Flipped through zero: the remainder opens at the fill price
+    average_entry_price_ = price;
+  }
+}
+
+void PerformanceStats::onReject() { ++rejected_orders_; }
+
+void PerformanceStats::onOrderEvent(Status status) {
+  partial_fills_ += status == Status::PartiallyFilled ? 1 : 0;
+  replaced_orders_ += status == Status::Replaced ? 1 : 0;
+  cancelled_orders_ += status == Status::Cancelled ? 1 : 0;
+  expired_orders_ += status == Status::Expired ? 1 : 0;
+}
+
+Price PerformanceStats::markToMarket(Price price) const {
+  return cash_ + position_ * price;
+}
+
+PerformanceSummary PerformanceStats::getSummary() const {
+  PerformanceSummary summary{
+      .ticks = ticks_,
+      .executed_orders = executed_orders_,
+      .rejected_orders = rejected_orders_,
+      .total_pnl = last_equity_,
+      .mean_return = returns_mean_,
+      .max_drawdown = max_drawdown_,
+      .winning_trades = winning_trades_,
+      .losing_trades = losing_trades_,
+      .turnover = turnover_,
+      .partial_fills = partial_fills_,
+      .replaced_orders = replaced_orders_,
+      .cancelled_orders = cancelled_orders_,
+      .expired_orders = expired_orders_};
+
+  if (returns_count_ > 1) {
+    summary.return_stddev =
+        std::sqrt(returns_m2_ / static_cast<double>(returns_count_ - 1));
+  }
+  if (summary.return_stddev > 0) {
+    summary.sharpe = returns_mean_ / summary.return_stddev;
+  }
+
+  if (last_tick_time_.has_value() && returns_count_ > 0) {
+    using namespace std::chrono;
+    const auto elapsed = *last_tick_time_ - first_tick_time_;
+    const double mean_interval = duration<double>(elapsed).count() /
+                                 static_cast<double>(returns_count_);
+    if (mean_interval > 0) {
+      const double year = duration<double>(years(1)).count();
+      summary.annualized_sharpe =
+          summary.sharpe * std::sqrt(year / mean_interval);
+    }
+    if (elapsed.count() > 0) {
+      summary.time_in_market = duration<double>(time_in_market_).count() /
+                               duration<double>(elapsed).count();
+    }
+  }
+
+  if (losing_trades_ > 0) {
+    summary.win_loss_ratio = static_cast<double>(winning_trades_) /
+                             static_cast<double>(losing_trades_);
+  }
+  return summary;
+}
+
+void PerformanceStats::save(SnapshotWriter& writer) const {
+  writer.write(returns_count_);
+  writer.write(returns_mean_);
+  writer.write(returns_m2_);
+  writer.write(last_tick_time_.has_value());
+  writer.write(last_tick_time_.value_or(std::chrono::nanoseconds(0)));
+  writer.write(first_tick_time_);
+  writer.write(time_in_market_);
+  writer.write(last_equity_);
+  writer.write(peak_equity_);
+  writer.write(max_drawdown_);
+  writer.write(cash_);
+  writer.write(position_);
+  writer.write(average_entry_price_);
+  writer.write(ticks_);
+  writer.write(executed_orders_);
+  writer.write(rejected_orders_);
+  writer.write(winning_trades_);
+  writer.write(losing_trades_);
+  writer.write(turnover_);
+  writer.write(partial_fills_);
+  writer.write(replaced_orders_);
+  writer.write(cancelled_orders_);
+  writer.write(expired_orders_);
+}
+
+void PerformanceStats::load(SnapshotReader& reader) {
+  bool has_last_tick = false;
+  std::chrono::nanoseconds last_tick_time{0};
+  reader.read(returns_count_);
+  reader.read(returns_mean_);
+  reader.read(returns_m2_);
+  reader.read(has_last_tick);
+  reader.read(last_tick_time);
+  reader.read(first_tick_time_);
+  reader.read(time_in_market_);
+  reader.read(last_equity_);
+  reader.read(peak_equity_);
+  reader.read(max_drawdown_);
+  reader.read(cash_);
+  reader.read(position_);
+  reader.read(average_entry_price_);
+  reader.read(ticks_);
+  reader.read(executed_orders_);
+  reader.read(rejected_orders_);
+  reader.read(winning_trades_);
+  reader.read(losing_trades_);
+  reader.read(turnover_);
+  reader.read(partial_fills_);
+  reader.read(replaced_orders_);
+  reader.read(cancelled_orders_);
+  reader.read(expired_orders_);
+
+  last_tick_time_.reset();
+  if (has_last_tick) {
+    last_tick_time_ = last_tick_time;
+  }
+}
+
+std::string FormatSummary(const PerformanceSummary& summary) {
+  auto text = std::format(
+      "Ticks:             {}\n"
+      "Orders:            {} executed, {} rejected\n"
+      "Total PnL:         {:.3f}\n"
+      "Return per tick:   mean {:.6f}, stddev {:.6f}\n"
+      "Sharpe:            {:.4f} per tick, {:.2f} annualized\n"
+      "Max drawdown:      {:.3f}\n"
+      "Trades won/lost:   {}/{} (ratio {:.2f})\n"
+      "Turnover:          {:.3f}\n"
+      "Time in market:    {:.2f}%",
+      summary.ticks, summary.executed_orders, summary.rejected_orders,
+      summary.total_pnl, summary.mean_return, summary.return_stddev,
+      summary.sharpe, summary.annualized_sharpe, summary.max_drawdown,
+      summary.winning_trades, summary.losing_trades, summary.win_loss_ratio,
+      summary.turnover, summary.time_in_market * 100.0);
+  if (summary.partial_fills + summary.replaced_orders +
+          summary.cancelled_orders + summary.expired_orders >
+      0) {
+    text += std::format(
+        "\nResting orders:    {} partial fills, {} replaced, {} cancelled, "
+        "{} expired",
+        summary.partial_fills, summary.replaced_orders,
+        summary.cancelled_orders, summary.expired_orders);
+  }
+  if (summary.risk_position_refusals + summary.risk_notional_refusals +
+              summary.risk_rate_refusals + summary.risk_loss_refusals >
+          0 ||
+      summary.kill_switch) {
+    text += std::format(
+        "\nRisk refusals:     {} position, {} notional, {} rate, {} max "
+        "loss{}",
+        summary.risk_position_refusals, summary.risk_notional_refusals,
+        summary.risk_rate_refusals, summary.risk_loss_refusals,
+        summary.kill_switch ? " (kill switch tripped)" : "");
+  }
+  if (summary.intents > 0) {
+    text += std::format(
+        "\nNetting:           {} intents, {} crossed internally ({:.3f} "
+        "volume)",
+        summary.intents, summary.crossed_intents, summary.crossed_volume);
+  }
+  if (summary.conflated_ticks > 0) {
+    text += std::format("\nConflated ticks:   {} ({:.2f}% of generated)",
+                        summary.conflated_ticks,
+                        100.0 * static_cast<double>(summary.conflated_ticks) /
+                            static_cast<double>(summary.ticks +
+                                                summary.conflated_ticks));
+  }
+  if (summary.bus_ticks > 0) {
+    text += std::format(
+        "\nBus latency:       {} ticks (mean {:.1f} us, p99 {:.1f} us, max "
+        "{:.1f} us), {:.1f} per strategy batch",
+        summary.bus_ticks, summary.mean_bus_latency * 1e6,
+        summary.p99_bus_latency * 1e6, summary.max_bus_latency * 1e6,
+        static_cast<double>(summary.bus_ticks) /
+            static_cast<double>(std::max<uint64_t>(summary.bus_batches, 1)));
+  }
+  if (summary.log_syncs > 0) {
+    text += std::format(
+        "\nOrder log syncs:   {} ({:.3f} ms total, max commit latency "
+        "{:.3f} ms)",
+        summary.log_syncs, summary.log_sync_seconds * 1e3,
+        summary.max_commit_latency * 1e3);
+  }
+  if (summary.round_trips > 0) {
+    text += std::format(
+        "\nRound trips:       {} (mean {:.1f} us, p99 {:.1f} us, max {:.1f} "
+        "us)",
+        summary.round_trips, summary.mean_round_trip * 1e6,
+        summary.p99_round_trip * 1e6, summary.max_round_trip * 1e6);
+  }
+  return text;
+}
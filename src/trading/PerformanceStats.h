@@ -0,0 +1,123 @@
+#ifndef TRADINGSIMULATOR_PERFORMANCESTATS_H
+#define TRADINGSIMULATOR_PERFORMANCESTATS_H
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "common/Snapshot.h"
+#include "common/Types.h"
+
+struct PerformanceSummary {
+  uint64_t ticks = 0;
+  uint64_t executed_orders = 0;  // fills: a resting order may fill in parts
+  uint64_t rejected_orders = 0;
+  Price total_pnl = 0;
+  double mean_return = 0;  // mean per-tick PnL change
+  double return_stddev = 0;
+  double sharpe = 0;  // per tick
+  double annualized_sharpe = 0;
+  Price max_drawdown = 0;
+  uint64_t winning_trades = 0;
+  uint64_t losing_trades = 0;
+  double win_loss_ratio = 0;
+  Price turnover = 0;          // traded notional
+  double time_in_market = 0;  // fraction of simulated time with a position
+
+  // Resting orders (OrderManager::PlaceOrder)
+  uint64_t partial_fills = 0;  // fills that left the order resting
+  uint64_t replaced_orders = 0;
+  uint64_t cancelled_orders = 0;
+  uint64_t expired_orders = 0;
+
+  // Orders the pre-trade checks (RiskEngine) kept from the exchange, by
+  // reason, and whether max_loss stopped the trading
+  uint64_t risk_position_refusals = 0;
+  uint64_t risk_notional_refusals = 0;
+  uint64_t risk_rate_refusals = 0;
+  uint64_t risk_loss_refusals = 0;
+  bool kill_switch = false;
+
+  // Orders of several strategies netted by OrderManager::FlushIntents()
+  uint64_t intents = 0;
+  uint64_t crossed_intents = 0;  // crossed in full, never sent
+  Volume crossed_volume = 0;
+
+  // Ticks the strategy skipped with tick_delivery = latest (Simulator)
+  uint64_t conflated_ticks = 0;
+
+  // Ticks through the event bus with tick_delivery = bus (Simulator), timed
+  // from publishing until the metrics consumer, which follows the strategy,
+  // takes them
+  uint64_t bus_ticks = 0;
+  double mean_bus_latency = 0;  // seconds
+  double p99_bus_latency = 0;
+  double max_bus_latency = 0;
+  uint64_t bus_batches = 0;  // strategy wake-ups, each taking every tick ready
+
+  // Order log durability, filled in by OrderManager (0 - no syncing)
+  uint64_t log_syncs = 0;
+  double log_sync_seconds = 0;    // spent in fdatasync
+  double max_commit_latency = 0;  // seconds from commit to durable
+
+  // Order round trips to an out-of-process venue (0 - in-process exchange)
+  uint64_t round_trips = 0;
+  double mean_round_trip = 0;  // seconds from send to fill or rejection
+  double p99_round_trip = 0;
+  double max_round_trip = 0;
+};
+
+// Run statistics maintained in O(1) per event, so a run can be evaluated
+// without re-reading the order log. Returns are per-tick changes of the
+// marked-to-market PnL; a trade is won or lost when a fill reduces the
+// position, measured against the average entry price.
+class PerformanceStats {
+ public:
+  void onTick(std::chrono::nanoseconds timestamp, Price price);
+  void onFill(OrderSide side, Price price, Volume volume);
+  void onReject();
+  // Counts PartiallyFilled, Replaced, Cancelled and Expired; the fill
+  // itself is booked by onFill()
+  void onOrderEvent(Status status);
+
+  [[nodiscard]] PerformanceSummary getSummary() const;
+
+  void save(SnapshotWriter& writer) const;
+  void load(SnapshotReader& reader);
+
+ private:
+  [[nodiscard]] Price markToMarket(Price price) const;
+
+  // Welford accumulators over per-tick PnL changes
+  uint64_t returns_count_ = 0;
+  double returns_mean_ = 0;
+  double returns_m2_ = 0;
+
+  std::optional<std::chrono::nanoseconds> last_tick_time_;
+  std::chrono::nanoseconds first_tick_time_{0};
+  std::chrono::nanoseconds time_in_market_{0};
+  Price last_equity_ = 0;
+  Price peak_equity_ = 0;
+  Price max_drawdown_ = 0;
+
+  Price cash_ = 0;
+  Volume position_ = 0;
+  Price average_entry_price_ = 0;
+
+  uint64_t ticks_ = 0;
+  uint64_t executed_orders_ = 0;
+  uint64_t rejected_orders_ = 0;
+  uint64_t winning_trades_ = 0;
+  uint64_t losing_trades_ = 0;
+  Price turnover_ = 0;
+
+  uint64_t partial_fills_ = 0;
+  uint64_t replaced_orders_ = 0;
+  uint64_t cancelled_orders_ = 0;
+  uint64_t expired_orders_ = 0;
+};
+
+std::string FormatSummary(const PerformanceSummary& summary);
+
+#endif  // TRADINGSIMULATOR_PERFORMANCESTATS_H
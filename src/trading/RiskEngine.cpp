@@ -0,0 +1,127 @@
+#include "RiskEngine.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+namespace {
+
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+// Slack for volumes clamped to exactly the room left, and for a bucket
+// refilled to exactly one token in several steps
+constexpr Volume kVolumeEpsilon = 1e-9;
+constexpr double kTokenEpsilon = 1e-9;
+
+constexpr uint32_t Bit(bool breached, RiskReason reason) {
+  return static_cast<uint32_t>(breached) << static_cast<uint32_t>(reason);
+}
+
+}  // namespace
+
+std::string_view RiskReasonText(RiskReason reason) {
+  switch (reason) {
+    case RiskReason::MaxLoss:
+      return "Risk: max loss";
+    case RiskReason::Position:
+      return "Risk: position limit";
+    case RiskReason::Notional:
+      return "Risk: order notional";
+    case RiskReason::Rate:
+      return "Risk: order rate";
+    case RiskReason::None:
+      break;
+  }
+  return "";
+}
+
+RiskEngine::RiskEngine(const Config& config)
+    : min_position_(config.min_position),
+      max_position_(config.max_position),
+      max_notional_(config.max_order_notional > 0 ? config.max_order_notional
+                                                  : kInfinity),
+      loss_floor_(config.max_loss > 0 ? -config.max_loss : -kInfinity),
+      tokens_per_ns_(config.max_orders_per_second / 1e9),
+      burst_(config.max_orders_per_second > 0
+                 ? static_cast<double>(config.order_burst)
+                 : kInfinity),
+      tokens_(burst_) {}
+
+RiskReason RiskEngine::check(const Order& order, std::chrono::nanoseconds now,
+                             Volume replacing) {
+  refill(now);
+  const bool buy = order.side == OrderSide::Buy;
+  const Volume added = order.volume - replacing;
+  const Volume longest = position_ + open_buys_ + (buy ? added : 0);
+  const Volume shortest = position_ - open_sells_ - (buy ? 0 : added);
+  const uint32_t breaches =
+      Bit(killed_, RiskReason::MaxLoss) |
+      Bit((longest > max_position_ + kVolumeEpsilon) |
+              (shortest < min_position_ - kVolumeEpsilon),
+          RiskReason::Position) |
+      Bit(order.price * order.volume > max_notional_, RiskReason::Notional) |
+      Bit(tokens_ < 1.0 - kTokenEpsilon, RiskReason::Rate) |
+      Bit(true, RiskReason::None);
+  const auto reason = static_cast<RiskReason>(std::countr_zero(breaches));
+  ++counts_[static_cast<size_t>(reason)];
+  return reason;
+}
+
+void RiskEngine::refill(std::chrono::nanoseconds now) {
+  const auto elapsed = std::max<int64_t>((now - last_refill_).count(), 0);
+  tokens_ = std::min(burst_,
+                     tokens_ + static_cast<double>(elapsed) * tokens_per_ns_);
+  last_refill_ = now;
+}
+
+void RiskEngine::onSent(OrderSide side, Volume volume) {
+  (side == OrderSide::Buy ? open_buys_ : open_sells_) += volume;
+  tokens_ -= 1.0;
+}
+
+void RiskEngine::onUnsent(OrderSide side, Volume volume) {
+  (side == OrderSide::Buy ? open_buys_ : open_sells_) -= volume;
+  tokens_ += 1.0;
+}
+
+void RiskEngine::onFill(OrderSide side, Volume volume) {
+  const bool buy = side == OrderSide::Buy;
+  (buy ? open_buys_ : open_sells_) -= volume;
+  position_ += buy ? volume : -volume;
+}
+
+void RiskEngine::onDone(OrderSide side, Volume open_volume) {
+  (side == OrderSide::Buy ? open_buys_ : open_sells_) -= open_volume;
+}
+
+void RiskEngine::onMark(Price total_pnl) {
+  killed_ = killed_ || total_pnl <= loss_floor_;
+}
+
+Volume RiskEngine::buyRoom() const {
+  return std::max<Volume>(max_position_ - position_ - open_buys_, 0);
+}
+
+Volume RiskEngine::sellRoom() const {
+  return std::max<Volume>(position_ - open_sells_ - min_position_, 0);
+}
+
+void RiskEngine::save(SnapshotWriter& writer) const {
+  writer.write(position_);
+  writer.write(open_buys_);
+  writer.write(open_sells_);
+  writer.write(tokens_);
+  writer.write(last_refill_);
+  writer.write(killed_);
+  writer.write(counts_);
+}
+
+void RiskEngine::load(SnapshotReader& reader) {
+  reader.read(position_);
+  reader.read(open_buys_);
+  reader.read(open_sells_);
+  reader.read(tokens_);
+  reader.read(last_refill_);
+  reader.read(killed_);
+  reader.read(counts_);
+}
@@ -0,0 +1,86 @@
+#ifndef TRADINGSIMULATOR_RISKENGINE_H
+#define TRADINGSIMULATOR_RISKENGINE_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+#include "common/Snapshot.h"
+#include "common/Types.h"
+#include "config/Config.h"
+
+// Why RiskEngine refused an order, in the order the checks take precedence
+enum class RiskReason : uint8_t { MaxLoss, Position, Notional, Rate, None };
+
+inline constexpr size_t kRiskReasons = static_cast<size_t>(RiskReason::None);
+
+std::string_view RiskReasonText(RiskReason reason);
+
+// Pre-trade checks OrderManager runs before an order leaves for the
+// exchange:
+//  - the position after every open order of the same side fills, on top of
+//    the filled one, within [min_position, max_position];
+//  - price * volume within max_order_notional;
+//  - a token bucket of order_burst tokens refilled at
+//    max_orders_per_second of simulated time, one token per order;
+//  - a kill switch that refuses everything once the marked PnL has fallen
+//    to -max_loss, for the rest of the run.
+// All checks are evaluated on every call and folded into one mask, so a
+// check costs the same few comparisons whatever the outcome. Disabled
+// limits are infinite rather than tested for.
+class RiskEngine {
+ public:
+  explicit RiskEngine(const Config& config);
+
+  // Refusals are counted by reason. `replacing` is the open volume of an
+  // order being replaced, which the new one takes over.
+  RiskReason check(const Order& order, std::chrono::nanoseconds now,
+                   Volume replacing = 0);
+
+  // Order lifecycle as OrderManager books it: an accepted order (or the
+  // volume a replace adds, negative if it takes some away) takes a token
+  // and stays open until it is filled or done; onUnsent() undoes onSent()
+  // for a basket refused further on.
+  void onSent(OrderSide side, Volume volume);
+  void onUnsent(OrderSide side, Volume volume);
+  void onFill(OrderSide side, Volume volume);
+  void onDone(OrderSide side, Volume open_volume);
+  // Trips the kill switch when the marked PnL reaches -max_loss
+  void onMark(Price total_pnl);
+
+  // Volume a new order of that side may still have under the position
+  // limits, never negative
+  [[nodiscard]] Volume buyRoom() const;
+  [[nodiscard]] Volume sellRoom() const;
+
+  [[nodiscard]] uint64_t refusals(RiskReason reason) const {
+    return counts_[static_cast<size_t>(reason)];
+  }
+  [[nodiscard]] bool killed() const { return killed_; }
+
+  void save(SnapshotWriter& writer) const;
+  void load(SnapshotReader& reader);
+
+ private:
+  void refill(std::chrono::nanoseconds now);
+
+  Volume min_position_;
+  Volume max_position_;
+  Price max_notional_;
+  Price loss_floor_;  // -max_loss
+  double tokens_per_ns_;
+  double burst_;
+
+  Volume position_ = 0;
+  Volume open_buys_ = 0;
+  Volume open_sells_ = 0;
+  double tokens_;
+  std::chrono::nanoseconds last_refill_{0};
+  bool killed_ = false;
+  // One slot per reason and one more for accepted orders, so counting
+  // takes no branch
+  std::array<uint64_t, kRiskReasons + 1> counts_{};
+};
+
+#endif  // TRADINGSIMULATOR_RISKENGINE_H
@@ -0,0 +1,60 @@
+#ifndef TRADINGSIMULATOR_ROLLINGEXTREMUM_H
+#define TRADINGSIMULATOR_ROLLINGEXTREMUM_H
+
+#include <chrono>
+#include <functional>
+
+#include "common/RingBuffer.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+
+// Minimum or maximum tick price inside (now - window, now]. Keeps a
+// monotonic deque: a price that can never become the extremum again (an
+// older price beaten by a newer one) is dropped on arrival, so each tick is
+// pushed and popped at most once.
+template <typename Compare>
+class RollingExtremum {
+ public:
+  RollingExtremum(std::chrono::nanoseconds window,
+                  std::chrono::nanoseconds min_tick_interval)
+      : window_(window),
+        candidates_(WindowCapacity(window, min_tick_interval)) {}
+
+  Price update(const Tick& tick) {
+    while (!candidates_.empty() &&
+           !compare_(candidates_.back().price, tick.price)) {
+      candidates_.pop_back();
+    }
+    candidates_.push_back({tick.timestamp, tick.price});
+
+    const auto expired = tick.timestamp - window_;
+    while (!candidates_.empty() && candidates_.front().timestamp <= expired) {
+      candidates_.pop_front();
+    }
+
+    return getCurrentPrice();
+  }
+
+  [[nodiscard]] Price getCurrentPrice() const {
+    if (candidates_.empty()) return 0;
+    return candidates_.front().price;
+  }
+
+  void save(SnapshotWriter& writer) const { candidates_.save(writer); }
+  void load(SnapshotReader& reader) { candidates_.load(reader); }
+
+ private:
+  struct Sample {
+    std::chrono::nanoseconds timestamp;
+    Price price;
+  };
+
+  std::chrono::nanoseconds window_;
+  RingBuffer<Sample> candidates_;
+  [[no_unique_address]] Compare compare_;
+};
+
+using RollingMin = RollingExtremum<std::less<Price>>;
+using RollingMax = RollingExtremum<std::greater<Price>>;
+
+#endif  // TRADINGSIMULATOR_ROLLINGEXTREMUM_H
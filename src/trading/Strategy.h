@@ -0,0 +1,34 @@
+#ifndef TRADINGSIMULATOR_STRATEGY_H
+#define TRADINGSIMULATOR_STRATEGY_H
+
+#include <chrono>
+#include <concepts>
+#include <optional>
+#include <string>
+
+#include "PerformanceStats.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+#include "config/Config.h"
+
+// A trading strategy driven by Simulator. Strategies are template
+// parameters rather than subclasses, so their handlers inline into the
+// simulation loop.
+//   onTick  - every generated tick
+//   onReply - exchange reply to one of the strategy's orders
+//   onTimer - every [Trade] timer_interval of simulated time
+template <typename T>
+concept Strategy =
+    std::constructible_from<T, const Config&> &&
+    requires(T strategy, const T& const_strategy, const Tick& tick,
+             OrderIdentifier id, Status status, std::chrono::nanoseconds now,
+             SnapshotWriter& writer, SnapshotReader& reader) {
+      strategy.onTick(tick);
+      strategy.onReply(id, status);
+      strategy.onTimer(now);
+      { const_strategy.getSummary() } -> std::same_as<PerformanceSummary>;
+      const_strategy.save(writer);
+      { strategy.load(reader) } -> std::same_as<std::optional<std::string>>;
+    };
+
+#endif  // TRADINGSIMULATOR_STRATEGY_H
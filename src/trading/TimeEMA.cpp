@@ -2,7 +2,9 @@
 
 using namespace std::chrono_literals;
 
-TimeEMA::TimeEMA(std::chrono::nanoseconds period) {
+TimeEMA::TimeEMA(std::chrono::nanoseconds period,
+                 std::optional<AlphaTable> alpha_table)
+    : alpha_table_(std::move(alpha_table)) {
   const double tau_sec = std::chrono::duration<double>(period).count();
   neg_inv_tau_ = -1.0 / tau_sec;
 }
@@ -20,15 +22,40 @@ Price TimeEMA::update(const Tick& tick) {
     return current_ma_price_;
   }
 
-  const double dt_sec = std::chrono::duration<double>(deltaT).count();
+  std::optional<double> alpha;
+  if (alpha_table_.has_value()) {
+    alpha = alpha_table_->lookup(deltaT);
+  }
+  if (!alpha.has_value()) {
+    const double dt_sec = std::chrono::duration<double>(deltaT).count();
+    // Alpha = 1 - e^(-dt / tau)
+    alpha = 1.0 - std::exp(dt_sec * neg_inv_tau_);
+  }
 
-  // Alpha = 1 - e^(-dt / tau)
-  const double alpha = 1.0 - std::exp(dt_sec * neg_inv_tau_);
   current_ma_price_ =
-      current_ma_price_ + alpha * (tick.price - current_ma_price_);
+      current_ma_price_ + *alpha * (tick.price - current_ma_price_);
   last_time_update_ = tick.timestamp;
 
   return current_ma_price_;
 }
 
 Price TimeEMA::getCurrentPrice() const { return current_ma_price_; }
+
+void TimeEMA::save(SnapshotWriter& writer) const {
+  writer.write(current_ma_price_);
+  writer.write(last_time_update_.has_value());
+  writer.write(last_time_update_.value_or(0ns).count());
+}
+
+void TimeEMA::load(SnapshotReader& reader) {
+  bool has_last_update = false;
+  std::chrono::nanoseconds::rep last_update = 0;
+  reader.read(current_ma_price_);
+  reader.read(has_last_update);
+  reader.read(last_update);
+
+  last_time_update_.reset();
+  if (has_last_update) {
+    last_time_update_ = std::chrono::nanoseconds(last_update);
+  }
+}
@@ -4,19 +4,28 @@
 #include <chrono>
 #include <optional>
 
+#include "AlphaTable.h"
+#include "common/Snapshot.h"
 #include "common/Types.h"
 
 class TimeEMA {
  public:
-  explicit TimeEMA(std::chrono::nanoseconds period);
+  // With an alpha table, updates whose interval falls inside the table range
+  // skip std::exp.
+  explicit TimeEMA(std::chrono::nanoseconds period,
+                   std::optional<AlphaTable> alpha_table = std::nullopt);
   Price update(const Tick& tick);
 
   [[nodiscard]] Price getCurrentPrice() const;
 
+  void save(SnapshotWriter& writer) const;
+  void load(SnapshotReader& reader);
+
  private:
   Price current_ma_price_ = 0;
   std::optional<std::chrono::nanoseconds> last_time_update_;
   double neg_inv_tau_;
+  std::optional<AlphaTable> alpha_table_;
 };
 
 #endif  // TRADINGSIMULATOR_TIMEEMA_H
@@ -0,0 +1,56 @@
+#include "TimeRSI.h"
+
+TimeRSI::TimeRSI(std::chrono::nanoseconds window,
+                 std::chrono::nanoseconds min_tick_interval)
+    : window_(window), samples_(WindowCapacity(window, min_tick_interval)) {}
+
+double TimeRSI::update(const Tick& tick) {
+  if (last_price_.has_value()) {
+    const double change = tick.price - *last_price_;
+    const double gain = change > 0 ? change : 0;
+    const double loss = change < 0 ? -change : 0;
+    samples_.push_back({tick.timestamp, gain, loss});
+    gains_ += gain;
+    losses_ += loss;
+  }
+  last_price_ = tick.price;
+
+  const auto expired = tick.timestamp - window_;
+  while (!samples_.empty() && samples_.front().timestamp <= expired) {
+    gains_ -= samples_.front().gain;
+    losses_ -= samples_.front().loss;
+    samples_.pop_front();
+  }
+
+  return getValue();
+}
+
+double TimeRSI::getValue() const {
+  const double total = gains_ + losses_;
+  // A flat (or empty) window is neutral
+  if (samples_.empty() || total <= 0) return 50.0;
+  return 100.0 * gains_ / total;
+}
+
+void TimeRSI::save(SnapshotWriter& writer) const {
+  writer.write(gains_);
+  writer.write(losses_);
+  writer.write(last_price_.has_value());
+  writer.write(last_price_.value_or(0));
+  samples_.save(writer);
+}
+
+void TimeRSI::load(SnapshotReader& reader) {
+  bool has_last_price = false;
+  Price last_price = 0;
+  reader.read(gains_);
+  reader.read(losses_);
+  reader.read(has_last_price);
+  reader.read(last_price);
+  samples_.load(reader);
+
+  last_price_.reset();
+  if (has_last_price) {
+    last_price_ = last_price;
+  }
+}
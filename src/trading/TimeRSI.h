@@ -0,0 +1,39 @@
+#ifndef TRADINGSIMULATOR_TIMERSI_H
+#define TRADINGSIMULATOR_TIMERSI_H
+
+#include <chrono>
+#include <optional>
+
+#include "common/RingBuffer.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+
+// Relative strength index over the price changes inside (now - window, now],
+// in the range 0..100. Gains and losses are plain window sums (Cutler's
+// RSI), which unlike Wilder's smoothing depends only on the window contents.
+class TimeRSI {
+ public:
+  TimeRSI(std::chrono::nanoseconds window,
+          std::chrono::nanoseconds min_tick_interval);
+  double update(const Tick& tick);
+
+  [[nodiscard]] double getValue() const;
+
+  void save(SnapshotWriter& writer) const;
+  void load(SnapshotReader& reader);
+
+ private:
+  struct Sample {
+    std::chrono::nanoseconds timestamp;
+    double gain;
+    double loss;
+  };
+
+  std::chrono::nanoseconds window_;
+  RingBuffer<Sample> samples_;
+  double gains_ = 0;
+  double losses_ = 0;
+  std::optional<Price> last_price_;
+};
+
+#endif  // TRADINGSIMULATOR_TIMERSI_H
@@ -0,0 +1,33 @@
+#include "TimeSMA.h"
+
+TimeSMA::TimeSMA(std::chrono::nanoseconds window,
+                 std::chrono::nanoseconds min_tick_interval)
+    : window_(window), samples_(WindowCapacity(window, min_tick_interval)) {}
+
+Price TimeSMA::update(const Tick& tick) {
+  samples_.push_back({tick.timestamp, tick.price});
+  sum_ += tick.price;
+
+  const auto expired = tick.timestamp - window_;
+  while (!samples_.empty() && samples_.front().timestamp <= expired) {
+    sum_ -= samples_.front().price;
+    samples_.pop_front();
+  }
+
+  return getCurrentPrice();
+}
+
+Price TimeSMA::getCurrentPrice() const {
+  if (samples_.empty()) return 0;
+  return sum_ / static_cast<double>(samples_.size());
+}
+
+void TimeSMA::save(SnapshotWriter& writer) const {
+  writer.write(sum_);
+  samples_.save(writer);
+}
+
+void TimeSMA::load(SnapshotReader& reader) {
+  reader.read(sum_);
+  samples_.load(reader);
+}
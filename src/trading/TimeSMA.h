@@ -0,0 +1,33 @@
+#ifndef TRADINGSIMULATOR_TIMESMA_H
+#define TRADINGSIMULATOR_TIMESMA_H
+
+#include <chrono>
+
+#include "common/RingBuffer.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+
+// Simple moving average of the tick prices inside (now - window, now].
+class TimeSMA {
+ public:
+  TimeSMA(std::chrono::nanoseconds window,
+          std::chrono::nanoseconds min_tick_interval);
+  Price update(const Tick& tick);
+
+  [[nodiscard]] Price getCurrentPrice() const;
+
+  void save(SnapshotWriter& writer) const;
+  void load(SnapshotReader& reader);
+
+ private:
+  struct Sample {
+    std::chrono::nanoseconds timestamp;
+    Price price;
+  };
+
+  std::chrono::nanoseconds window_;
+  RingBuffer<Sample> samples_;
+  double sum_ = 0;
+};
+
+#endif  // TRADINGSIMULATOR_TIMESMA_H
@@ -0,0 +1,44 @@
+#include "TimeVWAP.h"
+
+TimeVWAP::TimeVWAP(std::chrono::nanoseconds window,
+                   std::chrono::nanoseconds min_tick_interval)
+    : window_(window), samples_(WindowCapacity(window, min_tick_interval)) {}
+
+Price TimeVWAP::update(const Tick& tick) {
+  const double notional = tick.price * tick.volume;
+  samples_.push_back({tick.timestamp, notional, tick.volume});
+  notional_ += notional;
+  volume_ += tick.volume;
+  last_price_ = tick.price;
+
+  const auto expired = tick.timestamp - window_;
+  while (!samples_.empty() && samples_.front().timestamp <= expired) {
+    notional_ -= samples_.front().notional;
+    volume_ -= samples_.front().volume;
+    samples_.pop_front();
+  }
+
+  return getCurrentPrice();
+}
+
+Price TimeVWAP::getCurrentPrice() const {
+  // Without traded volume in the window the last price is the best estimate
+  if (volume_ <= 0) return last_price_;
+  return notional_ / volume_;
+}
+
+Volume TimeVWAP::getVolume() const { return volume_; }
+
+void TimeVWAP::save(SnapshotWriter& writer) const {
+  writer.write(notional_);
+  writer.write(volume_);
+  writer.write(last_price_);
+  samples_.save(writer);
+}
+
+void TimeVWAP::load(SnapshotReader& reader) {
+  reader.read(notional_);
+  reader.read(volume_);
+  reader.read(last_price_);
+  samples_.load(reader);
+}
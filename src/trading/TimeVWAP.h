@@ -0,0 +1,37 @@
+#ifndef TRADINGSIMULATOR_TIMEVWAP_H
+#define TRADINGSIMULATOR_TIMEVWAP_H
+
+#include <chrono>
+
+#include "common/RingBuffer.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+
+// Volume-weighted average price of the ticks inside (now - window, now].
+class TimeVWAP {
+ public:
+  TimeVWAP(std::chrono::nanoseconds window,
+           std::chrono::nanoseconds min_tick_interval);
+  Price update(const Tick& tick);
+
+  [[nodiscard]] Price getCurrentPrice() const;
+  [[nodiscard]] Volume getVolume() const;
+
+  void save(SnapshotWriter& writer) const;
+  void load(SnapshotReader& reader);
+
+ private:
+  struct Sample {
+    std::chrono::nanoseconds timestamp;
+    double notional;
+    Volume volume;
+  };
+
+  std::chrono::nanoseconds window_;
+  RingBuffer<Sample> samples_;
+  double notional_ = 0;
+  Volume volume_ = 0;
+  Price last_price_ = 0;
+};
+
+#endif  // TRADINGSIMULATOR_TIMEVWAP_H
@@ -0,0 +1,81 @@
+#include "ExchangeServer.h"
+
+#include <thread>
+
+std::expected<std::unique_ptr<ExchangeServer>, std::string>
+ExchangeServer::Open(const Config& config) {
+  auto channel = VenueChannel::Create(config.venue_name, config.venue_capacity);
+  if (!channel) {
+    return std::unexpected(channel.error());
+  }
+  return std::unique_ptr<ExchangeServer>(
+      new ExchangeServer(std::move(channel.value()), config));
+}
+
+ExchangeServer::ExchangeServer(std::unique_ptr<VenueChannel> channel,
+                               const Config& config)
+    : channel_(std::move(channel)), exchange_(config) {}
+
+size_t ExchangeServer::poll() {
+  size_t handled = 0;
+  while (auto request = channel_->receive()) {
+    ++handled;
+    VenueMessage message = *request;
+    if (message.type == VenueMessageType::Cancel) {
+      message.type = VenueMessageType::Reject;
+      message.reason = VenueRejectReason::UnknownOrder;
+      reply(message);
+      continue;
+    }
+    if (message.type != VenueMessageType::New) continue;
+
+    ++orders_;
+    message.type = VenueMessageType::Ack;
+    reply(message);
+
+    pending_.push_back(message);
+    const Order order{message.side == 0 ? OrderSide::Buy : OrderSide::Sell,
+                      message.price, message.volume};
+    // Small enough for std::function to keep without allocating
+    exchange_.sendOrder(
+        order, [this, index = pending_.size() - 1](
+                   OrderIdentifier, Status status, std::string_view) {
+          VenueMessage& answer = pending_[index];
+          if (status == Status::Rejected) {
+            ++rejected_;
+            answer.type = VenueMessageType::Reject;
+            answer.reason = VenueRejectReason::Random;
+          } else {
+            answer.type = VenueMessageType::Fill;
+          }
+          reply(answer);
+        });
+  }
+
+  // One poll answers every order received above
+  exchange_.poll();
+  pending_.clear();
+  return handled;
+}
+
+void ExchangeServer::Run(std::stop_token stop) {
+  while (!stop.stop_requested()) {
+    if (poll() > 0) continue;
+    // Requests sent before the client detached are still answered
+    if (channel_->peerClosed() && poll() == 0) return;
+    std::this_thread::yield();
+  }
+}
+
+uint64_t ExchangeServer::orders() const { return orders_; }
+
+uint64_t ExchangeServer::rejected() const { return rejected_; }
+
+// The client drains replies while it waits to send, so a full reply ring
+// only means it has not got to them yet.
+void ExchangeServer::reply(VenueMessage message) {
+  while (!channel_->send(message)) {
+    if (channel_->peerClosed()) return;
+    std::this_thread::yield();
+  }
+}
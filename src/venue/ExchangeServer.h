@@ -0,0 +1,48 @@
+#ifndef TRADINGSIMULATOR_EXCHANGESERVER_H
+#define TRADINGSIMULATOR_EXCHANGESERVER_H
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+#include "VenueChannel.h"
+#include "config/Config.h"
+#include "trading/ExchangeApi.h"
+
+// Stand-alone simulated venue serving one RemoteExchange client over
+// [Exchange] venue_name (TradingSimulator --exchange). Every new order is
+// acked and handed to an ExchangeApi seeded like the one of an in-process
+// run, which fills it in full or rejects it, so a seeded run trades the
+// same either way. Orders are decided on arrival, so a cancel always comes
+// too late and is rejected as an unknown order.
+class ExchangeServer {
+ public:
+  static std::expected<std::unique_ptr<ExchangeServer>, std::string> Open(
+      const Config& config);
+
+  // Answers the requests queued so far; returns how many there were
+  size_t poll();
+
+  // Serves until the client detaches or a stop is requested
+  void Run(std::stop_token stop = {});
+
+  [[nodiscard]] uint64_t orders() const;
+  [[nodiscard]] uint64_t rejected() const;
+
+ private:
+  ExchangeServer(std::unique_ptr<VenueChannel> channel,
+                 const Config& config);
+  void reply(VenueMessage message);
+
+  std::unique_ptr<VenueChannel> channel_;
+  ExchangeApi exchange_;
+  // Orders of the current poll(), until the exchange answers them
+  std::vector<VenueMessage> pending_;
+  uint64_t orders_ = 0;
+  uint64_t rejected_ = 0;
+};
+
+#endif  // TRADINGSIMULATOR_EXCHANGESERVER_H
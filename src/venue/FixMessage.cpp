@@ -0,0 +1,177 @@
+#include "FixMessage.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+namespace {
+
+constexpr std::string_view kPrefix = "8=FIX.4.2\x01" "9=";
+constexpr size_t kMaxBodyDigits = 7;
+// "10=" + three digits + SOH
+constexpr size_t kTrailerSize = 7;
+constexpr size_t kHeaderReserve = kPrefix.size() + kMaxBodyDigits + 1;
+
+bool IsDigits(std::string_view text) {
+  return std::ranges::all_of(text, [](char c) { return c >= '0' && c <= '9'; });
+}
+
+unsigned CheckSum(std::string_view bytes) {
+  unsigned sum = 0;
+  for (const char c : bytes) {
+    sum += static_cast<unsigned char>(c);
+  }
+  return sum % 256;
+}
+
+FixParseResult Invalid(std::string_view error) {
+  return {.status = FixParseStatus::Invalid, .length = 0, .error = error};
+}
+
+}  // namespace
+
+std::string_view FixMessage::get(FixTag tag) const {
+  const auto wanted = static_cast<uint32_t>(tag);
+  for (size_t i = 0; i < count_; ++i) {
+    if (fields_[i].tag == wanted) return fields_[i].value;
+  }
+  return {};
+}
+
+FixParseResult ParseFixMessage(std::string_view input, FixMessage& message) {
+  constexpr FixParseResult kIncomplete{.status = FixParseStatus::Incomplete};
+  if (input.size() < kPrefix.size()) {
+    return kPrefix.starts_with(input) ? kIncomplete
+                                      : Invalid("Bad BeginString");
+  }
+  if (!input.starts_with(kPrefix)) return Invalid("Bad BeginString");
+
+  // BodyLength
+  const size_t digits_begin = kPrefix.size();
+  const size_t soh = input.find(kFixSoh, digits_begin);
+  const size_t digits_end = std::min(soh, input.size());
+  if (digits_end - digits_begin > kMaxBodyDigits ||
+      !IsDigits(input.substr(digits_begin, digits_end - digits_begin))) {
+    return Invalid("Bad BodyLength");
+  }
+  if (soh == std::string_view::npos) return kIncomplete;
+  size_t body_length = 0;
+  if (std::from_chars(input.data() + digits_begin, input.data() + soh,
+                      body_length)
+          .ec != std::errc{}) {
+    return Invalid("Bad BodyLength");
+  }
+
+  const size_t body_begin = soh + 1;
+  const size_t body_end = body_begin + body_length;
+  const size_t length = body_end + kTrailerSize;
+  if (input.size() < length) return kIncomplete;
+
+  // CheckSum
+  const auto trailer = input.substr(body_end, kTrailerSize);
+  unsigned check_sum = 0;
+  if (!trailer.starts_with("10=") || trailer.back() != kFixSoh ||
+      !IsDigits(trailer.substr(3, 3))) {
+    return Invalid("Bad CheckSum field");
+  }
+  std::from_chars(trailer.data() + 3, trailer.data() + 6, check_sum);
+  if (check_sum != CheckSum(input.substr(0, body_end))) {
+    return Invalid("CheckSum mismatch");
+  }
+
+  // Body fields
+  message.count_ = 0;
+  const auto body = input.substr(body_begin, body_length);
+  if (!body.empty() && body.back() != kFixSoh) return Invalid("Bad field");
+  size_t pos = 0;
+  while (pos < body.size()) {
+    const size_t equals = body.find('=', pos);
+    const size_t end = body.find(kFixSoh, pos);
+    uint32_t tag = 0;
+    if (equals == std::string_view::npos || equals > end ||
+        std::from_chars(body.data() + pos, body.data() + equals, tag).ptr !=
+            body.data() + equals) {
+      return Invalid("Bad field");
+    }
+    if (message.count_ == FixMessage::kMaxFields) {
+      return Invalid("Too many fields");
+    }
+    message.fields_[message.count_++] = {
+        .tag = tag, .value = body.substr(equals + 1, end - equals - 1)};
+    pos = end + 1;
+  }
+  return {.status = FixParseStatus::Complete, .length = length};
+}
+
+FixWriter::FixWriter(std::span<char> buffer, std::string_view type)
+    : buffer_(buffer),
+      body_begin_(kHeaderReserve),
+      end_(kHeaderReserve),
+      overflow_(buffer.size() < kHeaderReserve + kTrailerSize) {
+  add(FixTag::MsgType, type);
+}
+
+FixWriter& FixWriter::field(FixTag tag) {
+  if (overflow_) return *this;
+  const auto [ptr, ec] =
+      std::to_chars(buffer_.data() + end_, buffer_.data() + buffer_.size(),
+                    static_cast<uint32_t>(tag));
+  if (ec != std::errc{} || ptr == buffer_.data() + buffer_.size()) {
+    overflow_ = true;
+    return *this;
+  }
+  *ptr = '=';
+  end_ = static_cast<size_t>(ptr + 1 - buffer_.data());
+  return *this;
+}
+
+FixWriter& FixWriter::add(FixTag tag, std::string_view value) {
+  field(tag);
+  if (overflow_ || buffer_.size() - end_ < value.size() + 1) {
+    overflow_ = true;
+    return *this;
+  }
+  std::memcpy(buffer_.data() + end_, value.data(), value.size());
+  end_ += value.size();
+  buffer_[end_++] = kFixSoh;
+  return *this;
+}
+
+FixWriter& FixWriter::add(FixTag tag, uint64_t value) {
+  std::array<char, 20> text{};
+  const auto [ptr, ec] =
+      std::to_chars(text.data(), text.data() + text.size(), value);
+  return add(tag, std::string_view(text.data(), ptr));
+}
+
+FixWriter& FixWriter::add(FixTag tag, double value) {
+  std::array<char, 32> text{};
+  const auto [ptr, ec] =
+      std::to_chars(text.data(), text.data() + text.size(), value);
+  return add(tag, std::string_view(text.data(), ptr));
+}
+
+std::string_view FixWriter::finish() {
+  if (overflow_ || buffer_.size() - end_ < kTrailerSize) return {};
+
+  std::array<char, kHeaderReserve> header{};
+  std::memcpy(header.data(), kPrefix.data(), kPrefix.size());
+  const auto [ptr, ec] =
+      std::to_chars(header.data() + kPrefix.size(),
+                    header.data() + header.size(), end_ - body_begin_);
+  if (ec != std::errc{} || ptr == header.data() + header.size()) return {};
+  *ptr = kFixSoh;
+  const auto header_size = static_cast<size_t>(ptr + 1 - header.data());
+  const size_t begin = body_begin_ - header_size;
+  std::memcpy(buffer_.data() + begin, header.data(), header_size);
+
+  const unsigned check_sum = CheckSum(
+      std::string_view(buffer_.data() + begin, end_ - begin));
+  char* trailer = buffer_.data() + end_;
+  std::memcpy(trailer, "10=", 3);
+  trailer[3] = static_cast<char>('0' + check_sum / 100);
+  trailer[4] = static_cast<char>('0' + check_sum / 10 % 10);
+  trailer[5] = static_cast<char>('0' + check_sum % 10);
+  trailer[6] = kFixSoh;
+  return {buffer_.data() + begin, end_ + kTrailerSize - begin};
+}
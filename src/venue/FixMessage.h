@@ -0,0 +1,93 @@
+#ifndef TRADINGSIMULATOR_FIXMESSAGE_H
+#define TRADINGSIMULATOR_FIXMESSAGE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+// Tag=value messages in FIX 4.2 framing, spoken by OrderGateway:
+//   8=FIX.4.2<SOH>9=<body length><SOH><body>10=<checksum><SOH>
+// where the body is a run of tag=value<SOH> fields and the checksum is the
+// sum of all bytes before "10=" modulo 256, as three digits. There is no
+// session layer: no logon, sequence numbers or resends.
+
+inline constexpr char kFixSoh = '\x01';
+
+// Only the tags the gateway reads or writes are named
+enum class FixTag : uint32_t {
+  BeginString = 8,
+  BodyLength = 9,
+  CheckSum = 10,
+  ClOrdId = 11,
+  MsgType = 35,
+  OrderId = 37,
+  OrderQty = 38,
+  OrdStatus = 39,
+  Price = 44,
+  Side = 54,
+  Text = 58,
+  ExecType = 150,
+};
+
+enum class FixParseStatus { Complete, Incomplete, Invalid };
+
+struct FixParseResult {
+  FixParseStatus status;
+  size_t length = 0;       // bytes taken by a complete message
+  std::string_view error;  // static text, when invalid
+};
+
+// Body fields of one parsed message. Values point into the parsed buffer,
+// so a message is only valid while that buffer is left alone.
+class FixMessage {
+ public:
+  static constexpr size_t kMaxFields = 32;
+
+  // Value of the first `tag` field, empty if there is none
+  [[nodiscard]] std::string_view get(FixTag tag) const;
+  [[nodiscard]] std::string_view type() const { return get(FixTag::MsgType); }
+  [[nodiscard]] size_t fieldCount() const { return count_; }
+
+ private:
+  friend FixParseResult ParseFixMessage(std::string_view input,
+                                        FixMessage& message);
+
+  struct Field {
+    uint32_t tag;
+    std::string_view value;
+  };
+
+  std::array<Field, kMaxFields> fields_{};
+  size_t count_ = 0;
+};
+
+// Parses the message at the start of `input` in place, without allocating.
+// Incomplete means `input` holds a valid prefix of a message.
+FixParseResult ParseFixMessage(std::string_view input, FixMessage& message);
+
+// Builds one message in a caller's buffer. The body is written first and
+// the header is placed right in front of it by finish(), so nothing is
+// moved.
+class FixWriter {
+ public:
+  FixWriter(std::span<char> buffer, std::string_view type);
+
+  FixWriter& add(FixTag tag, std::string_view value);
+  FixWriter& add(FixTag tag, uint64_t value);
+  FixWriter& add(FixTag tag, double value);
+
+  // The finished message, empty if it did not fit into the buffer
+  std::string_view finish();
+
+ private:
+  FixWriter& field(FixTag tag);
+
+  std::span<char> buffer_;
+  size_t body_begin_;
+  size_t end_;
+  bool overflow_ = false;
+};
+
+#endif  // TRADINGSIMULATOR_FIXMESSAGE_H
@@ -0,0 +1,344 @@
+#include "OrderGateway.h"
+
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <format>
+#endif
+
+namespace {
+
+constexpr size_t kReceiveBufferSize = 64 * 1024;
+// Unsent reports above which a client is no longer read from
+constexpr size_t kOutputLimit = 256 * 1024;
+constexpr size_t kReportSize = 256;
+constexpr size_t kMaxClOrdId = 64;
+
+}  // namespace
+
+struct OrderGateway::Connection {
+  int fd;
+  std::vector<char> input = std::vector<char>(kReceiveBufferSize);
+  size_t input_size = 0;
+  std::vector<char> output;
+  size_t output_sent = 0;
+  uint32_t events = 0;   // registered with epoll
+  bool closing = false;  // close once the output is sent
+};
+
+#ifdef __linux__
+
+namespace {
+
+constexpr int kMaxEvents = 64;
+
+bool ParsePositive(std::string_view text, double& value) {
+  const auto [ptr, ec] =
+      std::from_chars(text.data(), text.data() + text.size(), value);
+  return ec == std::errc{} && ptr == text.data() + text.size() &&
+         value > 0.0 && std::isfinite(value);
+}
+
+}  // namespace
+
+std::expected<std::unique_ptr<OrderGateway>, std::string> OrderGateway::Open(
+    const Config& config) {
+  const int listener =
+      ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (listener < 0) {
+    return std::unexpected(std::format("OrderGateway: cannot create socket: {}",
+                                       std::strerror(errno)));
+  }
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(config.gateway_port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  const int one = 1;
+  if (::setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) !=
+          0 ||
+      ::bind(listener, reinterpret_cast<const sockaddr*>(&address),
+             sizeof(address)) != 0 ||
+      ::listen(listener, SOMAXCONN) != 0) {
+    const int error = errno;
+    ::close(listener);
+    return std::unexpected(
+        std::format("OrderGateway: cannot listen on port {}: {}",
+                    config.gateway_port, std::strerror(error)));
+  }
+
+  const int epoll = ::epoll_create1(EPOLL_CLOEXEC);
+  epoll_event event{.events = EPOLLIN, .data = {.ptr = nullptr}};
+  if (epoll < 0 || ::epoll_ctl(epoll, EPOLL_CTL_ADD, listener, &event) != 0) {
+    const int error = errno;
+    if (epoll >= 0) ::close(epoll);
+    ::close(listener);
+    return std::unexpected(std::format("OrderGateway: cannot set up epoll: {}",
+                                       std::strerror(error)));
+  }
+  return std::unique_ptr<OrderGateway>(
+      new OrderGateway(listener, epoll, config));
+}
+
+OrderGateway::OrderGateway(int listener, int epoll, const Config& config)
+    : listener_(listener), epoll_(epoll), exchange_(config) {}
+
+OrderGateway::~OrderGateway() {
+  for (const auto& [fd, connection] : connections_) {
+    ::close(fd);
+  }
+  ::close(epoll_);
+  ::close(listener_);
+}
+
+size_t OrderGateway::poll(std::chrono::milliseconds timeout) {
+  std::array<epoll_event, kMaxEvents> events{};
+  const int ready = ::epoll_wait(epoll_, events.data(), kMaxEvents,
+                                 static_cast<int>(timeout.count()));
+  const uint64_t received = stats_.messages;
+  // Each connection shows up at most once per wait, so one closed while
+  // handling its event is not seen again
+  for (int i = 0; i < ready; ++i) {
+    auto* connection = static_cast<Connection*>(events[i].data.ptr);
+    if (connection == nullptr) {
+      acceptClients();
+    } else if (events[i].events & EPOLLIN) {
+      receive(*connection);
+    } else if (events[i].events & EPOLLOUT) {
+      flush(*connection);
+    } else {
+      close(*connection);
+    }
+  }
+  return stats_.messages - received;
+}
+
+void OrderGateway::Run(std::stop_token stop) {
+  while (!stop.stop_requested()) {
+    poll(std::chrono::milliseconds(50));
+    if (stats_.connections > 0 && connections_.empty()) return;
+  }
+}
+
+uint16_t OrderGateway::port() const {
+  sockaddr_in address{};
+  socklen_t size = sizeof(address);
+  ::getsockname(listener_, reinterpret_cast<sockaddr*>(&address), &size);
+  return ntohs(address.sin_port);
+}
+
+const OrderGatewayStats& OrderGateway::stats() const { return stats_; }
+
+void OrderGateway::acceptClients() {
+  while (true) {
+    const int fd =
+        ::accept4(listener_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) return;
+    // Reports go out as soon as they are written
+    const int one = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    auto connection = std::make_unique<Connection>(fd);
+    connection->events = EPOLLIN;
+    epoll_event event{.events = EPOLLIN, .data = {.ptr = connection.get()}};
+    if (::epoll_ctl(epoll_, EPOLL_CTL_ADD, fd, &event) != 0) {
+      ::close(fd);
+      continue;
+    }
+    connections_.emplace(fd, std::move(connection));
+    ++stats_.connections;
+  }
+}
+
+void OrderGateway::receive(Connection& connection) {
+  const ssize_t n =
+      ::recv(connection.fd, connection.input.data() + connection.input_size,
+             connection.input.size() - connection.input_size, 0);
+  if (n < 0 && (errno == EAGAIN || errno == EINTR)) return;
+  if (n <= 0) {
+    close(connection);
+    return;
+  }
+  connection.input_size += static_cast<size_t>(n);
+
+  const std::string_view input(connection.input.data(),
+                               connection.input_size);
+  size_t consumed = 0;
+  FixMessage message;
+  while (!connection.closing) {
+    const auto result = ParseFixMessage(input.substr(consumed), message);
+    if (result.status == FixParseStatus::Incomplete) break;
+    if (result.status == FixParseStatus::Invalid) {
+      reject(connection, result.error);
+      connection.closing = true;
+      break;
+    }
+    ++stats_.messages;
+    handle(connection, message);
+    consumed += result.length;
+  }
+
+  // One poll answers every order of this read, while their ClOrdIDs are
+  // still in the buffer
+  exchange_.poll();
+  pending_.clear();
+
+  if (connection.closing) {
+    connection.input_size = 0;
+  } else {
+    std::memmove(connection.input.data(), input.data() + consumed,
+                 input.size() - consumed);
+    connection.input_size -= consumed;
+    if (connection.input_size == connection.input.size()) {
+      reject(connection, "Message too long");
+      connection.closing = true;
+    }
+  }
+  flush(connection);
+}
+
+void OrderGateway::handle(Connection& connection, const FixMessage& message) {
+  if (message.type() != "D") {
+    reject(connection, "Unsupported MsgType");
+    return;
+  }
+  const auto cl_ord_id = message.get(FixTag::ClOrdId);
+  if (cl_ord_id.size() > kMaxClOrdId) {
+    reject(connection, "ClOrdID too long");
+    return;
+  }
+
+  const auto side = message.get(FixTag::Side);
+  PendingReport pending{
+      .connection = &connection,
+      .cl_ord_id = cl_ord_id,
+      .order = {.side = side == "2" ? OrderSide::Sell : OrderSide::Buy,
+                .price = 0.0,
+                .volume = 0.0}};
+  std::string_view error;
+  if (cl_ord_id.empty()) {
+    error = "Missing ClOrdID";
+  } else if (side != "1" && side != "2") {
+    error = "Bad Side";
+  } else if (!ParsePositive(message.get(FixTag::OrderQty),
+                            pending.order.volume)) {
+    error = "Bad OrderQty";
+  } else if (!ParsePositive(message.get(FixTag::Price),
+                            pending.order.price)) {
+    error = "Bad Price";
+  }
+  if (!error.empty()) {
+    report(pending, 0, Status::Rejected, error);
+    return;
+  }
+
+  ++stats_.orders;
+  pending_.push_back(pending);
+  // Small enough for std::function to keep without allocating
+  exchange_.sendOrder(
+      pending.order,
+      [this, index = pending_.size() - 1](OrderIdentifier id, Status status,
+                                          std::string_view text) {
+        report(pending_[index], id, status, text);
+      });
+}
+
+void OrderGateway::report(const PendingReport& pending, OrderIdentifier id,
+                          Status status, std::string_view text) {
+  if (status == Status::Rejected) ++stats_.rejected;
+  const std::string_view state = status == Status::Executed ? "2" : "8";
+
+  std::array<char, kReportSize> buffer{};
+  FixWriter writer(buffer, "8");
+  if (id != 0) writer.add(FixTag::OrderId, uint64_t{id});
+  writer.add(FixTag::ClOrdId, pending.cl_ord_id)
+      .add(FixTag::ExecType, state)
+      .add(FixTag::OrdStatus, state)
+      .add(FixTag::Side, pending.order.side == OrderSide::Buy ? "1" : "2")
+      .add(FixTag::OrderQty, pending.order.volume)
+      .add(FixTag::Price, pending.order.price);
+  if (!text.empty()) writer.add(FixTag::Text, text);
+  const auto message = writer.finish();
+  auto& output = pending.connection->output;
+  output.insert(output.end(), message.begin(), message.end());
+}
+
+void OrderGateway::reject(Connection& connection, std::string_view text) {
+  ++stats_.malformed;
+  std::array<char, kReportSize> buffer{};
+  const auto message =
+      FixWriter(buffer, "3").add(FixTag::Text, text).finish();
+  connection.output.insert(connection.output.end(), message.begin(),
+                           message.end());
+}
+
+void OrderGateway::flush(Connection& connection) {
+  auto& output = connection.output;
+  while (connection.output_sent < output.size()) {
+    const ssize_t n = ::send(connection.fd,
+                             output.data() + connection.output_sent,
+                             output.size() - connection.output_sent,
+                             MSG_NOSIGNAL);
+    if (n > 0) {
+      connection.output_sent += static_cast<size_t>(n);
+    } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      break;
+    } else if (n == 0 || errno != EINTR) {
+      close(connection);
+      return;
+    }
+  }
+  if (connection.output_sent == output.size()) {
+    output.clear();
+    connection.output_sent = 0;
+    if (connection.closing) {
+      close(connection);
+      return;
+    }
+  }
+
+  const size_t backlog = output.size() - connection.output_sent;
+  const uint32_t events =
+      (connection.closing || backlog >= kOutputLimit ? 0u : EPOLLIN) |
+      (backlog > 0 ? EPOLLOUT : 0u);
+  if (events != connection.events) {
+    epoll_event event{.events = events, .data = {.ptr = &connection}};
+    ::epoll_ctl(epoll_, EPOLL_CTL_MOD, connection.fd, &event);
+    connection.events = events;
+  }
+}
+
+void OrderGateway::close(Connection& connection) {
+  const int fd = connection.fd;
+  ::epoll_ctl(epoll_, EPOLL_CTL_DEL, fd, nullptr);
+  ::close(fd);
+  connections_.erase(fd);
+}
+
+#else
+
+std::expected<std::unique_ptr<OrderGateway>, std::string> OrderGateway::Open(
+    const Config&) {
+  return std::unexpected("OrderGateway: only available on Linux");
+}
+
+OrderGateway::~OrderGateway() = default;
+
+size_t OrderGateway::poll(std::chrono::milliseconds) { return 0; }
+
+void OrderGateway::Run(std::stop_token) {}
+
+uint16_t OrderGateway::port() const { return 0; }
+
+const OrderGatewayStats& OrderGateway::stats() const { return stats_; }
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef TRADINGSIMULATOR_ORDERGATEWAY_H
+#define TRADINGSIMULATOR_ORDERGATEWAY_H
+
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "FixMessage.h"
+#include "config/Config.h"
+#include "trading/ExchangeApi.h"
+
+struct OrderGatewayStats {
+  uint64_t connections = 0;  // accepted
+  uint64_t messages = 0;     // complete messages received
+  uint64_t orders = 0;       // passed to the exchange
+  uint64_t rejected = 0;     // by the exchange or for invalid fields
+  uint64_t malformed = 0;    // answered with a session-level Reject
+};
+
+// Order entry for external clients (TradingSimulator --gateway): FIX-like
+// NewOrderSingle messages (35=D with 11, 54, 38 and 44) over TCP on
+// 127.0.0.1:[Exchange] gateway_port go to an ExchangeApi seeded like an
+// in-process run, and each is answered with an ExecutionReport (35=8),
+// filled (39=2) or rejected (39=8 with the reason in 58). Other message
+// types get a Reject (35=3); a message that cannot be framed also closes
+// the connection.
+//
+// One epoll loop serves every connection. Messages are parsed in place in
+// the connection's receive buffer, all orders of one read go to the
+// exchange before a single poll answers them, and the reports are written
+// back with one send. A client that does not read its reports is not read
+// from either until it catches up. Linux-only.
+class OrderGateway {
+ public:
+  // A gateway_port of 0 listens on any free port, see port()
+  static std::expected<std::unique_ptr<OrderGateway>, std::string> Open(
+      const Config& config);
+  ~OrderGateway();
+
+  OrderGateway(const OrderGateway&) = delete;
+  OrderGateway& operator=(const OrderGateway&) = delete;
+
+  // Handles the events ready within `timeout`; returns the number of
+  // messages received
+  size_t poll(std::chrono::milliseconds timeout);
+
+  // Serves until a stop is requested, or until every client has gone after
+  // the first one connected
+  void Run(std::stop_token stop = {});
+
+  [[nodiscard]] uint16_t port() const;
+  [[nodiscard]] const OrderGatewayStats& stats() const;
+
+ private:
+  struct Connection;
+  struct PendingReport {
+    Connection* connection;
+    std::string_view cl_ord_id;  // in the connection's receive buffer
+    Order order;
+  };
+
+  OrderGateway(int listener, int epoll, const Config& config);
+  void acceptClients();
+  void receive(Connection& connection);
+  void handle(Connection& connection, const FixMessage& message);
+  void report(const PendingReport& pending, OrderIdentifier id,
+              Status status, std::string_view text);
+  void reject(Connection& connection, std::string_view text);
+  void flush(Connection& connection);
+  void close(Connection& connection);
+
+  int listener_;
+  int epoll_;
+  ExchangeApi exchange_;
+  std::unordered_map<int, std::unique_ptr<Connection>> connections_;
+  std::vector<PendingReport> pending_;  // orders of the current read
+  OrderGatewayStats stats_;
+};
+
+#endif  // TRADINGSIMULATOR_ORDERGATEWAY_H
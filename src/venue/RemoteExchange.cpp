@@ -0,0 +1,143 @@
+#include "RemoteExchange.h"
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+int64_t Now() {
+  return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+// Acks and late cancels are not the order's final reply
+bool IsFinal(const VenueMessage& reply) {
+  return reply.type != VenueMessageType::Ack &&
+         reply.reason != VenueRejectReason::UnknownOrder;
+}
+
+}  // namespace
+
+RemoteExchange::RemoteExchange(const Config& config) {
+  auto channel = VenueChannel::Attach(config.venue_name);
+  if (!channel) {
+    throw std::runtime_error(channel.error());
+  }
+  channel_ = std::move(channel.value());
+}
+
+RemoteExchange::~RemoteExchange() = default;
+
+OrderIdentifier RemoteExchange::sendOrder(const Order& order,
+                                          ExchangeCallback cb) {
+  const OrderIdentifier id = nextId_++;
+  in_flight_.emplace(id, std::move(cb));
+  send({.type = VenueMessageType::New,
+        .side = static_cast<uint8_t>(order.side == OrderSide::Buy ? 0 : 1),
+        .reason = VenueRejectReason::None,
+        .reserved = {},
+        .id = id,
+        .price = order.price,
+        .volume = order.volume,
+        .sent = Now()});
+  return id;
+}
+
+OrderIdentifier RemoteExchange::sendOrders(std::span<const Order> orders,
+                                             ExchangeCallback cb) {
+  const OrderIdentifier first_id = nextId_;
+  for (const Order& order : orders) {
+    sendOrder(order, cb);
+  }
+  return first_id;
+}
+
+void RemoteExchange::cancelOrder(OrderIdentifier id) {
+  send({.type = VenueMessageType::Cancel,
+        .side = 0,
+        .reason = VenueRejectReason::None,
+        .reserved = {},
+        .id = id,
+        .price = 0,
+        .volume = 0,
+        .sent = Now()});
+}
+
+void RemoteExchange::poll() {
+  for (const auto& reply : received_) {
+    deliver(reply);
+  }
+  received_.clear();
+
+  while (!in_flight_.empty()) {
+    if (auto reply = receive()) {
+      deliver(*reply);
+      continue;
+    }
+    if (channel_->peerClosed()) {
+      // Replies sent before the shutdown are already in the ring
+      while (auto reply = receive()) deliver(*reply);
+      auto orphans = std::move(in_flight_);
+      in_flight_.clear();
+      for (const auto& [id, cb] : orphans) {
+        if (cb) cb(id, Status::Rejected, "Exchange disconnected");
+      }
+      return;
+    }
+    std::this_thread::yield();
+  }
+}
+
+void RemoteExchange::save(SnapshotWriter& writer) const {
+  writer.write(nextId_);
+}
+
+void RemoteExchange::load(SnapshotReader& reader, const ExchangeCallback&) {
+  reader.read(nextId_);
+}
+
+LatencyStats RemoteExchange::getRoundTripStats() const {
+  return round_trips_.summarize();
+}
+
+// A full request ring means the venue is waiting for us to take replies
+void RemoteExchange::send(const VenueMessage& message) {
+  while (!channel_->send(message)) {
+    if (channel_->peerClosed()) return;
+    drain();
+    std::this_thread::yield();
+  }
+}
+
+void RemoteExchange::drain() {
+  while (auto reply = receive()) {
+    received_.push_back(*reply);
+  }
+}
+
+std::optional<VenueMessage> RemoteExchange::receive() {
+  auto reply = channel_->receive();
+  if (reply && IsFinal(*reply) && in_flight_.contains(reply->id)) {
+    round_trips_.record(std::chrono::nanoseconds(Now() - reply->sent));
+  }
+  return reply;
+}
+
+void RemoteExchange::deliver(const VenueMessage& reply) {
+  if (!IsFinal(reply)) {
+    return;  // the final reply follows, or the cancel came too late
+  }
+  auto it = in_flight_.find(reply.id);
+  if (it == in_flight_.end()) {
+    return;
+  }
+
+  const auto cb = std::move(it->second);
+  in_flight_.erase(it);
+  if (!cb) return;
+  if (reply.type == VenueMessageType::Fill) {
+    cb(reply.id, Status::Executed, "");
+  } else {
+    cb(reply.id, Status::Rejected, "Random rejection");
+  }
+}
@@ -0,0 +1,63 @@
+#ifndef TRADINGSIMULATOR_REMOTEEXCHANGE_H
+#define TRADINGSIMULATOR_REMOTEEXCHANGE_H
+
+#include <memory>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "VenueChannel.h"
+#include "common/LatencyHistogram.h"
+#include "common/Snapshot.h"
+#include "common/Types.h"
+#include "config/Config.h"
+#include "trading/ExchangeApi.h"
+
+// Exchange talking to an ExchangeServer process over [Exchange] venue_name
+// ([Exchange] venue = remote) instead of deciding replies in-process.
+// sendOrder() only queues the request; poll() waits for the final reply of
+// every order sent so far, so OrderManager sees the same synchronous
+// behaviour as with ExchangeApi and each poll() is one measured round trip.
+// If the venue shuts down, orders still in flight are rejected.
+class RemoteExchange {
+ public:
+  explicit RemoteExchange(const Config& config);  // throws if not attached
+  ~RemoteExchange();                              // detaches
+
+  RemoteExchange(const RemoteExchange&) = delete;
+  RemoteExchange& operator=(const RemoteExchange&) = delete;
+
+  OrderIdentifier sendOrder(const Order& order, ExchangeCallback cb);
+  // One request per order, each holding a copy of cb
+  OrderIdentifier sendOrders(std::span<const Order> orders,
+                             ExchangeCallback cb);
+
+  // Asks the venue to cancel an order still in flight
+  void cancelOrder(OrderIdentifier id);
+
+  void poll();
+
+  // Only the id sequence is saved: the venue's generator lives in the
+  // ExchangeServer process, so checkpoints are refused for remote runs
+  void save(SnapshotWriter& writer) const;
+  void load(SnapshotReader& reader, const ExchangeCallback& cb);
+
+  // Time from sendOrder() until the fill or rejection is taken off the
+  // reply ring, however long it then waits to be delivered
+  [[nodiscard]] LatencyStats getRoundTripStats() const;
+
+ private:
+  void send(const VenueMessage& message);
+  void drain();
+  std::optional<VenueMessage> receive();  // records final round trips
+  void deliver(const VenueMessage& reply);
+
+  std::unique_ptr<VenueChannel> channel_;
+  std::unordered_map<OrderIdentifier, ExchangeCallback> in_flight_;
+  std::vector<VenueMessage> received_;  // drained while waiting to send
+  LatencyHistogram round_trips_;
+  OrderIdentifier nextId_ = 1;
+};
+
+#endif  // TRADINGSIMULATOR_REMOTEEXCHANGE_H
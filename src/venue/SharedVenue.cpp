@@ -0,0 +1,217 @@
+#include "SharedVenue.h"
+
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+namespace {
+
+// Venues open in this process, by name; touched only when a venue is
+// created or destroyed and when a session attaches
+std::mutex& RegistryMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::unordered_map<std::string, SharedVenue*>& Registry() {
+  static std::unordered_map<std::string, SharedVenue*> registry;
+  return registry;
+}
+
+int64_t Now() {
+  return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+}  // namespace
+
+std::expected<std::unique_ptr<SharedVenue>, std::string> SharedVenue::Create(
+    const Config& config) {
+  std::unique_ptr<SharedVenue> venue(new SharedVenue(config));
+  std::lock_guard lock(RegistryMutex());
+  if (!Registry().emplace(venue->name_, venue.get()).second) {
+    venue->name_.clear();  // not ours to unregister
+    return std::unexpected(std::format(
+        "SharedVenue: a venue named {} is already open", config.venue_name));
+  }
+  return venue;
+}
+
+SharedVenue::SharedVenue(const Config& config)
+    : name_(config.venue_name),
+      capacity_(std::bit_ceil(config.venue_capacity)),
+      intake_(config.venue_capacity),
+      exchange_(config) {
+  for (uint64_t i = 0; i < config.venue_sessions; ++i) {
+    sessions_.push_back(std::make_unique<Session>(capacity_));
+  }
+  on_reply_ = [this](OrderIdentifier id, Status status, std::string_view) {
+    reply(id, status);
+  };
+  routes_.reserve(intake_.capacity());
+}
+
+SharedVenue::~SharedVenue() {
+  if (name_.empty()) return;
+  std::lock_guard lock(RegistryMutex());
+  Registry().erase(name_);
+}
+
+SharedVenue* SharedVenue::Find(const std::string& name) {
+  std::lock_guard lock(RegistryMutex());
+  const auto it = Registry().find(name);
+  return it == Registry().end() ? nullptr : it->second;
+}
+
+size_t SharedVenue::poll() {
+  routes_.clear();
+  while (auto request = intake_.pop()) {
+    const OrderIdentifier exchange_id =
+        exchange_.sendOrder(request->order, on_reply_);
+    if (routes_.empty()) batch_first_ = exchange_id;
+    routes_.push_back({request->session, request->id, request->sent});
+  }
+  if (routes_.empty()) return 0;
+
+  exchange_.poll();
+  orders_.fetch_add(routes_.size(), std::memory_order_relaxed);
+  batches_.fetch_add(1, std::memory_order_relaxed);
+  return routes_.size();
+}
+
+void SharedVenue::reply(OrderIdentifier exchange_id, Status status) {
+  const Route& route = routes_[exchange_id - batch_first_];
+  if (status == Status::Rejected) {
+    rejected_.fetch_add(1, std::memory_order_relaxed);
+  }
+  // Cannot fail: a session never has more orders in flight than its queue
+  // holds
+  sessions_[route.session]->replies.push(
+      {.id = route.id, .status = status, .sent = route.sent});
+}
+
+void SharedVenue::Run(std::stop_token stop) {
+  while (!stop.stop_requested()) {
+    if (poll() == 0) {
+      std::this_thread::yield();
+    }
+  }
+  poll();
+  stopped_.store(true, std::memory_order_release);
+}
+
+SharedVenueStats SharedVenue::stats() const {
+  return {.sessions = std::min<uint64_t>(
+              attached_.load(std::memory_order_relaxed), sessions_.size()),
+          .orders = orders_.load(std::memory_order_relaxed),
+          .rejected = rejected_.load(std::memory_order_relaxed),
+          .batches = batches_.load(std::memory_order_relaxed)};
+}
+
+SharedExchange::SharedExchange(const Config& config)
+    : venue_(SharedVenue::Find(config.venue_name)) {
+  if (venue_ == nullptr) {
+    throw std::runtime_error(std::format(
+        "SharedExchange: no shared venue named {}", config.venue_name));
+  }
+  session_ = venue_->attached_.fetch_add(1, std::memory_order_relaxed);
+  if (session_ >= venue_->sessions_.size()) {
+    throw std::runtime_error(
+        std::format("SharedExchange: all {} sessions of {} are taken",
+                    venue_->sessions_.size(), config.venue_name));
+  }
+  replies_ = &venue_->sessions_[session_]->replies;
+  callbacks_.resize(replies_->capacity());
+  mask_ = callbacks_.size() - 1;
+  first_id_ = session_ * kSharedSessionIds + 1;
+  nextId_ = first_id_;
+  nextReply_ = first_id_;
+}
+
+OrderIdentifier SharedExchange::sendOrder(const Order& order,
+                                          ExchangeCallback cb) {
+  // Room for the reply: wait for the oldest order in flight if need be
+  while (nextId_ - nextReply_ == callbacks_.size()) {
+    awaitReply();
+  }
+
+  const OrderIdentifier id = nextId_++;
+  callbacks_[(id - first_id_) & mask_] = std::move(cb);
+  const SharedVenueRequest request{
+      .session = session_, .order = order, .id = id, .sent = Now()};
+  while (!venue_->intake_.push(request)) {
+    if (venue_->stopped_.load(std::memory_order_acquire)) break;
+    std::this_thread::yield();
+  }
+  return id;
+}
+
+OrderIdentifier SharedExchange::sendOrders(std::span<const Order> orders,
+                                             ExchangeCallback cb) {
+  const OrderIdentifier first_id = nextId_;
+  for (const Order& order : orders) {
+    sendOrder(order, cb);
+  }
+  return first_id;
+}
+
+void SharedExchange::poll() {
+  while (nextReply_ != nextId_) {
+    awaitReply();
+  }
+  for (const auto& reply : received_) {
+    if (reply.cb) reply.cb(reply.id, reply.status, reply.error);
+  }
+  received_.clear();
+}
+
+bool SharedExchange::collect() {
+  bool received = false;
+  while (auto reply = replies_->pop()) {
+    received = true;
+    round_trips_.record(std::chrono::nanoseconds(Now() - reply->sent));
+    nextReply_ = reply->id + 1;
+    auto cb = std::move(callbacks_[(reply->id - first_id_) & mask_]);
+    if (reply->status == Status::Executed) {
+      received_.push_back({reply->id, Status::Executed, "", std::move(cb)});
+    } else {
+      received_.push_back(
+          {reply->id, Status::Rejected, "Random rejection", std::move(cb)});
+    }
+  }
+  return received;
+}
+
+void SharedExchange::awaitReply() {
+  while (!collect()) {
+    if (venue_->stopped_.load(std::memory_order_acquire)) {
+      // Replies decided before the stop are already queued
+      if (collect()) return;
+      while (nextReply_ != nextId_) {
+        const OrderIdentifier id = nextReply_++;
+        received_.push_back({id, Status::Rejected, "Exchange disconnected",
+                             std::move(callbacks_[(id - first_id_) & mask_])});
+      }
+      return;
+    }
+    std::this_thread::yield();
+  }
+}
+
+void SharedExchange::save(SnapshotWriter& writer) const {
+  writer.write(nextId_ - first_id_);
+}
+
+void SharedExchange::load(SnapshotReader& reader, const ExchangeCallback&) {
+  OrderIdentifier sent = 0;
+  reader.read(sent);
+  nextId_ = first_id_ + sent;
+  nextReply_ = nextId_;
+}
+
+LatencyStats SharedExchange::getRoundTripStats() const {
+  return round_trips_.summarize();
+}
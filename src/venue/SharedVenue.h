@@ -0,0 +1,171 @@
+#ifndef TRADINGSIMULATOR_SHAREDVENUE_H
+#define TRADINGSIMULATOR_SHAREDVENUE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/LatencyHistogram.h"
+#include "common/MpscQueue.h"
+#include "common/Snapshot.h"
+#include "common/SpscQueue.h"
+#include "common/Types.h"
+#include "config/Config.h"
+#include "trading/ExchangeApi.h"
+
+// Order ids of one SharedExchange session: session k numbers its orders
+// from k * kSharedSessionIds + 1, so no two sessions ever need to agree on
+// the next id
+inline constexpr OrderIdentifier kSharedSessionIds = OrderIdentifier{1} << 40;
+
+struct SharedVenueRequest {
+  uint32_t session;
+  Order order;
+  OrderIdentifier id;
+  int64_t sent;  // steady_clock nanoseconds, echoed in the reply
+};
+
+struct SharedVenueReply {
+  OrderIdentifier id;
+  Status status;
+  int64_t sent;
+};
+
+struct SharedVenueStats {
+  uint64_t sessions = 0;
+  uint64_t orders = 0;
+  uint64_t rejected = 0;
+  uint64_t batches = 0;  // polls of the ExchangeApi with orders to decide
+};
+
+// One ExchangeApi shared by strategies on many threads of this process
+// ([Exchange] venue = shared), registered under [Exchange] venue_name.
+// Strategies reach it through SharedExchange sessions. Orders from all of
+// them go through one lock-free multi-producer intake queue to the thread
+// running the venue, which decides everything queued so far with a single
+// ExchangeApi poll and routes each reply to the single-producer
+// single-consumer queue of the session that sent it. Sessions number their
+// own orders from disjoint id ranges, so sending takes no shared counter
+// beyond the intake queue's tail.
+//
+// The venue must outlive its sessions. Which order meets which random
+// decision depends on thread timing; with one session a seeded run trades
+// as it does against a local ExchangeApi.
+class SharedVenue {
+ public:
+  static std::expected<std::unique_ptr<SharedVenue>, std::string> Create(
+      const Config& config);
+  ~SharedVenue();  // unregisters the name
+
+  SharedVenue(const SharedVenue&) = delete;
+  SharedVenue& operator=(const SharedVenue&) = delete;
+
+  // Decides the orders queued so far; returns how many there were
+  size_t poll();
+
+  // Serves until a stop is requested; sessions waiting on replies are
+  // then answered with rejections
+  void Run(std::stop_token stop = {});
+
+  [[nodiscard]] SharedVenueStats stats() const;
+
+ private:
+  friend class SharedExchange;
+
+  struct Session {
+    explicit Session(size_t capacity) : replies(capacity) {}
+    SpscQueue<SharedVenueReply> replies;
+  };
+
+  // Route of an order between the intake and its reply
+  struct Route {
+    uint32_t session;
+    OrderIdentifier id;
+    int64_t sent;
+  };
+
+  explicit SharedVenue(const Config& config);
+  static SharedVenue* Find(const std::string& name);
+  void reply(OrderIdentifier exchange_id, Status status);
+
+  std::string name_;
+  size_t capacity_;
+  MpscQueue<SharedVenueRequest> intake_;
+  // Fixed at creation: sessions attach without locking the venue thread out
+  std::vector<std::unique_ptr<Session>> sessions_;
+  std::atomic<uint32_t> attached_ = 0;
+  std::atomic<bool> stopped_ = false;
+
+  // Venue thread only
+  ExchangeApi exchange_;
+  ExchangeCallback on_reply_;
+  std::vector<Route> routes_;  // of the batch being decided
+  OrderIdentifier batch_first_ = 0;
+  std::atomic<uint64_t> orders_ = 0;
+  std::atomic<uint64_t> rejected_ = 0;
+  std::atomic<uint64_t> batches_ = 0;
+};
+
+// Exchange for one strategy thread on the SharedVenue named by [Exchange]
+// venue_name. Like RemoteExchange, sendOrder() only queues the request and
+// poll() waits for the reply of every order sent so far. A session keeps
+// at most venue_capacity orders in flight, so the venue never finds its
+// reply queue full; replies taken while waiting for room are still only
+// delivered by poll().
+class SharedExchange {
+ public:
+  // Throws if no venue of that name is open or all its sessions are taken
+  explicit SharedExchange(const Config& config);
+
+  SharedExchange(const SharedExchange&) = delete;
+  SharedExchange& operator=(const SharedExchange&) = delete;
+
+  OrderIdentifier sendOrder(const Order& order, ExchangeCallback cb);
+  // One request per order, each holding a copy of cb
+  OrderIdentifier sendOrders(std::span<const Order> orders,
+                             ExchangeCallback cb);
+  void poll();
+
+  // Only the id sequence is saved; nothing is in flight between polls
+  void save(SnapshotWriter& writer) const;
+  void load(SnapshotReader& reader, const ExchangeCallback& cb);
+
+  // Time from sendOrder() to the reply
+  [[nodiscard]] LatencyStats getRoundTripStats() const;
+
+ private:
+  struct Received {
+    OrderIdentifier id;
+    Status status;
+    std::string_view error;
+    ExchangeCallback cb;
+  };
+
+  // Takes the replies waiting in the session queue; false if none
+  bool collect();
+  // Collects at least one reply; once the venue stops, rejects the orders
+  // still in flight instead
+  void awaitReply();
+
+  SharedVenue* venue_;
+  uint32_t session_;
+  SpscQueue<SharedVenueReply>* replies_;
+  // Replies come back in send order: the callback of id is at
+  // (id - first_id_) & mask_
+  std::vector<ExchangeCallback> callbacks_;
+  uint64_t mask_;
+  OrderIdentifier first_id_;
+  OrderIdentifier nextId_;
+  OrderIdentifier nextReply_;
+  std::vector<Received> received_;  // until poll() delivers them
+  LatencyHistogram round_trips_;
+};
+
+#endif  // TRADINGSIMULATOR_SHAREDVENUE_H
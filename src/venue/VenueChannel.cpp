@@ -0,0 +1,179 @@
+#include "VenueChannel.h"
+
+#ifdef __linux__
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <format>
+
+std::expected<std::unique_ptr<VenueChannel>, std::string> VenueChannel::Create(
+    std::string_view name, uint64_t capacity) {
+  auto shm_name = VenueShmName(name);
+  if (capacity < 2 || !std::has_single_bit(capacity)) {
+    return std::unexpected(std::format(
+        "VenueChannel: capacity of {} must be a power of two", shm_name));
+  }
+
+  // An existing segment belongs to a running venue, whose clients would be
+  // cut off by removing it, or to one that did not shut down cleanly; only
+  // the user can tell which
+  const int fd = ::shm_open(shm_name.c_str(),
+                            O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+  if (fd < 0 && errno == EEXIST) {
+    return std::unexpected(std::format(
+        "VenueChannel: {} already exists: another venue is running, or "
+        "remove /dev/shm{} left by one that crashed",
+        shm_name, shm_name));
+  }
+  if (fd < 0) {
+    return std::unexpected(std::format("VenueChannel: cannot create {}: {}",
+                                       shm_name, std::strerror(errno)));
+  }
+  const size_t size = VenueSize(capacity);
+  void* map = ::ftruncate(fd, static_cast<off_t>(size)) == 0
+                  ? ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                           fd, 0)
+                  : MAP_FAILED;
+  const int error = errno;
+  ::close(fd);
+  if (map == MAP_FAILED) {
+    ::shm_unlink(shm_name.c_str());
+    return std::unexpected(std::format("VenueChannel: cannot map {}: {}",
+                                       shm_name, std::strerror(error)));
+  }
+
+  // The segment starts zeroed: both rings are empty
+  auto* header = static_cast<VenueHeader*>(map);
+  header->version = kVenueVersion;
+  header->message_size = sizeof(VenueMessage);
+  header->capacity = capacity;
+  std::atomic_ref(header->magic).store(kVenueMagic, std::memory_order_release);
+  return std::unique_ptr<VenueChannel>(
+      new VenueChannel(std::move(shm_name), map, size, true));
+}
+
+std::expected<std::unique_ptr<VenueChannel>, std::string> VenueChannel::Attach(
+    std::string_view name) {
+  auto shm_name = VenueShmName(name);
+  const int fd = ::shm_open(shm_name.c_str(), O_RDWR | O_CLOEXEC, 0);
+  if (fd < 0) {
+    return std::unexpected(
+        std::format("VenueChannel: cannot open {} (is the exchange running?): "
+                    "{}",
+                    shm_name, std::strerror(errno)));
+  }
+  struct stat st {};
+  const bool sized = ::fstat(fd, &st) == 0 &&
+                     static_cast<size_t>(st.st_size) >= sizeof(VenueHeader);
+  void* map = sized ? ::mmap(nullptr, static_cast<size_t>(st.st_size),
+                             PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+                    : MAP_FAILED;
+  ::close(fd);
+  if (map == MAP_FAILED) {
+    return std::unexpected(
+        std::format("VenueChannel: cannot map {}", shm_name));
+  }
+
+  const auto size = static_cast<size_t>(st.st_size);
+  auto* header = static_cast<VenueHeader*>(map);
+  if (std::atomic_ref(header->magic).load(std::memory_order_acquire) !=
+          kVenueMagic ||
+      header->version != kVenueVersion ||
+      header->message_size != sizeof(VenueMessage) ||
+      VenueSize(header->capacity) > size) {
+    ::munmap(map, size);
+    return std::unexpected(
+        std::format("VenueChannel: {} is not an exchange channel", shm_name));
+  }
+  return std::unique_ptr<VenueChannel>(
+      new VenueChannel(std::move(shm_name), map, size, false));
+}
+
+VenueChannel::VenueChannel(std::string name, void* map, size_t size,
+                           bool server)
+    : name_(std::move(name)),
+      map_(map),
+      size_(size),
+      server_(server),
+      header_(static_cast<VenueHeader*>(map)),
+      mask_(header_->capacity - 1) {
+  auto* base = static_cast<char*>(map);
+  auto* requests =
+      reinterpret_cast<VenueRingIndices*>(base + sizeof(VenueHeader));
+  auto* replies = requests + 1;
+  auto* request_slots = reinterpret_cast<VenueMessage*>(replies + 1);
+  auto* reply_slots = request_slots + header_->capacity;
+
+  Ring request_ring{.indices = requests, .slots = request_slots, .cached = 0};
+  Ring reply_ring{.indices = replies, .slots = reply_slots, .cached = 0};
+  out_ = server ? reply_ring : request_ring;
+  in_ = server ? request_ring : reply_ring;
+}
+
+VenueChannel::~VenueChannel() {
+  std::atomic_ref(server_ ? header_->server_closed : header_->client_closed)
+      .store(1, std::memory_order_release);
+  ::munmap(map_, size_);
+  if (server_) {
+    ::shm_unlink(name_.c_str());
+  }
+}
+
+bool VenueChannel::send(const VenueMessage& message) {
+  std::atomic_ref write(out_.indices->write);
+  const uint64_t position = write.load(std::memory_order_relaxed);
+  if (position - out_.cached > mask_) {
+    out_.cached = std::atomic_ref(out_.indices->read)
+                      .load(std::memory_order_acquire);
+    if (position - out_.cached > mask_) return false;
+  }
+  out_.slots[position & mask_] = message;
+  write.store(position + 1, std::memory_order_release);
+  return true;
+}
+
+std::optional<VenueMessage> VenueChannel::receive() {
+  std::atomic_ref read(in_.indices->read);
+  const uint64_t position = read.load(std::memory_order_relaxed);
+  if (position == in_.cached) {
+    in_.cached = std::atomic_ref(in_.indices->write)
+                     .load(std::memory_order_acquire);
+    if (position == in_.cached) return std::nullopt;
+  }
+  const VenueMessage message = in_.slots[position & mask_];
+  read.store(position + 1, std::memory_order_release);
+  return message;
+}
+
+bool VenueChannel::peerClosed() const {
+  return std::atomic_ref(server_ ? header_->client_closed
+                                 : header_->server_closed)
+             .load(std::memory_order_acquire) != 0;
+}
+
+#else
+
+std::expected<std::unique_ptr<VenueChannel>, std::string> VenueChannel::Create(
+    std::string_view, uint64_t) {
+  return std::unexpected("VenueChannel: only available on Linux");
+}
+
+std::expected<std::unique_ptr<VenueChannel>, std::string> VenueChannel::Attach(
+    std::string_view) {
+  return std::unexpected("VenueChannel: only available on Linux");
+}
+
+VenueChannel::~VenueChannel() = default;
+
+bool VenueChannel::send(const VenueMessage&) { return false; }
+std::optional<VenueMessage> VenueChannel::receive() { return std::nullopt; }
+bool VenueChannel::peerClosed() const { return true; }
+
+#endif
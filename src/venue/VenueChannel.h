@@ -0,0 +1,55 @@
+#ifndef TRADINGSIMULATOR_VENUECHANNEL_H
+#define TRADINGSIMULATOR_VENUECHANNEL_H
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "VenueProtocol.h"
+
+// One end of the shared-memory link between an exchange process and its
+// client. The venue creates the segment (Create), which fails if it
+// already exists, and removes it on destruction; the client attaches to it
+// (Attach). Each end sends on one
+// ring and receives on the other, so neither ever takes a lock. Linux-only.
+class VenueChannel {
+ public:
+  static std::expected<std::unique_ptr<VenueChannel>, std::string> Create(
+      std::string_view name, uint64_t capacity);
+  static std::expected<std::unique_ptr<VenueChannel>, std::string> Attach(
+      std::string_view name);
+  ~VenueChannel();  // marks this end closed
+
+  VenueChannel(const VenueChannel&) = delete;
+  VenueChannel& operator=(const VenueChannel&) = delete;
+
+  // False if the outgoing ring is full
+  bool send(const VenueMessage& message);
+  std::optional<VenueMessage> receive();
+
+  // The other end has detached or shut down
+  [[nodiscard]] bool peerClosed() const;
+
+ private:
+  struct Ring {
+    VenueRingIndices* indices;
+    VenueMessage* slots;
+    uint64_t cached;  // last seen index of the other end
+  };
+
+  VenueChannel(std::string name, void* map, size_t size, bool server);
+
+  std::string name_;
+  void* map_;
+  size_t size_;
+  bool server_;
+  VenueHeader* header_;
+  uint64_t mask_ = 0;
+  Ring out_{};
+  Ring in_{};
+};
+
+#endif  // TRADINGSIMULATOR_VENUECHANNEL_H
@@ -0,0 +1,79 @@
+#ifndef TRADINGSIMULATOR_VENUEPROTOCOL_H
+#define TRADINGSIMULATOR_VENUEPROTOCOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Binary order protocol between RemoteExchange and ExchangeServer, and the
+// layout of the shared-memory segment carrying it: a header followed by two
+// single-producer single-consumer rings of fixed-size messages, requests
+// (client -> venue) and replies (venue -> client).
+//
+// Every message has the same 40-byte layout. The client assigns order ids
+// and stamps `sent`; replies echo both, so the client needs no lookup to
+// measure the round trip. Numbers are in host byte order: both ends run on
+// the same machine.
+
+enum class VenueMessageType : uint8_t {
+  New = 1,  // client: new order
+  Cancel,   // client: cancel order `id`
+  Ack,      // venue: order accepted
+  Fill,     // venue: order executed in full
+  Reject,   // venue: order (or cancel) rejected, see `reason`
+};
+
+enum class VenueRejectReason : uint8_t {
+  None,
+  Random,        // rejection_probability
+  UnknownOrder,  // cancel of an order that is no longer live
+};
+
+struct VenueMessage {
+  VenueMessageType type;
+  uint8_t side;  // 0 - buy, 1 - sell
+  VenueRejectReason reason;
+  uint8_t reserved[5];
+  uint64_t id;
+  double price;
+  double volume;
+  int64_t sent;  // client steady_clock time in nanoseconds
+};
+
+static_assert(sizeof(VenueMessage) == 40);
+static_assert(std::is_trivially_copyable_v<VenueMessage>);
+
+inline constexpr uint64_t kVenueMagic = 0x4555'4e45'564d'4953;  // SIMVENUE
+inline constexpr uint32_t kVenueVersion = 1;
+
+struct alignas(64) VenueHeader {
+  uint64_t magic;  // stored last, once the rest is initialized
+  uint32_t version;
+  uint32_t message_size;
+  uint64_t capacity;  // messages per ring, power of two
+
+  alignas(64) uint32_t client_closed;  // the client has detached
+  uint32_t server_closed;              // the venue has shut down
+};
+
+// Positions of one ring, each on its own cache line: the producer only
+// writes `write`, the consumer only writes `read`.
+struct VenueRingIndices {
+  alignas(64) uint64_t write;
+  alignas(64) uint64_t read;
+};
+
+// Header, request and reply indices, request slots, reply slots
+inline size_t VenueSize(uint64_t capacity) {
+  return sizeof(VenueHeader) + 2 * sizeof(VenueRingIndices) +
+         2 * capacity * sizeof(VenueMessage);
+}
+
+// shm_open() name: a leading slash is added if missing
+inline std::string VenueShmName(std::string_view name) {
+  return name.starts_with('/') ? std::string(name) : "/" + std::string(name);
+}
+
+#endif  // TRADINGSIMULATOR_VENUEPROTOCOL_H
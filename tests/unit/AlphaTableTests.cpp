@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+
+#include "trading/AlphaTable.h"
+#include "trading/TimeEMA.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+double ExactAlpha(std::chrono::nanoseconds period,
+                  std::chrono::nanoseconds dt) {
+  const double dt_sec = std::chrono::duration<double>(dt).count();
+  return 1.0 - std::exp(dt_sec *
+                        (-1.0 / std::chrono::duration<double>(period).count()));
+}
+
+double MaxError(const AlphaTable& table, std::chrono::nanoseconds period,
+                std::chrono::nanoseconds min_dt,
+                std::chrono::nanoseconds max_dt) {
+  double max_error = 0;
+  for (auto dt = min_dt; dt <= max_dt; dt += 997ns) {
+    max_error = std::max(max_error,
+                         std::abs(*table.lookup(dt) - ExactAlpha(period, dt)));
+  }
+  return max_error;
+}
+
+}  // namespace
+
+// ============================================================================
+// Lookup Tests
+// ============================================================================
+
+TEST(AlphaTableTest, Lookup_OutsideRange_ReturnsNullopt) {
+  AlphaTable table(1s, 50ms, 200ms, 1us, AlphaTableMode::Linear);
+
+  EXPECT_FALSE(table.lookup(49ms).has_value());
+  EXPECT_FALSE(table.lookup(201ms).has_value());
+  EXPECT_TRUE(table.lookup(50ms).has_value());
+  EXPECT_TRUE(table.lookup(200ms).has_value());
+}
+
+TEST(AlphaTableTest, Size_CoversRangePlusInterpolationEntry) {
+  AlphaTable table(1s, 50ms, 200ms, 1ms, AlphaTableMode::Nearest);
+
+  EXPECT_EQ(table.size(), 152);
+}
+
+TEST(AlphaTableTest, Nearest_NanosecondStep_IsExact) {
+  AlphaTable table(1s, 100ms, 100ms + 1000ns, 1ns, AlphaTableMode::Nearest);
+
+  for (auto dt = 100ms + 0ns; dt <= 100ms + 1000ns; dt += 7ns) {
+    EXPECT_EQ(*table.lookup(dt), ExactAlpha(1s, dt));
+  }
+}
+
+TEST(AlphaTableTest, Nearest_ErrorWithinBound) {
+  AlphaTable table(1s, 50ms, 200ms, 10us, AlphaTableMode::Nearest);
+  double bound =
+      AlphaTable::ErrorBound(1s, 50ms, 10us, AlphaTableMode::Nearest);
+
+  EXPECT_LE(MaxError(table, 1s, 50ms, 200ms), bound * (1 + 1e-6));
+  EXPECT_GT(bound, 0);
+}
+
+TEST(AlphaTableTest, Linear_ErrorWithinBound) {
+  AlphaTable table(1s, 50ms, 200ms, 100us, AlphaTableMode::Linear);
+  double bound =
+      AlphaTable::ErrorBound(1s, 50ms, 100us, AlphaTableMode::Linear);
+
+  EXPECT_LE(MaxError(table, 1s, 50ms, 200ms), bound + 1e-15);
+  EXPECT_LT(bound, 1e-8);
+}
+
+// ============================================================================
+// TimeEMA Integration
+// ============================================================================
+
+TEST(AlphaTableTest, TimeEMA_WithTable_TracksExactEMA) {
+  TimeEMA exact(1s);
+  TimeEMA tabled(1s, AlphaTable(1s, 50ms, 200ms, 1us, AlphaTableMode::Linear));
+
+  Tick tick{0ns, 100.0, 1.0};
+  for (int i = 0; i < 1000; ++i) {
+    tick.timestamp += 50ms + std::chrono::nanoseconds(i * 150'001);
+    tick.price += (i % 3 == 0) ? 1.0 : -0.5;
+    EXPECT_NEAR(tabled.update(tick), exact.update(tick), 1e-9);
+  }
+}
+
+TEST(AlphaTableTest, TimeEMA_OutOfRangeInterval_FallsBackToExp) {
+  TimeEMA exact(1s);
+  TimeEMA tabled(1s,
+                 AlphaTable(1s, 50ms, 200ms, 10ms, AlphaTableMode::Nearest));
+
+  exact.update({0ns, 100.0, 1.0});
+  tabled.update({0ns, 100.0, 1.0});
+
+  EXPECT_DOUBLE_EQ(tabled.update({2s, 200.0, 1.0}),
+                   exact.update({2s, 200.0, 1.0}));
+}
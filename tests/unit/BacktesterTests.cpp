@@ -0,0 +1,184 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+#include "backtest/Backtester.h"
+#include "backtest/TickFile.h"
+#include "config/Config.h"
+#include "logs/NullLogger.h"
+#include "simulation/Simulator.h"
+#include "trading/EmaTradingBot.h"
+
+using namespace std::chrono_literals;
+using ::testing::HasSubstr;
+
+namespace fs = std::filesystem;
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class BacktesterTest : public ::testing::Test {
+ protected:
+  fs::path temp_dir;
+
+  void SetUp() override {
+    auto timestamp =
+        std::chrono::system_clock::now().time_since_epoch().count();
+    temp_dir = fs::temp_directory_path() /
+               std::format("backtester_test_{}", timestamp);
+    fs::create_directories(temp_dir);
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(temp_dir, ec);
+  }
+
+  Config CreateTestConfig() {
+    Config cfg;
+    cfg.price_evolution_path = temp_dir / "ticks.csv";
+    cfg.orders_log_path = temp_dir / "orders.csv";
+    cfg.rejection_probability = 0.0;
+    cfg.price_variation = 0.5;
+    cfg.time_horizon = 24h;
+    cfg.min_diff_time = 100ms;
+    cfg.max_diff_time = 200ms;
+    cfg.fast_ema = 200ms;
+    cfg.slow_ema = 1s;
+    cfg.seed = 5;
+    cfg.steps_count = 20000;
+    return cfg;
+  }
+
+  // Records a price log with the simulator, as a user would
+  fs::path RecordTicks(const Config& cfg) {
+    Simulator<> simulator(cfg);
+    simulator.Run();
+    return cfg.price_evolution_path;
+  }
+
+  void WriteFile(const fs::path& path, const std::string& content) {
+    std::ofstream(path) << content;
+  }
+};
+
+// ============================================================================
+// ReadTickFile
+// ============================================================================
+
+TEST_F(BacktesterTest, ReadTickFile_ParsesTickLoggerFormat) {
+  WriteFile(temp_dir / "t.csv",
+            "Time,Price,Volume\n"
+            "00:00:00.150,100.500,10.000\n"
+            "01:02:03.004,101.000,20.500\n");
+
+  auto ticks = ReadTickFile(temp_dir / "t.csv", 2);
+
+  ASSERT_TRUE(ticks.has_value()) << ticks.error();
+  ASSERT_EQ(ticks->size(), 2);
+  EXPECT_EQ((*ticks)[0].timestamp, 150ms);
+  EXPECT_DOUBLE_EQ((*ticks)[0].price, 100.5);
+  EXPECT_EQ((*ticks)[1].timestamp, 1h + 2min + 3s + 4ms);
+  EXPECT_DOUBLE_EQ((*ticks)[1].volume, 20.5);
+}
+
+TEST_F(BacktesterTest, ReadTickFile_SameResultForAnyThreadCount) {
+  Config cfg = CreateTestConfig();
+  auto path = RecordTicks(cfg);
+
+  auto single = ReadTickFile(path, 1);
+  ASSERT_TRUE(single.has_value()) << single.error();
+  ASSERT_EQ(single->size(), cfg.steps_count);
+  for (size_t threads : {2, 7, 64}) {
+    auto multi = ReadTickFile(path, threads);
+    ASSERT_TRUE(multi.has_value()) << multi.error();
+    ASSERT_EQ(multi->size(), single->size());
+    for (size_t i = 0; i < single->size(); ++i) {
+      ASSERT_EQ((*multi)[i].timestamp, (*single)[i].timestamp);
+      ASSERT_EQ((*multi)[i].price, (*single)[i].price);
+    }
+  }
+}
+
+TEST_F(BacktesterTest, ReadTickFile_HourWrap_KeepsTimeIncreasing) {
+  WriteFile(temp_dir / "t.csv",
+            "Time,Price,Volume\n"
+            "23:59:59.900,100.000,1.000\n"
+            "00:00:00.100,100.000,1.000\n");
+
+  auto ticks = ReadTickFile(temp_dir / "t.csv", 1);
+
+  ASSERT_TRUE(ticks.has_value()) << ticks.error();
+  EXPECT_EQ((*ticks)[1].timestamp - (*ticks)[0].timestamp, 200ms);
+}
+
+TEST_F(BacktesterTest, ReadTickFile_MalformedLine_ReturnsError) {
+  WriteFile(temp_dir / "t.csv", "Time,Price,Volume\nnot,a,tick\n");
+
+  auto ticks = ReadTickFile(temp_dir / "t.csv", 1);
+
+  ASSERT_FALSE(ticks.has_value());
+  EXPECT_THAT(ticks.error(), HasSubstr("malformed"));
+}
+
+TEST_F(BacktesterTest, ReadTickFile_MissingFile_ReturnsError) {
+  auto ticks = ReadTickFile(temp_dir / "missing.csv", 1);
+
+  ASSERT_FALSE(ticks.has_value());
+}
+
+// ============================================================================
+// Backtester
+// ============================================================================
+
+TEST_F(BacktesterTest, Run_MatchesSequentialBot) {
+  Config cfg = CreateTestConfig();
+  auto path = RecordTicks(cfg);
+  auto ticks = ReadTickFile(path, 1);
+  ASSERT_TRUE(ticks.has_value());
+
+  EmaTradingBot<NullOrderLogger> bot(cfg);
+  for (const auto& tick : *ticks) bot.onTick(tick);
+  auto expected = bot.getSummary();
+
+  Config backtest_cfg = cfg;
+  backtest_cfg.metrics_only = true;
+  auto actual = Backtester(backtest_cfg, 8).Run(path);
+
+  ASSERT_TRUE(actual.has_value()) << actual.error();
+  EXPECT_GT(expected.executed_orders, 0);
+  EXPECT_EQ(actual->ticks, expected.ticks);
+  EXPECT_EQ(actual->executed_orders, expected.executed_orders);
+  EXPECT_NEAR(actual->total_pnl, expected.total_pnl, 1e-6);
+}
+
+TEST_F(BacktesterTest, FindSignals_IndependentOfThreadCount) {
+  Config cfg = CreateTestConfig();
+  auto ticks = ReadTickFile(RecordTicks(cfg), 1);
+  ASSERT_TRUE(ticks.has_value());
+
+  auto expected = Backtester(cfg, 1).findSignals(*ticks);
+  for (size_t threads : {2, 5, 32}) {
+    auto actual = Backtester(cfg, threads).findSignals(*ticks);
+    ASSERT_EQ(actual.size(), expected.size()) << "threads " << threads;
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(actual[i].tick, expected[i].tick);
+      EXPECT_EQ(actual[i].side, expected[i].side);
+    }
+  }
+}
+
+TEST_F(BacktesterTest, Run_WritesOrderLog) {
+  Config cfg = CreateTestConfig();
+  auto path = RecordTicks(cfg);
+  cfg.orders_log_path = temp_dir / "backtest_orders.csv";
+
+  auto summary = Backtester(cfg, 4).Run(path);
+
+  ASSERT_TRUE(summary.has_value()) << summary.error();
+  EXPECT_TRUE(fs::exists(cfg.orders_log_path));
+}
@@ -0,0 +1,203 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "config/Config.h"
+#include "logs/BarAggregator.h"
+#include "logs/BarLogger.h"
+
+using namespace std::chrono_literals;
+using ::testing::ElementsAre;
+
+namespace fs = std::filesystem;
+
+// ============================================================================
+// BarAggregator
+// ============================================================================
+
+TEST(BarAggregatorTest, FirstTick_OpensBar) {
+  BarAggregator bars(1s);
+
+  EXPECT_FALSE(bars.current().has_value());
+  EXPECT_FALSE(bars.add({1500ms, 100.0, 10.0}).has_value());
+
+  auto bar = bars.current();
+  ASSERT_TRUE(bar.has_value());
+  EXPECT_EQ(bar->start, 1s);
+  EXPECT_DOUBLE_EQ(bar->open, 100.0);
+  EXPECT_DOUBLE_EQ(bar->close, 100.0);
+  EXPECT_DOUBLE_EQ(bar->volume, 10.0);
+  EXPECT_DOUBLE_EQ(bar->vwap, 100.0);
+}
+
+TEST(BarAggregatorTest, TicksInInterval_FoldIntoOHLCV) {
+  BarAggregator bars(1s);
+
+  bars.add({100ms, 100.0, 10.0});
+  bars.add({300ms, 103.0, 30.0});
+  bars.add({500ms, 98.0, 20.0});
+  bars.add({900ms, 101.0, 40.0});
+  auto bar = bars.add({1s, 99.0, 5.0});
+
+  ASSERT_TRUE(bar.has_value());
+  EXPECT_EQ(bar->start, 0s);
+  EXPECT_DOUBLE_EQ(bar->open, 100.0);
+  EXPECT_DOUBLE_EQ(bar->high, 103.0);
+  EXPECT_DOUBLE_EQ(bar->low, 98.0);
+  EXPECT_DOUBLE_EQ(bar->close, 101.0);
+  EXPECT_DOUBLE_EQ(bar->volume, 100.0);
+  EXPECT_DOUBLE_EQ(bar->vwap,
+                   (1000.0 + 3090.0 + 1960.0 + 4040.0) / 100.0);
+
+  auto next = bars.current();
+  ASSERT_TRUE(next.has_value());
+  EXPECT_EQ(next->start, 1s);
+  EXPECT_DOUBLE_EQ(next->open, 99.0);
+}
+
+TEST(BarAggregatorTest, Gap_SkipsEmptyIntervals) {
+  BarAggregator bars(1min);
+
+  bars.add({10s, 100.0, 1.0});
+  auto bar = bars.add({5min + 3s, 101.0, 1.0});
+
+  ASSERT_TRUE(bar.has_value());
+  EXPECT_EQ(bar->start, 0min);
+  EXPECT_EQ(bars.current()->start, 5min);
+}
+
+TEST(BarAggregatorTest, ZeroVolume_VwapIsClose) {
+  BarAggregator bars(1s);
+
+  bars.add({0ms, 100.0, 0.0});
+  bars.add({10ms, 102.0, 0.0});
+
+  EXPECT_DOUBLE_EQ(bars.current()->vwap, 102.0);
+}
+
+TEST(BarAggregatorTest, SaveLoad_ContinuesOpenBar) {
+  BarAggregator original(1s);
+  original.add({100ms, 100.0, 10.0});
+  original.add({200ms, 105.0, 10.0});
+
+  SnapshotWriter writer;
+  original.save(writer);
+  SnapshotReader reader(std::move(writer).release());
+  BarAggregator restored(1s);
+  ASSERT_TRUE(restored.load(reader));
+
+  original.add({300ms, 95.0, 10.0});
+  restored.add({300ms, 95.0, 10.0});
+  auto expected = original.add({1s, 100.0, 1.0});
+  auto actual = restored.add({1s, 100.0, 1.0});
+
+  ASSERT_TRUE(actual.has_value());
+  EXPECT_DOUBLE_EQ(actual->high, expected->high);
+  EXPECT_DOUBLE_EQ(actual->low, expected->low);
+  EXPECT_DOUBLE_EQ(actual->vwap, expected->vwap);
+}
+
+// ============================================================================
+// BarLogger
+// ============================================================================
+
+class BarLoggerTest : public ::testing::Test {
+ protected:
+  fs::path temp_dir;
+
+  void SetUp() override {
+    auto timestamp =
+        std::chrono::system_clock::now().time_since_epoch().count();
+    temp_dir = fs::temp_directory_path() /
+               std::format("bar_logger_test_{}", timestamp);
+    fs::create_directories(temp_dir);
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(temp_dir, ec);
+  }
+
+  Config CreateTestConfig() {
+    Config cfg;
+    cfg.price_evolution_path = temp_dir / "prices.csv";
+    cfg.bar_resolutions = {1s, 1min};
+    return cfg;
+  }
+
+  static std::vector<std::string> ReadLines(const fs::path& path) {
+    std::vector<std::string> lines;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+      lines.push_back(line);
+    }
+    return lines;
+  }
+};
+
+TEST_F(BarLoggerTest, Path_InsertsResolutionBeforeExtension) {
+  EXPECT_EQ(BarLogger::Path("output/price_evolution.csv", 1min),
+            fs::path("output/price_evolution.1min.csv"));
+  EXPECT_EQ(BarLogger::Path("prices.csv", 1h), fs::path("prices.1h.csv"));
+  EXPECT_EQ(BarLogger::Path("prices.csv", 1500ms),
+            fs::path("prices.1500ms.csv"));
+}
+
+TEST_F(BarLoggerTest, WritesOneFilePerResolution) {
+  Config cfg = CreateTestConfig();
+  {
+    BarLogger logger(cfg);
+    for (int i = 0; i < 150; ++i) {
+      ASSERT_FALSE(
+          logger.writeTick({i * 500ms, 100.0 + i % 7, 10.0}).has_value());
+    }
+  }
+
+  EXPECT_FALSE(fs::exists(cfg.price_evolution_path));
+  const auto seconds = ReadLines(temp_dir / "prices.1s.csv");
+  const auto minutes = ReadLines(temp_dir / "prices.1min.csv");
+  ASSERT_EQ(seconds.size(), 1 + 75);
+  ASSERT_EQ(minutes.size(), 1 + 2);
+  EXPECT_EQ(seconds[0], "Time,Open,High,Low,Close,Volume,VWAP");
+  EXPECT_EQ(seconds[1],
+            "00:00:00.000,100.000,101.000,100.000,101.000,20.000,100.500");
+  EXPECT_EQ(minutes[2].substr(0, 12), "00:01:00.000");
+}
+
+TEST_F(BarLoggerTest, Resume_TruncatesAndContinuesOpenBar) {
+  Config cfg = CreateTestConfig();
+  cfg.bar_resolutions = {1s};
+
+  std::string snapshot;
+  {
+    BarLogger logger(cfg);
+    logger.writeTick({0ms, 100.0, 1.0});
+    logger.writeTick({1200ms, 110.0, 1.0});
+    SnapshotWriter writer;
+    logger.save(writer);
+    snapshot = std::move(writer).release();
+    logger.writeTick({1500ms, 999.0, 1.0});  // after the checkpoint
+    logger.writeTick({2500ms, 999.0, 1.0});
+  }
+
+  cfg.resume = true;
+  {
+    BarLogger logger(cfg);
+    SnapshotReader reader(std::move(snapshot));
+    ASSERT_FALSE(logger.load(reader).has_value());
+    logger.writeTick({1700ms, 90.0, 1.0});
+  }
+
+  EXPECT_THAT(
+      ReadLines(temp_dir / "prices.1s.csv"),
+      ElementsAre("Time,Open,High,Low,Close,Volume,VWAP",
+                  "00:00:00.000,100.000,100.000,100.000,100.000,1.000,100.000",
+                  "00:00:01.000,110.000,110.000,90.000,90.000,2.000,100.000"));
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+
+#include "trading/BollingerBands.h"
+
+using namespace std::chrono_literals;
+
+TEST(BollingerBandsTest, Update_FirstTick_CollapsedBands) {
+  BollingerBands bands(1s, 100ms);
+
+  Bands result = bands.update({0ms, 100.0, 1.0});
+
+  EXPECT_DOUBLE_EQ(result.lower, 100.0);
+  EXPECT_DOUBLE_EQ(result.middle, 100.0);
+  EXPECT_DOUBLE_EQ(result.upper, 100.0);
+}
+
+TEST(BollingerBandsTest, Update_MeanPlusMinusWidthStddev) {
+  BollingerBands bands(1s, 100ms, 2.0);
+
+  bands.update({0ms, 98.0, 1.0});
+  Bands result = bands.update({100ms, 102.0, 1.0});
+
+  // mean 100, population stddev 2
+  EXPECT_DOUBLE_EQ(result.middle, 100.0);
+  EXPECT_DOUBLE_EQ(result.lower, 96.0);
+  EXPECT_DOUBLE_EQ(result.upper, 104.0);
+}
+
+TEST(BollingerBandsTest, Update_DropsTicksOlderThanWindow) {
+  BollingerBands bands(1s, 100ms);
+
+  bands.update({0ms, 50.0, 1.0});
+  bands.update({500ms, 100.0, 1.0});
+  Bands result = bands.update({1000ms, 100.0, 1.0});
+
+  EXPECT_DOUBLE_EQ(result.middle, 100.0);
+  EXPECT_DOUBLE_EQ(result.upper, 100.0);
+}
+
+TEST(BollingerBandsTest, Update_HighPrice_SmallVarianceIsAccurate) {
+  BollingerBands bands(10s, 100ms, 1.0);
+
+  for (int i = 0; i < 50; ++i) {
+    bands.update({std::chrono::milliseconds(100 * i),
+                  1e9 + (i % 2 == 0 ? -0.5 : 0.5), 1.0});
+  }
+  Bands result = bands.getBands();
+
+  EXPECT_NEAR(result.upper - result.middle, 0.5, 1e-6);
+}
+
+TEST(BollingerBandsTest, Update_DriftingHighPrice_SmallVarianceIsAccurate) {
+  BollingerBands bands(1s, 100ms, 1.0);
+
+  // The price drifts far from where it started while the window's
+  // deviation stays 0.5
+  for (int i = 0; i < 100000; ++i) {
+    const double trend = 1e9 + 100.0 * (i / 10);
+    bands.update({std::chrono::milliseconds(100 * i),
+                  trend + (i % 2 == 0 ? -0.5 : 0.5), 1.0});
+  }
+  Bands result = bands.getBands();
+
+  EXPECT_NEAR(result.upper - result.middle, 0.5, 1e-3);
+}
+
+TEST(BollingerBandsTest, Update_NonPositiveWindow_HoldsNoTicks) {
+  for (auto window : {0s, -1s}) {
+    BollingerBands bands(window, 100ms);
+
+    bands.update({0ms, 100.0, 1.0});
+    Bands result = bands.update({100ms, 110.0, 1.0});
+
+    EXPECT_DOUBLE_EQ(result.middle, 0.0);
+    EXPECT_DOUBLE_EQ(result.upper, 0.0);
+  }
+}
+
+TEST(BollingerBandsTest, SaveLoad_ContinuesIdentically) {
+  BollingerBands original(1s, 100ms);
+  original.update({0ms, 100.0, 1.0});
+  original.update({300ms, 104.0, 1.0});
+
+  SnapshotWriter writer;
+  original.save(writer);
+  BollingerBands restored(1s, 100ms);
+  SnapshotReader reader(std::move(writer).release());
+  restored.load(reader);
+
+  Bands expected = original.update({900ms, 101.0, 1.0});
+  Bands actual = restored.update({900ms, 101.0, 1.0});
+  EXPECT_DOUBLE_EQ(actual.lower, expected.lower);
+  EXPECT_DOUBLE_EQ(actual.upper, expected.upper);
+}
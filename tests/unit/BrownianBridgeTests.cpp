@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+
+#include "simulation/BrownianBridge.h"
+
+using namespace std::chrono_literals;
+
+TEST(BrownianBridgeTest, PriceAt_Endpoints_ReturnKnownPrices) {
+  BrownianBridge bridge({0ns, 100.0, 0.0}, {1h, 120.0, 0.0}, 0.2, 24h, 1);
+
+  EXPECT_DOUBLE_EQ(bridge.priceAt(0ns), 100.0);
+  EXPECT_DOUBLE_EQ(bridge.priceAt(1h), 120.0);
+}
+
+TEST(BrownianBridgeTest, PriceAt_OutsideInterval_Clamps) {
+  BrownianBridge bridge({1h, 100.0, 0.0}, {2h, 120.0, 0.0}, 0.2, 24h, 1);
+
+  EXPECT_DOUBLE_EQ(bridge.priceAt(0ns), 100.0);
+  EXPECT_DOUBLE_EQ(bridge.priceAt(3h), 120.0);
+}
+
+TEST(BrownianBridgeTest, PriceAt_SameTimeTwice_IsConsistent) {
+  BrownianBridge bridge({0ns, 100.0, 0.0}, {1h, 120.0, 0.0}, 0.2, 24h, 1);
+
+  Price first = bridge.priceAt(20min);
+  bridge.priceAt(40min);
+
+  EXPECT_DOUBLE_EQ(bridge.priceAt(20min), first);
+}
+
+TEST(BrownianBridgeTest, PriceAt_ZeroVariation_GeometricInterpolation) {
+  BrownianBridge bridge({0ns, 100.0, 0.0}, {2h, 400.0, 0.0}, 0.0, 24h, 1);
+
+  EXPECT_NEAR(bridge.priceAt(1h), 200.0, 1e-9);
+}
+
+TEST(BrownianBridgeTest, PriceAt_Midpoint_HasBridgeVariance) {
+  // Var[log S(T/2)] = sigma^2 * T / 4 given both endpoints
+  const double sigma = 0.5;
+  const int samples = 20000;
+  double sum = 0;
+  double sum_sq = 0;
+  for (int i = 0; i < samples; ++i) {
+    BrownianBridge bridge({0ns, 100.0, 0.0}, {24h, 100.0, 0.0}, sigma, 24h,
+                          static_cast<uint64_t>(i) + 1);
+    double x = std::log(bridge.priceAt(12h) / 100.0);
+    sum += x;
+    sum_sq += x * x;
+  }
+  double mean = sum / samples;
+  double variance = sum_sq / samples - mean * mean;
+
+  EXPECT_NEAR(mean, 0.0, 0.01);
+  EXPECT_NEAR(variance, sigma * sigma / 4, 0.005);
+}
@@ -0,0 +1,268 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "backtest/TickFile.h"
+#include "config/Config.h"
+#include "logs/CompressedTickLogger.h"
+#include "logs/TickCodec.h"
+
+using namespace std::chrono_literals;
+using ::testing::HasSubstr;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Random walk at the logger's resolution, so it survives a round trip.
+std::vector<Tick> MakeTicks(size_t count) {
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<int64_t> delta_ms(50, 200);
+  std::normal_distribution<double> shock(0.0, 0.01);
+  std::uniform_real_distribution<double> volume(10.0, 1000.0);
+  auto quantize = [](double value) {
+    return std::round(value / CompressedTickLogger::kValueStep) *
+           CompressedTickLogger::kValueStep;
+  };
+
+  std::vector<Tick> ticks;
+  std::chrono::nanoseconds timestamp = 0ns;
+  Price price = 100.0;
+  for (size_t i = 0; i < count; ++i) {
+    timestamp += std::chrono::milliseconds(delta_ms(gen));
+    price += shock(gen);
+    ticks.push_back({timestamp, quantize(price), quantize(volume(gen))});
+  }
+  return ticks;
+}
+
+void ExpectIdentical(const std::vector<Tick>& a, const std::vector<Tick>& b) {
+  ASSERT_EQ(a.size(), b.size());
+  for (size_t i = 0; i < a.size(); ++i) {
+    ASSERT_EQ(a[i].timestamp, b[i].timestamp) << "tick " << i;
+    ASSERT_EQ(a[i].price, b[i].price) << "tick " << i;
+    ASSERT_EQ(a[i].volume, b[i].volume) << "tick " << i;
+  }
+}
+
+}  // namespace
+
+// ============================================================================
+// TickEncoder / TickDecoder
+// ============================================================================
+
+TEST(TickCodecTest, RoundTrip_ExactForFullPrecisionValues) {
+  const std::vector<Tick> ticks = {{1ns, 100.123456789, 0.1},
+                                   {7ns, 100.123456789, 0.2},
+                                   {7ns, -3.5, 1e300},
+                                   {20ns, 0.0, 1e-300},
+                                   {21ns, 100.0, 0.2}};
+  TickEncoder encoder(1ns);
+  for (const auto& tick : ticks) encoder.encode(tick);
+
+  TickDecoder decoder(encoder.bytes(), 1ns);
+  std::vector<Tick> decoded;
+  Tick tick{};
+  while (decoder.decode(tick)) decoded.push_back(tick);
+
+  ExpectIdentical(decoded, ticks);
+}
+
+TEST(TickCodecTest, RoundTrip_TruncatesToResolution) {
+  TickEncoder encoder(1ms);
+  encoder.encode({1500us, 1.0, 1.0});
+
+  TickDecoder decoder(encoder.bytes(), 1ms);
+  Tick tick{};
+  ASSERT_TRUE(decoder.decode(tick));
+  EXPECT_EQ(tick.timestamp, 1ms);
+}
+
+TEST(TickCodecTest, Encode_SteadyTicksTakeFewBits) {
+  TickEncoder encoder(1ms);
+  for (int i = 0; i < 1000; ++i) {
+    encoder.encode({std::chrono::milliseconds(100 * i), 100.0, 50.0});
+  }
+
+  // First ticks in full, then a one-byte varint and two flag bits per tick
+  EXPECT_LT(encoder.bytes().size(), 32 + 1000 * 10 / 8);
+}
+
+TEST(TickCodecTest, Encode_RandomWalkIsSmallerThanCsv) {
+  const auto ticks = MakeTicks(10000);
+  TickEncoder encoder(1ms);
+  for (const auto& tick : ticks) encoder.encode(tick);
+
+  // A CSV line ("00:00:01.234,100.123,523.456\n") takes 29 bytes
+  EXPECT_LT(encoder.bytes().size(), ticks.size() * 29 / 3);
+}
+
+TEST(TickCodecTest, Decode_TruncatedStreamStops) {
+  TickEncoder encoder(1ms);
+  for (const auto& tick : MakeTicks(10)) encoder.encode(tick);
+  const auto bytes = encoder.bytes();
+
+  TickDecoder decoder(std::string_view(bytes).substr(0, bytes.size() / 2),
+                      1ms);
+  size_t decoded = 0;
+  Tick tick{};
+  while (decoder.decode(tick)) ++decoded;
+  EXPECT_LT(decoded, 10);
+}
+
+TEST(TickCodecTest, SaveLoad_ContinuesStream) {
+  const auto ticks = MakeTicks(100);
+  TickEncoder first(1ms);
+  for (size_t i = 0; i < 60; ++i) first.encode(ticks[i]);
+  SnapshotWriter writer;
+  first.save(writer);
+
+  TickEncoder second(1ms);
+  SnapshotReader reader(std::move(writer).release());
+  ASSERT_TRUE(second.load(reader));
+  for (size_t i = 60; i < ticks.size(); ++i) second.encode(ticks[i]);
+
+  TickDecoder decoder(second.bytes(), 1ms);
+  std::vector<Tick> decoded;
+  Tick tick{};
+  while (decoder.decode(tick)) decoded.push_back(tick);
+  ExpectIdentical(decoded, ticks);
+}
+
+// ============================================================================
+// CompressedTickLogger
+// ============================================================================
+
+class CompressedTickLoggerTest : public ::testing::Test {
+ protected:
+  fs::path temp_dir;
+  fs::path test_file_path;
+
+  void SetUp() override {
+    auto timestamp =
+        std::chrono::system_clock::now().time_since_epoch().count();
+    temp_dir = fs::temp_directory_path() /
+               std::format("compressed_tick_logger_test_{}", timestamp);
+    fs::create_directories(temp_dir);
+    test_file_path = temp_dir / "ticks.bin";
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(temp_dir, ec);
+  }
+
+  Config CreateTestConfig() {
+    Config cfg;
+    cfg.price_evolution_path = test_file_path;
+    return cfg;
+  }
+};
+
+TEST_F(CompressedTickLoggerTest, Constructor_InvalidPath_Throws) {
+  Config cfg;
+  cfg.price_evolution_path = "/nonexistent/path/that/does/not/exist/file.bin";
+
+  EXPECT_THROW(CompressedTickLogger logger(cfg), std::runtime_error);
+}
+
+TEST_F(CompressedTickLoggerTest, WriteTick_ReadBackAcrossBlocks) {
+  const auto ticks = MakeTicks(2 * CompressedTickLogger::kBlockTicks + 17);
+  {
+    CompressedTickLogger logger(CreateTestConfig());
+    for (const auto& tick : ticks) {
+      ASSERT_FALSE(logger.writeTick(tick).has_value());
+    }
+  }  // The open block is written on destruction
+
+  for (size_t threads : {1, 3}) {
+    auto decoded = ReadTickFile(test_file_path, threads);
+    ASSERT_TRUE(decoded.has_value()) << decoded.error();
+    ExpectIdentical(decoded.value(), ticks);
+  }
+}
+
+TEST_F(CompressedTickLoggerTest, WriteTick_RoundsToLogResolution) {
+  {
+    CompressedTickLogger logger(CreateTestConfig());
+    logger.writeTick({1500us, 100.00001, 50.25});
+  }
+
+  auto decoded = ReadTickFile(test_file_path);
+  ASSERT_TRUE(decoded.has_value()) << decoded.error();
+  ASSERT_EQ(decoded->size(), 1);
+  EXPECT_EQ(decoded->front().timestamp, 1ms);
+  EXPECT_EQ(decoded->front().price, 100.0);
+  EXPECT_EQ(decoded->front().volume, 50.25);
+}
+
+TEST_F(CompressedTickLoggerTest, SaveLoad_ResumeDoesNotDuplicateTicks) {
+  const auto ticks = MakeTicks(CompressedTickLogger::kBlockTicks + 500);
+  const size_t checkpoint = CompressedTickLogger::kBlockTicks + 100;
+
+  std::string snapshot;
+  {
+    CompressedTickLogger logger(CreateTestConfig());
+    for (size_t i = 0; i < checkpoint; ++i) logger.writeTick(ticks[i]);
+    SnapshotWriter writer;
+    logger.save(writer);
+    snapshot = std::move(writer).release();
+    // Written after the checkpoint and lost on resume
+    for (size_t i = 0; i < 50; ++i) logger.writeTick(ticks[checkpoint]);
+  }
+
+  Config cfg = CreateTestConfig();
+  cfg.resume = true;
+  {
+    CompressedTickLogger logger(cfg);
+    SnapshotReader reader(std::move(snapshot));
+    ASSERT_FALSE(logger.load(reader).has_value());
+    for (size_t i = checkpoint; i < ticks.size(); ++i) {
+      logger.writeTick(ticks[i]);
+    }
+  }
+
+  auto decoded = ReadTickFile(test_file_path);
+  ASSERT_TRUE(decoded.has_value()) << decoded.error();
+  ExpectIdentical(decoded.value(), ticks);
+}
+
+TEST_F(CompressedTickLoggerTest, Decode_TruncatedFile_ReturnsError) {
+  {
+    CompressedTickLogger logger(CreateTestConfig());
+    for (const auto& tick : MakeTicks(100)) logger.writeTick(tick);
+  }
+  fs::resize_file(test_file_path, fs::file_size(test_file_path) - 10);
+
+  auto decoded = ReadTickFile(test_file_path);
+
+  ASSERT_FALSE(decoded.has_value());
+  EXPECT_THAT(decoded.error(), HasSubstr("truncated"));
+}
+
+TEST_F(CompressedTickLoggerTest, Decode_OversizedBlockCount_ReturnsError) {
+  {
+    CompressedTickLogger logger(CreateTestConfig());
+    for (const auto& tick : MakeTicks(100)) logger.writeTick(tick);
+  }
+  // The first block's tick count follows the magic, version and resolution
+  {
+    std::fstream file(test_file_path,
+                      std::ios::binary | std::ios::in | std::ios::out);
+    const uint32_t count = 0xFFFF'FFFF;
+    file.seekp(8 + 4 + 8);
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+  }
+
+  auto decoded = ReadTickFile(test_file_path);
+
+  ASSERT_FALSE(decoded.has_value());
+  EXPECT_THAT(decoded.error(), HasSubstr("corrupted block 0"));
+}
@@ -1094,6 +1094,256 @@ TEST_F(ConfigManagerTest, ValidateStepsCountLarge) {
   EXPECT_EQ(result->steps_count, 999999999999ULL);
 }
 
+// Simulation Section - Seed and Checkpoints
+
+TEST_F(ConfigManagerTest, ParseSeedAndCheckpointSettings) {
+  WriteConfigFile(GetValidConfigContent() + R"(seed = 42
+checkpoint_path = state/run.bin
+checkpoint_interval = 5000
+)");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->seed, 42);
+  EXPECT_EQ(result->checkpoint_path, "state/run.bin");
+  EXPECT_EQ(result->checkpoint_interval, 5000);
+  EXPECT_FALSE(result->resume);
+}
+
+TEST_F(ConfigManagerTest, CheckpointingDisabledByDefault) {
+  WriteConfigFile(GetValidConfigContent());
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result->seed, 0);
+  EXPECT_EQ(result->checkpoint_interval, 0);
+}
+
+TEST_F(ConfigManagerTest, ParseBranchSections_InheritBaseValues) {
+  WriteConfigFile(GetValidConfigContent() + R"(branch_step = 500
+
+[Branch.high_vol]
+price_variation = 0.5
+
+[Branch.outage]
+rejection_probability = 90
+)");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->branch_step, 500);
+  ASSERT_EQ(result->branches.size(), 2);
+  EXPECT_EQ(result->branches[0].name, "high_vol");
+  EXPECT_DOUBLE_EQ(result->branches[0].price_variation, 0.5);
+  EXPECT_DOUBLE_EQ(result->branches[0].rejection_probability, 1.0);
+  EXPECT_EQ(result->branches[1].name, "outage");
+  EXPECT_DOUBLE_EQ(result->branches[1].price_variation, 0.10);
+  EXPECT_DOUBLE_EQ(result->branches[1].rejection_probability, 90.0);
+}
+
+TEST_F(ConfigManagerTest, ValidateBranchStepBeyondSteps) {
+  WriteConfigFile(GetValidConfigContent() + R"(branch_step = 100000
+
+[Branch.late]
+price_variation = 0.5
+)");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("branch_step must be < steps_count"));
+}
+
+TEST_F(ConfigManagerTest, ValidateBranchVolatility) {
+  WriteConfigFile(GetValidConfigContent() + R"(
+[Branch.flat]
+price_variation = 0
+)");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("[Branch.flat] price_variation"));
+}
+
+TEST_F(ConfigManagerTest, ParseMetricsOnly) {
+  WriteConfigFile(GetValidConfigContent() + "metrics_only = true\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_TRUE(result->metrics_only);
+}
+
+TEST_F(ConfigManagerTest, ParseInvalidMetricsOnly) {
+  WriteConfigFile(GetValidConfigContent() + "metrics_only = sometimes\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("metrics_only"));
+}
+
+TEST_F(ConfigManagerTest, ParseInvalidCheckpointInterval) {
+  WriteConfigFile(GetValidConfigContent() + "checkpoint_interval = often\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("checkpoint_interval"));
+}
+
+TEST_F(ConfigManagerTest, ParseWarmup) {
+  WriteConfigFile(GetValidConfigContent() + "warmup = 2h\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->warmup, 2h);
+}
+
+TEST_F(ConfigManagerTest, ParsePathThreads) {
+  WriteConfigFile(GetValidConfigContent() + "path_threads = 8\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->path_threads, 8);
+}
+
+TEST_F(ConfigManagerTest, ParseTickLogFormat) {
+  WriteConfigFile(GetValidConfigContent() + "tick_log_format = compressed\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->tick_log_format, TickLogFormat::Compressed);
+}
+
+TEST_F(ConfigManagerTest, ParseInvalidTickLogFormat) {
+  WriteConfigFile(GetValidConfigContent() + "tick_log_format = zip\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("tick_log_format"));
+}
+
+TEST_F(ConfigManagerTest, ParseLogBackends) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "tick_log_backend = io_uring\norder_log_backend = mmap\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->tick_log_backend, FileSinkBackend::IoUring);
+  EXPECT_EQ(result->order_log_backend, FileSinkBackend::Mmap);
+}
+
+TEST_F(ConfigManagerTest, ParseInvalidLogBackend) {
+  WriteConfigFile(GetValidConfigContent() + "order_log_backend = aio\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("order_log_backend"));
+}
+
+TEST_F(ConfigManagerTest, ParseOrderLogDurability) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "order_log_durability = group\ngroup_commit_orders = 16\n"
+                  "group_commit_interval = 5ms\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->order_log_durability, LogDurability::Group);
+  EXPECT_EQ(result->group_commit_orders, 16);
+  EXPECT_EQ(result->group_commit_interval, 5ms);
+}
+
+TEST_F(ConfigManagerTest, ParseInvalidOrderLogDurability) {
+  WriteConfigFile(GetValidConfigContent() + "order_log_durability = osync\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("order_log_durability"));
+}
+
+TEST_F(ConfigManagerTest, GroupCommitOrdersZero_ReturnsError) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "order_log_durability = group\ngroup_commit_orders = 0\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("group_commit_orders"));
+}
+
+TEST_F(ConfigManagerTest, ParseTimerInterval) {
+  std::string content = GetValidConfigContent();
+  content.replace(content.find("slow_ema = 5s\n"), 14,
+                  "slow_ema = 5s\ntimer_interval = 250ms\n");
+  WriteConfigFile(content);
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->timer_interval, 250ms);
+}
+
+TEST_F(ConfigManagerTest, TimerIntervalDefaultsToOff) {
+  WriteConfigFile(GetValidConfigContent());
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->timer_interval, 0ns);
+}
+
+TEST_F(ConfigManagerTest, ParseAlphaTable) {
+  std::string content = GetValidConfigContent();
+  content.replace(content.find("slow_ema = 5s\n"), 14,
+                  "slow_ema = 5s\nalpha_table = linear\n"
+                  "alpha_table_step = 10us\n");
+  WriteConfigFile(content);
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->alpha_table, AlphaTableMode::Linear);
+  EXPECT_EQ(result->alpha_table_step, 10us);
+}
+
+TEST_F(ConfigManagerTest, ParseInvalidAlphaTableMode) {
+  std::string content = GetValidConfigContent();
+  content.replace(content.find("slow_ema = 5s\n"), 14,
+                  "slow_ema = 5s\nalpha_table = cubic\n");
+  WriteConfigFile(content);
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("alpha_table"));
+}
+
+TEST_F(ConfigManagerTest, ValidateAlphaTableTooLarge) {
+  std::string content = GetValidConfigContent();
+  content.replace(content.find("slow_ema = 5s\n"), 14,
+                  "slow_ema = 5s\nalpha_table = nearest\n"
+                  "alpha_table_step = 1ns\n");
+  WriteConfigFile(content);
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("alpha_table_step"));
+}
+
 // D36-D50: Boundary Combinations
 
 TEST_F(ConfigManagerTest, ValidateAllMinimumsAtBoundary) {
@@ -1418,3 +1668,284 @@ TEST_F(ConfigManagerTest, PathsWithMultipleSlashes) {
   EXPECT_TRUE(result.has_value());
   // filesystem::path should handle normalization
 }
+
+TEST_F(ConfigManagerTest, ParseBarResolutions) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "tick_log_format = bars\nbar_resolutions = 1s, 5min,1h\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->tick_log_format, TickLogFormat::Bars);
+  EXPECT_EQ(result->bar_resolutions,
+            (std::vector<std::chrono::nanoseconds>{1s, 5min, 1h}));
+}
+
+TEST_F(ConfigManagerTest, ParseInvalidBarResolutions) {
+  WriteConfigFile(GetValidConfigContent() + "bar_resolutions = 1s,,1h\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("bar_resolutions"));
+}
+
+TEST_F(ConfigManagerTest, BarResolutionBelowMillisecond_ReturnsError) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "tick_log_format = bars\nbar_resolutions = 1s,500us\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("bar_resolutions"));
+}
+
+TEST_F(ConfigManagerTest, DuplicateBarResolutions_ReturnsError) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "tick_log_format = bars\nbar_resolutions = 60s,1min\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("duplicates"));
+}
+
+TEST_F(ConfigManagerTest, ParseTickFeed) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "tick_log_format = feed\ntick_feed_name = ticks_a\n"
+                  "tick_feed_capacity = 1024\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->tick_log_format, TickLogFormat::Feed);
+  EXPECT_EQ(result->tick_feed_name, "ticks_a");
+  EXPECT_EQ(result->tick_feed_capacity, 1024);
+}
+
+TEST_F(ConfigManagerTest, TickFeedCapacityNotPowerOfTwo_ReturnsError) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "tick_log_format = feed\ntick_feed_capacity = 1000\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("tick_feed_capacity"));
+}
+
+TEST_F(ConfigManagerTest, ParseUdpFeed) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "tick_log_format = udp\nudp_feed_port = 31001\n"
+                  "udp_replay_port = 31002\nudp_feed_batch = 8\n"
+                  "udp_replay_capacity = 1024\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->tick_log_format, TickLogFormat::Udp);
+  EXPECT_EQ(result->udp_feed_port, 31001);
+  EXPECT_EQ(result->udp_replay_port, 31002);
+  EXPECT_EQ(result->udp_feed_batch, 8);
+  EXPECT_EQ(result->udp_replay_capacity, 1024);
+}
+
+TEST_F(ConfigManagerTest, UdpFeedBatchTooLarge_ReturnsError) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "tick_log_format = udp\nudp_feed_batch = 61\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("udp_feed_batch"));
+}
+
+TEST_F(ConfigManagerTest, ParseRemoteVenue) {
+  WriteConfigFile(ModifyConfigValue(GetValidConfigContent(),
+                                    "rejection_probability",
+                                    "1.0\nvenue = remote\nvenue_name = venue_a"
+                                    "\nvenue_capacity = 256"));
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->venue, ExchangeVenue::Remote);
+  EXPECT_EQ(result->venue_name, "venue_a");
+  EXPECT_EQ(result->venue_capacity, 256);
+}
+
+TEST_F(ConfigManagerTest, ParseInvalidVenue) {
+  WriteConfigFile(ModifyConfigValue(GetValidConfigContent(),
+                                    "rejection_probability",
+                                    "1.0\nvenue = moon"));
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("venue"));
+}
+
+TEST_F(ConfigManagerTest, RemoteVenueWithCompressedLog_ReturnsError) {
+  WriteConfigFile(ModifyConfigValue(GetValidConfigContent() +
+                                        "tick_log_format = compressed\n",
+                                    "rejection_probability",
+                                    "1.0\nvenue = remote"));
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("venue = remote"));
+}
+
+TEST_F(ConfigManagerTest, RemoteVenueWithCheckpoints_ReturnsError) {
+  WriteConfigFile(ModifyConfigValue(
+      GetValidConfigContent() + "checkpoint_interval = 100\n",
+      "rejection_probability", "1.0\nvenue = remote"));
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("venue = remote"));
+}
+
+TEST_F(ConfigManagerTest, ParseSharedVenue) {
+  WriteConfigFile(ModifyConfigValue(GetValidConfigContent(),
+                                    "rejection_probability",
+                                    "1.0\nvenue = shared\n"
+                                    "venue_sessions = 12"));
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->venue, ExchangeVenue::Shared);
+  EXPECT_EQ(result->venue_sessions, 12);
+}
+
+TEST_F(ConfigManagerTest, SharedVenueWithCheckpoints_ReturnsError) {
+  WriteConfigFile(ModifyConfigValue(
+      GetValidConfigContent() + "checkpoint_interval = 100\n",
+      "rejection_probability", "1.0\nvenue = shared"));
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("venue = shared"));
+}
+
+TEST_F(ConfigManagerTest, ParseGatewayPort) {
+  WriteConfigFile(ModifyConfigValue(GetValidConfigContent(),
+                                    "rejection_probability",
+                                    "1.0\ngateway_port = 31003"));
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->gateway_port, 31003);
+}
+
+TEST_F(ConfigManagerTest, GatewayPortOutOfRange_ReturnsError) {
+  WriteConfigFile(ModifyConfigValue(GetValidConfigContent(),
+                                    "rejection_probability",
+                                    "1.0\ngateway_port = 70000"));
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("gateway_port"));
+}
+
+TEST_F(ConfigManagerTest, ParseTickDelivery) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "tick_delivery = latest\nconflate_volume = true\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->tick_delivery, TickDelivery::Latest);
+  EXPECT_TRUE(result->conflate_volume);
+}
+
+TEST_F(ConfigManagerTest, ParseInvalidTickDelivery) {
+  WriteConfigFile(GetValidConfigContent() + "tick_delivery = sometimes\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("tick_delivery"));
+}
+
+TEST_F(ConfigManagerTest, ParseBusDelivery) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "tick_delivery = bus\nbus_capacity = 1024\n"
+                  "bus_wait = yield\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_EQ(result->tick_delivery, TickDelivery::Bus);
+  EXPECT_EQ(result->bus_capacity, 1024);
+  EXPECT_EQ(result->bus_wait, BusWait::Yield);
+}
+
+TEST_F(ConfigManagerTest, ParseInvalidBusWait) {
+  WriteConfigFile(GetValidConfigContent() + "bus_wait = sleep\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("bus_wait"));
+}
+
+TEST_F(ConfigManagerTest, BusCapacityNotPowerOfTwo_ReturnsError) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "tick_delivery = bus\nbus_capacity = 1000\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("bus_capacity"));
+}
+
+TEST_F(ConfigManagerTest, LatestDeliveryWithCheckpoints_ReturnsError) {
+  WriteConfigFile(GetValidConfigContent() +
+                  "tick_delivery = latest\ncheckpoint_interval = 100\n");
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("checkpoint_interval"));
+}
+
+TEST_F(ConfigManagerTest, ParseRiskLimits) {
+  WriteConfigFile(ModifyConfigValue(GetValidConfigContent(), "max_position",
+                                    "1000\nmax_order_notional = 50000\n"
+                                    "max_orders_per_second = 2.5\n"
+                                    "order_burst = 4\nmax_loss = 750"));
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_TRUE(result.has_value()) << result.error();
+  EXPECT_DOUBLE_EQ(result->max_order_notional, 50000.0);
+  EXPECT_DOUBLE_EQ(result->max_orders_per_second, 2.5);
+  EXPECT_EQ(result->order_burst, 4);
+  EXPECT_DOUBLE_EQ(result->max_loss, 750.0);
+}
+
+TEST_F(ConfigManagerTest, ZeroOrderBurst_ReturnsError) {
+  WriteConfigFile(ModifyConfigValue(GetValidConfigContent(), "max_position",
+                                    "1000\norder_burst = 0"));
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("order_burst"));
+}
+
+TEST_F(ConfigManagerTest, NegativeMaxLoss_ReturnsError) {
+  WriteConfigFile(ModifyConfigValue(GetValidConfigContent(), "max_position",
+                                    "1000\nmax_loss = -1"));
+
+  auto result = ConfigManager::Load(test_config_path);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_THAT(result.error(), HasSubstr("max_loss"));
+}
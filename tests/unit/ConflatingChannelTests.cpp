@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+#include "common/ConflatingChannel.h"
+
+namespace {
+
+// Every word equal, so a torn copy is easy to spot
+struct Wide {
+  uint64_t a;
+  uint64_t b;
+  uint64_t c;
+  uint64_t d;
+};
+
+}  // namespace
+
+TEST(ConflatingChannelTest, Empty_TakeReturnsNothing) {
+  ConflatingChannel<int> channel;
+
+  EXPECT_FALSE(channel.take().has_value());
+  EXPECT_EQ(channel.published(), 0);
+}
+
+TEST(ConflatingChannelTest, LastValueWins) {
+  ConflatingChannel<int> channel;
+
+  channel.publish(1);
+  channel.publish(2);
+  channel.publish(3);
+
+  EXPECT_EQ(channel.take(), 3);
+  EXPECT_FALSE(channel.take().has_value());
+  EXPECT_EQ(channel.published(), 3);
+  EXPECT_EQ(channel.taken(), 1);
+  EXPECT_EQ(channel.conflated(), 2);
+}
+
+TEST(ConflatingChannelTest, EveryValueTakenInTime_NothingConflated) {
+  ConflatingChannel<int> channel;
+
+  for (int i = 0; i < 10; ++i) {
+    channel.publish(i);
+    EXPECT_EQ(channel.take(), i);
+  }
+
+  EXPECT_EQ(channel.conflated(), 0);
+}
+
+TEST(ConflatingChannelTest, Close_WaitDrainsLastValue) {
+  ConflatingChannel<int> channel;
+
+  channel.publish(5);
+  channel.close();
+
+  EXPECT_EQ(channel.wait(), 5);
+  EXPECT_FALSE(channel.wait().has_value());
+}
+
+TEST(ConflatingChannelTest, ConcurrentWriter_ValuesWholeAndIncreasing) {
+  constexpr uint64_t kValues = 200'000;
+  ConflatingChannel<Wide> channel;
+
+  std::jthread writer([&] {
+    for (uint64_t i = 1; i <= kValues; ++i) {
+      channel.publish({i, i, i, i});
+    }
+    channel.close();
+  });
+
+  uint64_t last = 0;
+  uint64_t taken = 0;
+  while (auto value = channel.wait()) {
+    ASSERT_EQ(value->a, value->b);
+    ASSERT_EQ(value->a, value->c);
+    ASSERT_EQ(value->a, value->d);
+    ASSERT_GT(value->a, last);
+    last = value->a;
+    ++taken;
+  }
+
+  EXPECT_EQ(last, kValues);
+  EXPECT_EQ(channel.taken(), taken);
+  EXPECT_EQ(channel.published(), kValues);
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "common/EventBus.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+void Publish(EventBus<uint64_t>& bus, uint64_t from, uint64_t to) {
+  for (uint64_t i = from; i < to; ++i) {
+    bus.claim() = i;
+    bus.publish();
+  }
+}
+
+}  // namespace
+
+TEST(EventBusTest, Consumer_SeesEveryEventInOrder) {
+  EventBus<uint64_t> bus(8, BusWait::Block);
+  const size_t consumer = bus.addConsumer();
+  std::vector<uint64_t> seen;
+
+  std::jthread thread([&] {
+    bus.run(consumer, [&](uint64_t event, bool) { seen.push_back(event); });
+  });
+  Publish(bus, 0, 1000);
+  bus.close();
+  thread.join();
+
+  ASSERT_EQ(seen.size(), 1000);
+  for (uint64_t i = 0; i < seen.size(); ++i) {
+    EXPECT_EQ(seen[i], i);
+  }
+}
+
+TEST(EventBusTest, DependentConsumer_SeesEventsAfterItsDependency) {
+  EventBus<uint64_t> bus(16, BusWait::Block);
+  const size_t first = bus.addConsumer();
+  const size_t second = bus.addConsumer({first});
+  std::atomic<uint64_t> first_done = 0;
+  uint64_t out_of_order = 0;
+  uint64_t second_seen = 0;
+
+  std::jthread first_thread([&] {
+    bus.run(first, [&](uint64_t, bool) {
+      std::this_thread::sleep_for(10us);
+      first_done.fetch_add(1, std::memory_order_relaxed);
+    });
+  });
+  std::jthread second_thread([&] {
+    bus.run(second, [&](uint64_t event, bool) {
+      if (first_done.load(std::memory_order_relaxed) <= event) ++out_of_order;
+      ++second_seen;
+    });
+  });
+  Publish(bus, 0, 500);
+  bus.close();
+  first_thread.join();
+  second_thread.join();
+
+  EXPECT_EQ(second_seen, 500);
+  EXPECT_EQ(out_of_order, 0);
+}
+
+TEST(EventBusTest, SlowConsumer_ProducerNeverOverwritesUnreadEvents) {
+  EventBus<uint64_t> bus(4, BusWait::Block);
+  const size_t fast = bus.addConsumer();
+  const size_t slow = bus.addConsumer();
+  std::vector<uint64_t> seen;
+
+  std::jthread fast_thread([&] { bus.run(fast, [](uint64_t, bool) {}); });
+  std::jthread slow_thread([&] {
+    bus.run(slow, [&](uint64_t event, bool) {
+      std::this_thread::sleep_for(20us);
+      seen.push_back(event);
+    });
+  });
+  Publish(bus, 0, 200);
+  bus.close();
+  slow_thread.join();
+
+  ASSERT_EQ(seen.size(), 200);
+  for (uint64_t i = 0; i < seen.size(); ++i) {
+    EXPECT_EQ(seen[i], i);
+  }
+}
+
+TEST(EventBusTest, ConsumerBehind_TakesEverythingInOneBatch) {
+  EventBus<uint64_t> bus(128, BusWait::Block);
+  const size_t consumer = bus.addConsumer();
+  Publish(bus, 0, 100);
+
+  uint64_t handled = 0;
+  uint64_t batch_ends = 0;
+  ASSERT_TRUE(bus.consume(consumer, [&](uint64_t, bool end_of_batch) {
+    ++handled;
+    batch_ends += end_of_batch ? 1 : 0;
+  }));
+
+  EXPECT_EQ(handled, 100);
+  EXPECT_EQ(batch_ends, 1);
+  EXPECT_EQ(bus.batches(consumer), 1);
+}
+
+TEST(EventBusTest, Closed_ConsumeReturnsFalseOnceDrained) {
+  EventBus<uint64_t> bus(8, BusWait::Spin);
+  const size_t consumer = bus.addConsumer();
+  Publish(bus, 0, 3);
+  bus.close();
+
+  uint64_t handled = 0;
+  EXPECT_TRUE(bus.consume(consumer, [&](uint64_t, bool) { ++handled; }));
+  EXPECT_FALSE(bus.consume(consumer, [&](uint64_t, bool) { ++handled; }));
+  EXPECT_EQ(handled, 3);
+}
+
+TEST(EventBusTest, Drain_WaitsForEveryConsumer) {
+  EventBus<uint64_t> bus(64, BusWait::Block);
+  const size_t first = bus.addConsumer();
+  const size_t second = bus.addConsumer({first});
+  uint64_t first_sum = 0;
+  uint64_t second_sum = 0;
+
+  std::jthread first_thread([&] {
+    bus.run(first, [&](uint64_t event, bool) { first_sum += event; });
+  });
+  std::jthread second_thread([&] {
+    bus.run(second, [&](uint64_t event, bool) {
+      std::this_thread::sleep_for(10us);
+      second_sum += event;
+    });
+  });
+  Publish(bus, 0, 50);
+  bus.drain();
+
+  // Both consumers are idle until more is published
+  EXPECT_EQ(first_sum, 49 * 50 / 2);
+  EXPECT_EQ(second_sum, 49 * 50 / 2);
+  bus.close();
+}
+
+class EventBusWaitTest : public ::testing::TestWithParam<BusWait> {};
+
+TEST_P(EventBusWaitTest, ProducerAndConsumers_HandOverEveryEvent) {
+  EventBus<uint64_t> bus(256, GetParam());
+  const size_t first = bus.addConsumer();
+  const size_t second = bus.addConsumer({first});
+  uint64_t first_sum = 0;
+  uint64_t second_sum = 0;
+
+  std::jthread first_thread([&] {
+    bus.run(first, [&](uint64_t event, bool) { first_sum += event; });
+  });
+  std::jthread second_thread([&] {
+    bus.run(second, [&](uint64_t event, bool) { second_sum += event; });
+  });
+  Publish(bus, 0, 5000);
+  bus.close();
+  first_thread.join();
+  second_thread.join();
+
+  EXPECT_EQ(first_sum, uint64_t{4999} * 5000 / 2);
+  EXPECT_EQ(second_sum, first_sum);
+}
+
+INSTANTIATE_TEST_SUITE_P(AllWaits, EventBusWaitTest,
+                         ::testing::Values(BusWait::Spin, BusWait::Yield,
+                                           BusWait::Block));
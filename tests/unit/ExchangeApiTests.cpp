@@ -1,12 +1,15 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "trading/ExchangeApi.h"
 
 using ::testing::_;
+using namespace std::chrono_literals;
 
 // ============================================================================
 // Constructor Tests
@@ -330,3 +333,276 @@ TEST(ExchangeApiTest, MultiplePollCycles_IndependentBatches) {
   EXPECT_EQ(batch1_ids[0], 1);
   EXPECT_EQ(batch2_ids[0], 2);
 }
+
+// ============================================================================
+// SendOrders Tests
+// ============================================================================
+
+TEST(ExchangeApiTest, SendOrders_ConsecutiveIdsAnsweredByOnePoll) {
+  ExchangeApi api(0.0);
+  api.sendOrder({OrderSide::Buy, 100.0, 1.0}, nullptr);
+  const std::vector<Order> basket{{OrderSide::Buy, 100.0, 10.0},
+                                  {OrderSide::Sell, 101.0, 5.0},
+                                  {OrderSide::Buy, 99.0, 2.0}};
+  std::vector<OrderIdentifier> received_ids;
+
+  const OrderIdentifier first_id = api.sendOrders(
+      basket, [&received_ids](OrderIdentifier id, auto, auto) {
+        received_ids.push_back(id);
+      });
+  api.poll();
+
+  EXPECT_EQ(first_id, 2);
+  EXPECT_EQ(received_ids, (std::vector<OrderIdentifier>{2, 3, 4}));
+}
+
+TEST(ExchangeApiTest, SendOrders_SameDecisionsAsOneByOne) {
+  ExchangeApi batched(50.0, 42);
+  ExchangeApi one_by_one(50.0, 42);
+  const std::vector<Order> basket(64, Order{OrderSide::Buy, 100.0, 1.0});
+  std::vector<Status> batched_statuses;
+  std::vector<Status> one_by_one_statuses;
+
+  batched.sendOrders(basket, [&](OrderIdentifier, Status status, auto) {
+    batched_statuses.push_back(status);
+  });
+  batched.poll();
+  for (const auto& order : basket) {
+    one_by_one.sendOrder(order, [&](OrderIdentifier, Status status, auto) {
+      one_by_one_statuses.push_back(status);
+    });
+  }
+  one_by_one.poll();
+
+  EXPECT_EQ(batched_statuses, one_by_one_statuses);
+}
+
+TEST(ExchangeApiTest, SendOrders_EmptyBasket_NothingPending) {
+  ExchangeApi api(0.0);
+  int callback_count = 0;
+
+  const OrderIdentifier first_id = api.sendOrders(
+      {}, [&callback_count](auto, auto, auto) { ++callback_count; });
+  api.poll();
+
+  EXPECT_EQ(first_id, 1);
+  EXPECT_EQ(callback_count, 0);
+  EXPECT_EQ(api.sendOrder({OrderSide::Buy, 100.0, 1.0}, nullptr), 1);
+}
+
+// ============================================================================
+// Resting Order Tests
+// ============================================================================
+
+namespace {
+
+struct ReportLog {
+  std::vector<ExecutionReport> reports;
+  std::vector<std::string> texts;  // reports only borrow theirs
+
+  ReportCallback callback() {
+    return [this](const ExecutionReport& report) {
+      reports.push_back(report);
+      texts.emplace_back(report.text);
+    };
+  }
+
+  [[nodiscard]] std::vector<Status> statuses() const {
+    std::vector<Status> result;
+    for (const auto& report : reports) result.push_back(report.status);
+    return result;
+  }
+};
+
+}  // namespace
+
+TEST(ExchangeApiTest, PlaceOrder_AckedOnPoll) {
+  ExchangeApi api(0.0);
+  ReportLog log;
+  api.setReportCallback(log.callback());
+
+  const OrderIdentifier id = api.placeOrder({OrderSide::Buy, 100.0, 10.0});
+  EXPECT_TRUE(log.reports.empty());
+  api.poll();
+
+  ASSERT_EQ(log.reports.size(), 1);
+  EXPECT_EQ(log.reports[0].id, id);
+  EXPECT_EQ(log.reports[0].status, Status::Acked);
+  EXPECT_DOUBLE_EQ(log.reports[0].leaves, 10.0);
+}
+
+TEST(ExchangeApiTest, PlaceOrder_SharesIdsWithSendOrder) {
+  ExchangeApi api(0.0);
+  api.sendOrder({OrderSide::Buy, 100.0, 1.0}, nullptr);
+
+  EXPECT_EQ(api.placeOrder({OrderSide::Buy, 100.0, 1.0}), 2);
+  EXPECT_EQ(api.sendOrder({OrderSide::Buy, 100.0, 1.0}, nullptr), 3);
+}
+
+TEST(ExchangeApiTest, PlaceOrder_Rejected_NeverFills) {
+  ExchangeApi api(100.0);
+  ReportLog log;
+  api.setReportCallback(log.callback());
+
+  api.placeOrder({OrderSide::Buy, 100.0, 10.0});
+  api.onMarket({0ms, 90.0, 100.0});
+  api.poll();
+
+  EXPECT_EQ(log.statuses(), std::vector<Status>{Status::Rejected});
+  EXPECT_EQ(log.texts[0], "Random rejection");
+}
+
+TEST(ExchangeApiTest, OnMarket_FillsInPartsUpToTickVolume) {
+  ExchangeApi api(0.0);
+  ReportLog log;
+  api.setReportCallback(log.callback());
+  api.placeOrder({OrderSide::Buy, 100.0, 10.0});
+
+  api.onMarket({0ms, 101.0, 50.0});  // above the limit
+  api.onMarket({1ms, 100.0, 4.0});
+  api.onMarket({2ms, 99.0, 50.0});
+  api.poll();
+
+  EXPECT_EQ(log.statuses(), (std::vector<Status>{Status::Acked,
+                                                 Status::PartiallyFilled,
+                                                 Status::Executed}));
+  EXPECT_DOUBLE_EQ(log.reports[1].filled, 4.0);
+  EXPECT_DOUBLE_EQ(log.reports[1].leaves, 6.0);
+  EXPECT_DOUBLE_EQ(log.reports[1].price, 100.0);  // at the limit
+  EXPECT_DOUBLE_EQ(log.reports[2].filled, 6.0);
+  EXPECT_DOUBLE_EQ(log.reports[2].leaves, 0.0);
+}
+
+TEST(ExchangeApiTest, OnMarket_SellFillsAtOrAboveLimit) {
+  ExchangeApi api(0.0);
+  ReportLog log;
+  api.setReportCallback(log.callback());
+  api.placeOrder({OrderSide::Sell, 100.0, 5.0});
+
+  api.onMarket({0ms, 99.0, 50.0});
+  api.poll();
+  EXPECT_EQ(log.reports.size(), 1);
+
+  api.onMarket({1ms, 100.5, 50.0});
+  api.poll();
+  EXPECT_EQ(log.reports.back().status, Status::Executed);
+}
+
+TEST(ExchangeApiTest, OnMarket_EarlierOrdersTakeLiquidityFirst) {
+  ExchangeApi api(0.0);
+  ReportLog log;
+  api.setReportCallback(log.callback());
+  const OrderIdentifier first = api.placeOrder({OrderSide::Buy, 100.0, 3.0});
+  const OrderIdentifier second = api.placeOrder({OrderSide::Buy, 100.0, 3.0});
+  api.poll();
+  log.reports.clear();
+
+  api.onMarket({0ms, 100.0, 4.0});
+  api.poll();
+
+  ASSERT_EQ(log.reports.size(), 2);
+  EXPECT_EQ(log.reports[0].id, first);
+  EXPECT_EQ(log.reports[0].status, Status::Executed);
+  EXPECT_EQ(log.reports[1].id, second);
+  EXPECT_DOUBLE_EQ(log.reports[1].filled, 1.0);
+}
+
+TEST(ExchangeApiTest, OnMarket_ExpiresAtDeadline) {
+  ExchangeApi api(0.0);
+  ReportLog log;
+  api.setReportCallback(log.callback());
+  api.placeOrder({OrderSide::Buy, 100.0, 10.0}, 5ms);
+
+  api.onMarket({4ms, 101.0, 1.0});
+  api.onMarket({5ms, 99.0, 1.0});  // expires before it could fill
+  api.onMarket({6ms, 99.0, 1.0});
+  api.poll();
+
+  EXPECT_EQ(log.statuses(),
+            (std::vector<Status>{Status::Acked, Status::Expired}));
+  EXPECT_DOUBLE_EQ(log.reports[1].leaves, 10.0);
+}
+
+TEST(ExchangeApiTest, CancelOrder_RemovesFromBook) {
+  ExchangeApi api(0.0);
+  ReportLog log;
+  api.setReportCallback(log.callback());
+  const OrderIdentifier id = api.placeOrder({OrderSide::Buy, 100.0, 10.0});
+  api.onMarket({0ms, 100.0, 4.0});
+
+  api.cancelOrder(id);
+  api.onMarket({1ms, 100.0, 100.0});
+  api.cancelOrder(id);
+  api.poll();
+
+  EXPECT_EQ(log.statuses(),
+            (std::vector<Status>{Status::Acked, Status::PartiallyFilled,
+                                 Status::Cancelled, Status::Rejected}));
+  EXPECT_DOUBLE_EQ(log.reports[2].leaves, 6.0);
+  EXPECT_EQ(log.texts[3], "Too late to cancel");
+}
+
+TEST(ExchangeApiTest, ReplaceOrder_AmendsInPlace) {
+  ExchangeApi api(0.0);
+  ReportLog log;
+  api.setReportCallback(log.callback());
+  const OrderIdentifier id = api.placeOrder({OrderSide::Buy, 100.0, 10.0});
+  api.onMarket({0ms, 100.0, 4.0});
+
+  api.replaceOrder(id, 98.0, 5.0);
+  api.onMarket({1ms, 99.0, 100.0});  // above the new limit
+  api.onMarket({2ms, 98.0, 100.0});
+  api.poll();
+
+  EXPECT_EQ(log.statuses(),
+            (std::vector<Status>{Status::Acked, Status::PartiallyFilled,
+                                 Status::Replaced, Status::Executed}));
+  EXPECT_EQ(log.reports[2].id, id);
+  EXPECT_DOUBLE_EQ(log.reports[2].leaves, 1.0);
+  EXPECT_DOUBLE_EQ(log.reports[3].price, 98.0);
+  EXPECT_DOUBLE_EQ(log.reports[3].filled, 1.0);
+}
+
+TEST(ExchangeApiTest, ReplaceOrder_BelowFilled_Rejected) {
+  ExchangeApi api(0.0);
+  ReportLog log;
+  api.setReportCallback(log.callback());
+  const OrderIdentifier id = api.placeOrder({OrderSide::Buy, 100.0, 10.0});
+  api.onMarket({0ms, 100.0, 4.0});
+
+  api.replaceOrder(id, 100.0, 4.0);
+  api.onMarket({1ms, 100.0, 100.0});
+  api.poll();
+
+  EXPECT_EQ(log.statuses(),
+            (std::vector<Status>{Status::Acked, Status::PartiallyFilled,
+                                 Status::Rejected, Status::Executed}));
+  EXPECT_EQ(log.texts[2], "Replace below filled volume");
+  EXPECT_DOUBLE_EQ(log.reports[3].filled, 6.0);
+}
+
+TEST(ExchangeApiTest, SaveLoad_KeepsRestingOrders) {
+  ExchangeApi original(0.0, 7);
+  original.placeOrder({OrderSide::Buy, 100.0, 10.0});
+  const OrderIdentifier cancelled =
+      original.placeOrder({OrderSide::Buy, 100.0, 10.0});
+  original.cancelOrder(cancelled);
+  original.placeOrder({OrderSide::Sell, 105.0, 2.0});
+  original.poll();
+
+  SnapshotWriter writer;
+  original.save(writer);
+  ExchangeApi restored(0.0, 1);
+  SnapshotReader reader(std::move(writer).release());
+  restored.load(reader, nullptr);
+  ReportLog log;
+  restored.setReportCallback(log.callback());
+
+  restored.onMarket({0ms, 100.0, 4.0});
+  restored.poll();
+
+  ASSERT_EQ(log.reports.size(), 1);
+  EXPECT_EQ(log.reports[0].id, 1);
+  EXPECT_DOUBLE_EQ(log.reports[0].leaves, 6.0);
+  EXPECT_EQ(restored.placeOrder({OrderSide::Buy, 100.0, 1.0}), 4);
+}
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+
+#include "logs/FileSink.h"
+#include "logs/PosixFileSinks.h"
+#include "logs/TickLogger.h"
+
+using namespace std::chrono_literals;
+
+namespace fs = std::filesystem;
+
+class FileSinkTest : public ::testing::TestWithParam<FileSinkBackend> {
+ protected:
+  fs::path temp_dir;
+  fs::path test_file_path;
+
+  void SetUp() override {
+    auto timestamp =
+        std::chrono::system_clock::now().time_since_epoch().count();
+    temp_dir = fs::temp_directory_path() /
+               std::format("file_sink_test_{}", timestamp);
+    fs::create_directories(temp_dir);
+    test_file_path = temp_dir / "out.bin";
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(temp_dir, ec);
+  }
+
+  // Skips backends the platform or kernel does not provide
+  std::optional<FileSink> Open(bool append) {
+    auto sink = OpenFileSink(GetParam(), test_file_path, append);
+    if (!sink) {
+      return std::nullopt;
+    }
+    return std::move(sink.value());
+  }
+
+  std::string ReadFileContent() {
+    std::ifstream file(test_file_path, std::ios::binary);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+  }
+};
+
+// Lines of varying length, long enough to wrap every backend's buffers
+std::string MakeContent(size_t bytes) {
+  std::string content;
+  for (size_t i = 0; content.size() < bytes; ++i) {
+    content += std::format("{},{}\n", i, std::string(i % 97, 'x'));
+  }
+  return content;
+}
+
+TEST_P(FileSinkTest, Write_ContentMatchesAfterClose) {
+  const auto content = MakeContent(3 * PwriteFileSink::kBufferSize + 123);
+  {
+    auto sink = Open(false);
+    if (!sink) GTEST_SKIP() << "backend unavailable";
+    std::string_view rest = content;
+    while (!rest.empty()) {
+      const size_t n = std::min<size_t>(rest.size(), 1000);
+      ASSERT_FALSE(sink->write(rest.substr(0, n)).has_value());
+      rest.remove_prefix(n);
+    }
+  }
+
+  EXPECT_EQ(ReadFileContent(), content);
+}
+
+TEST_P(FileSinkTest, Write_LargerThanBuffer) {
+  const auto content = MakeContent(5 * PwriteFileSink::kBufferSize);
+  {
+    auto sink = Open(false);
+    if (!sink) GTEST_SKIP() << "backend unavailable";
+    ASSERT_FALSE(sink->write(content).has_value());
+  }
+
+  EXPECT_EQ(ReadFileContent(), content);
+}
+
+TEST_P(FileSinkTest, Flush_MakesDataVisible) {
+  auto sink = Open(false);
+  if (!sink) GTEST_SKIP() << "backend unavailable";
+  ASSERT_FALSE(sink->write("header\nline\n").has_value());
+  ASSERT_FALSE(sink->flush().has_value());
+
+  // The mmap backend keeps the file extended while it is open
+  EXPECT_TRUE(ReadFileContent().starts_with("header\nline\n"));
+}
+
+TEST_P(FileSinkTest, Append_ContinuesExistingFile) {
+  {
+    auto sink = Open(false);
+    if (!sink) GTEST_SKIP() << "backend unavailable";
+    sink->write("first\n");
+  }
+  {
+    auto sink = Open(true);
+    ASSERT_TRUE(sink.has_value());
+    sink->write("second\n");
+  }
+
+  EXPECT_EQ(ReadFileContent(), "first\nsecond\n");
+}
+
+TEST_P(FileSinkTest, Truncate_WithoutAppend) {
+  {
+    std::ofstream file(test_file_path);
+    file << "old content\n";
+  }
+  {
+    auto sink = Open(false);
+    if (!sink) GTEST_SKIP() << "backend unavailable";
+    sink->write("new\n");
+  }
+
+  EXPECT_EQ(ReadFileContent(), "new\n");
+}
+
+TEST_P(FileSinkTest, Open_MissingDirectory_ReturnsError) {
+  auto sink = OpenFileSink(GetParam(), temp_dir / "missing" / "out.bin", false);
+
+  EXPECT_FALSE(sink.has_value());
+}
+
+TEST_P(FileSinkTest, TickLogger_ResumeTruncatesBufferedLog) {
+  if (!Open(false)) GTEST_SKIP() << "backend unavailable";
+
+  Config cfg;
+  cfg.price_evolution_path = test_file_path;
+  cfg.tick_log_backend = GetParam();
+
+  std::string snapshot;
+  {
+    TickLogger logger(cfg);
+    logger.writeTick({1s, 100.0, 10.0});
+    SnapshotWriter writer;
+    logger.save(writer);
+    snapshot = std::move(writer).release();
+    logger.writeTick({2s, 999.0, 10.0});  // after the checkpoint
+  }
+
+  cfg.resume = true;
+  {
+    TickLogger logger(cfg);
+    SnapshotReader reader(std::move(snapshot));
+    ASSERT_FALSE(logger.load(reader).has_value());
+    logger.writeTick({3s, 101.0, 10.0});
+  }
+
+  EXPECT_EQ(ReadFileContent(),
+            "Time,Price,Volume\n"
+            "00:00:01.000,100.000,10.000\n"
+            "00:00:03.000,101.000,10.000\n");
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Backends, FileSinkTest,
+    ::testing::Values(FileSinkBackend::Stream, FileSinkBackend::Pwrite,
+                      FileSinkBackend::Mmap, FileSinkBackend::IoUring),
+    [](const auto& info) {
+      switch (info.param) {
+        case FileSinkBackend::Stream:
+          return "Stream";
+        case FileSinkBackend::Pwrite:
+          return "Pwrite";
+        case FileSinkBackend::Mmap:
+          return "Mmap";
+        case FileSinkBackend::IoUring:
+          return "IoUring";
+      }
+      return "Unknown";
+    });
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+#include "venue/FixMessage.h"
+
+namespace {
+
+// Messages are written with '|' for SOH
+std::string Fix(std::string text) {
+  std::ranges::replace(text, '|', kFixSoh);
+  return text;
+}
+
+const std::string kNewOrder =
+    Fix("8=FIX.4.2|9=31|35=D|11=A1|54=1|38=10|44=100.5|10=114|");
+
+}  // namespace
+
+TEST(FixMessageTest, Parse_NewOrder_ReadsFields) {
+  FixMessage message;
+  const auto result = ParseFixMessage(kNewOrder, message);
+
+  ASSERT_EQ(result.status, FixParseStatus::Complete) << result.error;
+  EXPECT_EQ(result.length, kNewOrder.size());
+  EXPECT_EQ(message.type(), "D");
+  EXPECT_EQ(message.get(FixTag::ClOrdId), "A1");
+  EXPECT_EQ(message.get(FixTag::Side), "1");
+  EXPECT_EQ(message.get(FixTag::OrderQty), "10");
+  EXPECT_EQ(message.get(FixTag::Price), "100.5");
+  EXPECT_EQ(message.get(FixTag::Text), "");
+  EXPECT_EQ(message.fieldCount(), 5);
+}
+
+TEST(FixMessageTest, Parse_ValuesPointIntoInput) {
+  FixMessage message;
+  ASSERT_EQ(ParseFixMessage(kNewOrder, message).status,
+            FixParseStatus::Complete);
+
+  const auto id = message.get(FixTag::ClOrdId);
+  EXPECT_GE(id.data(), kNewOrder.data());
+  EXPECT_LT(id.data(), kNewOrder.data() + kNewOrder.size());
+}
+
+TEST(FixMessageTest, Parse_EveryPrefix_Incomplete) {
+  FixMessage message;
+  for (size_t size = 0; size < kNewOrder.size(); ++size) {
+    const auto result =
+        ParseFixMessage(std::string_view(kNewOrder).substr(0, size), message);
+    EXPECT_EQ(result.status, FixParseStatus::Incomplete) << "size " << size;
+  }
+}
+
+TEST(FixMessageTest, Parse_BackToBackMessages_OneAtATime) {
+  const std::string input = kNewOrder + kNewOrder;
+  FixMessage message;
+
+  const auto first = ParseFixMessage(input, message);
+  ASSERT_EQ(first.status, FixParseStatus::Complete);
+  const auto second =
+      ParseFixMessage(std::string_view(input).substr(first.length), message);
+  ASSERT_EQ(second.status, FixParseStatus::Complete);
+  EXPECT_EQ(first.length + second.length, input.size());
+}
+
+TEST(FixMessageTest, Parse_WrongCheckSum_Invalid) {
+  FixMessage message;
+  const auto result = ParseFixMessage(
+      Fix("8=FIX.4.2|9=31|35=D|11=A1|54=1|38=10|44=100.5|10=115|"), message);
+
+  EXPECT_EQ(result.status, FixParseStatus::Invalid);
+  EXPECT_EQ(result.error, "CheckSum mismatch");
+}
+
+TEST(FixMessageTest, Parse_WrongBeginString_Invalid) {
+  FixMessage message;
+
+  EXPECT_EQ(ParseFixMessage(Fix("8=FIX.4.4|9=5|35=0|10=000|"), message).status,
+            FixParseStatus::Invalid);
+  EXPECT_EQ(ParseFixMessage("GET / HTTP", message).status,
+            FixParseStatus::Invalid);
+}
+
+TEST(FixMessageTest, Parse_BadBodyLength_Invalid) {
+  FixMessage message;
+
+  EXPECT_EQ(ParseFixMessage(Fix("8=FIX.4.2|9=x|"), message).status,
+            FixParseStatus::Invalid);
+  EXPECT_EQ(ParseFixMessage(Fix("8=FIX.4.2|9=12345678"), message).status,
+            FixParseStatus::Invalid);
+}
+
+TEST(FixMessageTest, Writer_RoundTripsThroughParser) {
+  std::array<char, 256> buffer{};
+  const auto text = FixWriter(buffer, "8")
+                        .add(FixTag::OrderId, uint64_t{42})
+                        .add(FixTag::ClOrdId, "B7")
+                        .add(FixTag::OrderQty, 12.5)
+                        .add(FixTag::Text, "Random rejection")
+                        .finish();
+  ASSERT_FALSE(text.empty());
+
+  FixMessage message;
+  const auto result = ParseFixMessage(text, message);
+  ASSERT_EQ(result.status, FixParseStatus::Complete) << result.error;
+  EXPECT_EQ(result.length, text.size());
+  EXPECT_EQ(message.type(), "8");
+  EXPECT_EQ(message.get(FixTag::OrderId), "42");
+  EXPECT_EQ(message.get(FixTag::ClOrdId), "B7");
+  EXPECT_EQ(message.get(FixTag::OrderQty), "12.5");
+  EXPECT_EQ(message.get(FixTag::Text), "Random rejection");
+}
+
+TEST(FixMessageTest, Writer_MatchesHandWrittenMessage) {
+  std::array<char, 256> buffer{};
+  const auto text = FixWriter(buffer, "D")
+                        .add(FixTag::ClOrdId, "A1")
+                        .add(FixTag::Side, "1")
+                        .add(FixTag::OrderQty, 10.0)
+                        .add(FixTag::Price, 100.5)
+                        .finish();
+
+  EXPECT_EQ(text, kNewOrder);
+}
+
+TEST(FixMessageTest, Writer_BufferTooSmall_ReturnsEmpty) {
+  std::array<char, 40> buffer{};
+  const auto text = FixWriter(buffer, "8")
+                        .add(FixTag::Text, "a reason much too long to fit")
+                        .finish();
+
+  EXPECT_TRUE(text.empty());
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "common/LatencyHistogram.h"
+
+using namespace std::chrono_literals;
+
+TEST(LatencyHistogramTest, Empty_SummarizesToZero) {
+  LatencyHistogram histogram;
+
+  const auto stats = histogram.summarize();
+  EXPECT_EQ(stats.count, 0);
+  EXPECT_EQ(stats.mean, 0ns);
+  EXPECT_EQ(stats.p99, 0ns);
+  EXPECT_EQ(stats.max, 0ns);
+}
+
+TEST(LatencyHistogramTest, SmallValues_AreExact) {
+  LatencyHistogram histogram;
+  for (int ns = 1; ns <= 10; ++ns) {
+    histogram.record(std::chrono::nanoseconds(ns));
+  }
+
+  EXPECT_EQ(histogram.percentile(0.5), 5ns);
+  EXPECT_EQ(histogram.percentile(1.0), 10ns);
+  EXPECT_EQ(histogram.summarize().mean, 5ns);
+}
+
+TEST(LatencyHistogramTest, Percentiles_WithinBucketPrecision) {
+  LatencyHistogram histogram;
+  for (int us = 1; us <= 1000; ++us) {
+    histogram.record(std::chrono::microseconds(us));
+  }
+
+  const auto stats = histogram.summarize();
+  EXPECT_EQ(stats.count, 1000);
+  EXPECT_EQ(stats.max, 1000us);
+  EXPECT_GE(stats.p50, 500us);
+  EXPECT_LE(stats.p50, 500us * 17 / 16);
+  EXPECT_GE(stats.p99, 990us);
+  EXPECT_LE(stats.p99, 1000us);
+}
+
+TEST(LatencyHistogramTest, Percentile_NeverExceedsMax) {
+  LatencyHistogram histogram;
+  histogram.record(1000ns);
+
+  EXPECT_EQ(histogram.percentile(0.5), 1000ns);
+  EXPECT_EQ(histogram.percentile(0.99), 1000ns);
+}
+
+TEST(LatencyHistogramTest, NegativeLatency_CountsAsZero) {
+  LatencyHistogram histogram;
+  histogram.record(-5ns);
+
+  EXPECT_EQ(histogram.count(), 1);
+  EXPECT_EQ(histogram.summarize().max, 0ns);
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "common/MpscQueue.h"
+#include "common/SpscQueue.h"
+
+namespace {
+
+struct Item {
+  uint32_t producer;
+  uint64_t sequence;
+};
+
+}  // namespace
+
+TEST(MpscQueueTest, Constructor_RoundsCapacityToPowerOfTwo) {
+  MpscQueue<int> queue(5);
+
+  EXPECT_EQ(queue.capacity(), 8);
+  EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(MpscQueueTest, PushPop_FifoOrder) {
+  MpscQueue<int> queue(4);
+
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_TRUE(queue.push(2));
+
+  EXPECT_EQ(queue.pop(), 1);
+  EXPECT_EQ(queue.pop(), 2);
+  EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(MpscQueueTest, Full_PushFailsUntilPopped) {
+  MpscQueue<int> queue(4);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(queue.push(i));
+  }
+
+  EXPECT_FALSE(queue.push(4));
+  EXPECT_EQ(queue.pop(), 0);
+  EXPECT_TRUE(queue.push(4));
+}
+
+TEST(MpscQueueTest, ManyProducers_EachProducerKeepsItsOrder) {
+  constexpr uint32_t kProducers = 8;
+  constexpr uint64_t kItems = 20000;
+  MpscQueue<Item> queue(64);
+
+  std::vector<std::jthread> producers;
+  for (uint32_t p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&queue, p] {
+      for (uint64_t i = 0; i < kItems; ++i) {
+        while (!queue.push({p, i})) std::this_thread::yield();
+      }
+    });
+  }
+
+  std::vector<uint64_t> next(kProducers, 0);
+  uint64_t out_of_order = 0;
+  for (uint64_t received = 0; received < kProducers * kItems;) {
+    if (auto item = queue.pop()) {
+      if (item->sequence != next[item->producer]) ++out_of_order;
+      next[item->producer] = item->sequence + 1;
+      ++received;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  EXPECT_EQ(out_of_order, 0);
+  for (const auto count : next) {
+    EXPECT_EQ(count, kItems);
+  }
+}
+
+TEST(SpscQueueTest, Full_PushFailsUntilPopped) {
+  SpscQueue<int> queue(2);
+
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_TRUE(queue.push(2));
+  EXPECT_FALSE(queue.push(3));
+  EXPECT_EQ(queue.pop(), 1);
+  EXPECT_TRUE(queue.push(3));
+  EXPECT_EQ(queue.pop(), 2);
+  EXPECT_EQ(queue.pop(), 3);
+  EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(SpscQueueTest, TwoThreads_EveryValueInOrder) {
+  constexpr uint64_t kItems = 100000;
+  SpscQueue<uint64_t> queue(16);
+
+  std::jthread producer([&queue] {
+    for (uint64_t i = 0; i < kItems; ++i) {
+      while (!queue.push(i)) std::this_thread::yield();
+    }
+  });
+
+  uint64_t expected = 0;
+  uint64_t out_of_order = 0;
+  while (expected < kItems) {
+    if (auto value = queue.pop()) {
+      if (*value != expected) ++out_of_order;
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  EXPECT_EQ(out_of_order, 0);
+}
@@ -0,0 +1,284 @@
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <format>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "config/Config.h"
+#include "trading/ExchangeApi.h"
+#include "venue/FixMessage.h"
+#include "venue/OrderGateway.h"
+
+namespace {
+
+// Fields of one message from the gateway, copied out of the receive buffer
+struct Reply {
+  std::string type;
+  std::string order_id;
+  std::string cl_ord_id;
+  std::string ord_status;
+  std::string text;
+};
+
+// Blocking test client; gives up on a read after two seconds
+class FixClient {
+ public:
+  explicit FixClient(uint16_t port) : fd_(::socket(AF_INET, SOCK_STREAM, 0)) {
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    const timeval timeout{.tv_sec = 2, .tv_usec = 0};
+    ::setsockopt(fd_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    connected_ = ::connect(fd_, reinterpret_cast<const sockaddr*>(&address),
+                           sizeof(address)) == 0;
+  }
+  ~FixClient() { ::close(fd_); }
+
+  [[nodiscard]] bool connected() const { return connected_; }
+
+  void send(std::string_view bytes) {
+    ASSERT_EQ(::send(fd_, bytes.data(), bytes.size(), MSG_NOSIGNAL),
+              static_cast<ssize_t>(bytes.size()));
+  }
+
+  // Next message, nullopt once the gateway has closed the connection
+  std::optional<Reply> next() {
+    while (true) {
+      FixMessage message;
+      const auto result = ParseFixMessage(buffer_, message);
+      if (result.status == FixParseStatus::Complete) {
+        Reply reply{.type = std::string(message.type()),
+                    .order_id = std::string(message.get(FixTag::OrderId)),
+                    .cl_ord_id = std::string(message.get(FixTag::ClOrdId)),
+                    .ord_status = std::string(message.get(FixTag::OrdStatus)),
+                    .text = std::string(message.get(FixTag::Text))};
+        buffer_.erase(0, result.length);
+        return reply;
+      }
+      if (result.status == FixParseStatus::Invalid) return std::nullopt;
+
+      std::array<char, 4096> chunk{};
+      const ssize_t n = ::recv(fd_, chunk.data(), chunk.size(), 0);
+      if (n <= 0) return std::nullopt;
+      buffer_.append(chunk.data(), static_cast<size_t>(n));
+    }
+  }
+
+ private:
+  int fd_;
+  bool connected_ = false;
+  std::string buffer_;
+};
+
+std::string NewOrder(std::string_view cl_ord_id, std::string_view side = "1",
+                     double quantity = 10.0) {
+  std::array<char, 256> buffer{};
+  return std::string(FixWriter(buffer, "D")
+                         .add(FixTag::ClOrdId, cl_ord_id)
+                         .add(FixTag::Side, side)
+                         .add(FixTag::OrderQty, quantity)
+                         .add(FixTag::Price, 100.0)
+                         .finish());
+}
+
+}  // namespace
+
+// The gateway runs on a thread of the test process, on a free port
+class OrderGatewayTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    config_.gateway_port = 0;
+    config_.rejection_probability = 0;
+    config_.seed = 7;
+  }
+
+  void TearDown() override { StopGateway(); }
+
+  void StartGateway() {
+    auto gateway = OrderGateway::Open(config_);
+    ASSERT_TRUE(gateway.has_value()) << gateway.error();
+    gateway_ = std::move(gateway.value());
+    thread_ =
+        std::jthread([this](std::stop_token stop) { gateway_->Run(stop); });
+  }
+
+  void StopGateway() {
+    thread_ = {};
+    gateway_.reset();
+  }
+
+  Config config_;
+  std::unique_ptr<OrderGateway> gateway_;
+  std::jthread thread_;
+};
+
+TEST_F(OrderGatewayTest, NewOrders_AnsweredInOrderWithExecutionReports) {
+  StartGateway();
+  FixClient client(gateway_->port());
+  ASSERT_TRUE(client.connected());
+
+  client.send(NewOrder("a") + NewOrder("b", "2") + NewOrder("c"));
+
+  for (const auto* id : {"a", "b", "c"}) {
+    auto reply = client.next();
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ(reply->type, "8");
+    EXPECT_EQ(reply->cl_ord_id, id);
+    EXPECT_EQ(reply->ord_status, "2");
+    EXPECT_FALSE(reply->order_id.empty());
+  }
+}
+
+TEST_F(OrderGatewayTest, AllRejected_ReportsReason) {
+  config_.rejection_probability = 100;
+  StartGateway();
+  FixClient client(gateway_->port());
+
+  client.send(NewOrder("a"));
+
+  auto reply = client.next();
+  ASSERT_TRUE(reply.has_value());
+  EXPECT_EQ(reply->ord_status, "8");
+  EXPECT_EQ(reply->text, "Random rejection");
+}
+
+TEST_F(OrderGatewayTest, SameSeed_SameDecisionsAsExchangeApi) {
+  config_.rejection_probability = 50;
+  StartGateway();
+  FixClient client(gateway_->port());
+
+  ExchangeApi reference(config_);
+  std::vector<std::string> expected;
+  std::string orders;
+  for (int i = 0; i < 40; ++i) {
+    reference.sendOrder({OrderSide::Buy, 100.0, 10.0},
+                        [&](OrderIdentifier, Status status, std::string_view) {
+                          expected.push_back(
+                              status == Status::Executed ? "2" : "8");
+                        });
+    orders += NewOrder(std::to_string(i));
+  }
+  reference.poll();
+  client.send(orders);
+
+  for (const auto& status : expected) {
+    auto reply = client.next();
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ(reply->ord_status, status);
+  }
+}
+
+TEST_F(OrderGatewayTest, MessageSplitAcrossWrites_Reassembled) {
+  StartGateway();
+  FixClient client(gateway_->port());
+  const auto order = NewOrder("split");
+
+  client.send(std::string_view(order).substr(0, 20));
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  client.send(std::string_view(order).substr(20));
+
+  auto reply = client.next();
+  ASSERT_TRUE(reply.has_value());
+  EXPECT_EQ(reply->cl_ord_id, "split");
+}
+
+TEST_F(OrderGatewayTest, InvalidSide_RejectedWithoutOrderId) {
+  StartGateway();
+  FixClient client(gateway_->port());
+
+  client.send(NewOrder("bad", "3"));
+
+  auto reply = client.next();
+  ASSERT_TRUE(reply.has_value());
+  EXPECT_EQ(reply->type, "8");
+  EXPECT_EQ(reply->ord_status, "8");
+  EXPECT_EQ(reply->text, "Bad Side");
+  EXPECT_TRUE(reply->order_id.empty());
+}
+
+TEST_F(OrderGatewayTest, UnsupportedType_RejectedAndConnectionKept) {
+  StartGateway();
+  FixClient client(gateway_->port());
+  std::array<char, 128> buffer{};
+  const std::string cancel(
+      FixWriter(buffer, "F").add(FixTag::ClOrdId, "x").finish());
+
+  client.send(cancel + NewOrder("after"));
+
+  auto reject = client.next();
+  ASSERT_TRUE(reject.has_value());
+  EXPECT_EQ(reject->type, "3");
+  EXPECT_EQ(reject->text, "Unsupported MsgType");
+  auto reply = client.next();
+  ASSERT_TRUE(reply.has_value());
+  EXPECT_EQ(reply->cl_ord_id, "after");
+}
+
+TEST_F(OrderGatewayTest, Garbage_RejectedAndClosed) {
+  StartGateway();
+  FixClient client(gateway_->port());
+
+  client.send("GET / HTTP/1.1\r\n\r\n");
+
+  auto reject = client.next();
+  ASSERT_TRUE(reject.has_value());
+  EXPECT_EQ(reject->type, "3");
+  EXPECT_EQ(reject->text, "Bad BeginString");
+  EXPECT_FALSE(client.next().has_value());
+}
+
+TEST_F(OrderGatewayTest, SeveralClients_EachGetsOwnReports) {
+  StartGateway();
+  std::vector<std::unique_ptr<FixClient>> clients;
+  for (int c = 0; c < 4; ++c) {
+    clients.push_back(std::make_unique<FixClient>(gateway_->port()));
+  }
+  for (int i = 0; i < 100; ++i) {
+    for (int c = 0; c < 4; ++c) {
+      clients[c]->send(NewOrder(std::format("{}-{}", c, i)));
+    }
+  }
+
+  for (int c = 0; c < 4; ++c) {
+    for (int i = 0; i < 100; ++i) {
+      auto reply = clients[c]->next();
+      ASSERT_TRUE(reply.has_value());
+      EXPECT_EQ(reply->cl_ord_id, std::format("{}-{}", c, i));
+    }
+  }
+}
+
+TEST_F(OrderGatewayTest, Run_ReturnsOnceLastClientLeaves) {
+  auto gateway = OrderGateway::Open(config_);
+  ASSERT_TRUE(gateway.has_value()) << gateway.error();
+  std::jthread server([&gateway] { gateway.value()->Run(); });
+
+  {
+    FixClient client(gateway.value()->port());
+    client.send(NewOrder("a"));
+    ASSERT_TRUE(client.next().has_value());
+  }
+  server.join();
+
+  EXPECT_EQ(gateway.value()->stats().connections, 1);
+  EXPECT_EQ(gateway.value()->stats().orders, 1);
+}
+
+TEST_F(OrderGatewayTest, PortInUse_OpenFails) {
+  StartGateway();
+  config_.gateway_port = gateway_->port();
+
+  auto second = OrderGateway::Open(config_);
+  ASSERT_FALSE(second.has_value());
+  EXPECT_NE(second.error().find("OrderGateway"), std::string::npos);
+}
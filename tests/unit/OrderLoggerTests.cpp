@@ -5,6 +5,7 @@
 #include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <thread>
 
 #include "config/Config.h"
 #include "logs/OrderLogger.h"
@@ -156,6 +157,17 @@ TEST_F(OrderLoggerTest, WriteOrder_PendingStatus_CorrectString) {
   EXPECT_THAT(content, HasSubstr("Pending"));
 }
 
+TEST_F(OrderLoggerTest, WriteOrder_PartiallyFilledStatus_CorrectString) {
+  Config cfg = CreateTestConfig();
+  OrderLogger logger(cfg);
+
+  logger.writeOrder(OrderSide::Buy, 100.0, 20.0, Status::PartiallyFilled, "",
+                    0.0);
+
+  std::string content = ReadFileContent();
+  EXPECT_THAT(content, HasSubstr(",PartiallyFilled,"));
+}
+
 // ============================================================================
 // writeOrder - Error Text Tests
 // ============================================================================
@@ -314,3 +326,129 @@ TEST_F(OrderLoggerTest, WriteOrder_PositivePnL) {
   std::string content = ReadFileContent();
   EXPECT_THAT(content, HasSubstr("5000.000"));
 }
+
+// ============================================================================
+// Durability Tests
+// ============================================================================
+
+TEST_F(OrderLoggerTest, Durability_None_NoSyncs) {
+  Config cfg = CreateTestConfig();
+  OrderLogger logger(cfg);
+
+  logger.writeOrder(OrderSide::Buy, 100.0, 50.0, Status::Executed, "", 0.0);
+
+  EXPECT_EQ(logger.getSyncStats().syncs, 0);
+}
+
+TEST_F(OrderLoggerTest, Durability_Fsync_SyncsEveryOrder) {
+  Config cfg = CreateTestConfig();
+  cfg.order_log_durability = LogDurability::Fsync;
+  OrderLogger logger(cfg);
+
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_EQ(logger.writeOrder(OrderSide::Buy, 100.0, 50.0,
+                                Status::Executed, "", 0.0),
+              std::nullopt);
+  }
+
+  const auto stats = logger.getSyncStats();
+  EXPECT_EQ(stats.syncs, 5);
+  EXPECT_GT(stats.sync_time, 0ns);
+  EXPECT_EQ(ReadFileLines().size(), 6);
+}
+
+TEST_F(OrderLoggerTest, Durability_Group_CommitsEveryNOrders) {
+  Config cfg = CreateTestConfig();
+  cfg.order_log_durability = LogDurability::Group;
+  cfg.group_commit_orders = 10;
+  cfg.group_commit_interval = 1h;
+  OrderLogger logger(cfg);
+
+  for (int i = 0; i < 9; ++i) {
+    logger.writeOrder(OrderSide::Buy, 100.0, 50.0, Status::Executed, "", 0.0);
+  }
+  EXPECT_EQ(logger.getSyncStats().syncs, 0);
+
+  logger.writeOrder(OrderSide::Sell, 100.0, 50.0, Status::Executed, "", 0.0);
+
+  // The commit is synced on the background thread
+  const auto deadline = std::chrono::steady_clock::now() + 10s;
+  while (logger.getSyncStats().syncs == 0 &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  const auto stats = logger.getSyncStats();
+  EXPECT_EQ(stats.syncs, 1);
+  EXPECT_GE(stats.max_latency, stats.sync_time);
+}
+
+TEST_F(OrderLoggerTest, Durability_Group_IntervalElapsed_Commits) {
+  Config cfg = CreateTestConfig();
+  cfg.order_log_durability = LogDurability::Group;
+  cfg.group_commit_orders = 1000;
+  cfg.group_commit_interval = 20ms;
+  OrderLogger logger(cfg);
+
+  // No further order arrives: the syncer commits on its own
+  logger.writeOrder(OrderSide::Buy, 100.0, 50.0, Status::Executed, "", 0.0);
+
+  const auto deadline = std::chrono::steady_clock::now() + 10s;
+  while (logger.getSyncStats().syncs == 0 &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(logger.getSyncStats().syncs, 1);
+}
+
+TEST_F(OrderLoggerTest, Durability_Group_KeepsEveryLine) {
+  Config cfg = CreateTestConfig();
+  cfg.order_log_durability = LogDurability::Group;
+  cfg.order_log_backend = FileSinkBackend::Pwrite;
+  cfg.group_commit_orders = 7;
+  {
+    OrderLogger logger(cfg);
+    for (int i = 0; i < 100; ++i) {
+      ASSERT_EQ(logger.writeOrder(OrderSide::Buy, 100.0 + i, 50.0,
+                                  Status::Executed, "", 0.0),
+                std::nullopt);
+    }
+  }
+
+  const auto lines = ReadFileLines();
+  ASSERT_EQ(lines.size(), 101);
+  EXPECT_THAT(lines.back(), HasSubstr("199.000"));
+}
+
+TEST_F(OrderLoggerTest, Durability_Group_SaveWritesQueuedLines) {
+  Config cfg = CreateTestConfig();
+  cfg.order_log_durability = LogDurability::Group;
+  cfg.group_commit_orders = 1000;
+  cfg.group_commit_interval = 1h;
+  OrderLogger logger(cfg);
+
+  for (int i = 0; i < 3; ++i) {
+    logger.writeOrder(OrderSide::Buy, 100.0, 50.0, Status::Executed, "", 0.0);
+  }
+  // Lines wait for a commit on the syncer, which a checkpoint forces; the
+  // snapshot's barrier waits until they are durable
+  SnapshotWriter writer;
+  logger.save(writer);
+  auto barriers = writer.takeBarriers();
+  ASSERT_EQ(barriers.size(), 1);
+  EXPECT_FALSE(barriers[0]().has_value());
+
+  EXPECT_EQ(ReadFileLines().size(), 4);
+  EXPECT_EQ(logger.getSyncStats().syncs, 1);
+}
+
+TEST_F(OrderLoggerTest, Durability_None_SaveAddsNoBarrier) {
+  Config cfg = CreateTestConfig();
+  OrderLogger logger(cfg);
+  logger.writeOrder(OrderSide::Buy, 100.0, 50.0, Status::Executed, "", 0.0);
+
+  SnapshotWriter writer;
+  logger.save(writer);
+
+  EXPECT_TRUE(writer.takeBarriers().empty());
+  EXPECT_EQ(ReadFileLines().size(), 2);
+}
@@ -5,6 +5,7 @@
 #include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <vector>
 
 #include "config/Config.h"
 #include "trading/OrderManager.h"
@@ -374,3 +375,471 @@ TEST_F(OrderManagerTest, CompleteTradeRoundTrip) {
   auto lines = ReadOrderLogLines();
   EXPECT_EQ(lines.size(), 3);  // Header + 2 orders
 }
+
+// ============================================================================
+// Performance Summary Tests
+// ============================================================================
+
+TEST_F(OrderManagerTest, Summary_TracksFillsAndMarks) {
+  Config cfg = CreateTestConfig();
+  OrderManager manager(cfg);
+
+  manager.onTick({0ms, 100.0, 1.0});
+  manager.onBuySignal(100.0, 10.0);
+  manager.onTick({100ms, 101.0, 1.0});
+
+  auto summary = manager.getSummary();
+  EXPECT_EQ(summary.ticks, 2);
+  EXPECT_EQ(summary.executed_orders, 1);
+  EXPECT_DOUBLE_EQ(summary.turnover, 1000.0);
+  EXPECT_DOUBLE_EQ(summary.total_pnl, 10.0);
+}
+
+TEST_F(OrderManagerTest, Summary_CountsRejections) {
+  Config cfg = CreateTestConfig();
+  cfg.rejection_probability = 100.0;
+  OrderManager manager(cfg);
+
+  manager.onBuySignal(100.0, 10.0);
+  manager.onSellSignal(100.0, 10.0);
+
+  auto summary = manager.getSummary();
+  EXPECT_EQ(summary.executed_orders, 0);
+  EXPECT_EQ(summary.rejected_orders, 2);
+}
+
+TEST_F(OrderManagerTest, NullLogger_NoOrderFile) {
+  Config cfg = CreateTestConfig();
+  OrderManager<NullOrderLogger> manager(cfg);
+
+  manager.onBuySignal(100.0, 10.0);
+
+  EXPECT_FALSE(fs::exists(temp_dir / "orders.csv"));
+  EXPECT_EQ(manager.getSummary().executed_orders, 1);
+}
+
+// ============================================================================
+// SendOrders Tests
+// ============================================================================
+
+TEST_F(OrderManagerTest, SendOrders_BooksEveryLeg) {
+  Config cfg = CreateTestConfig();
+  OrderManager manager(cfg);
+  const std::vector<Order> basket{{OrderSide::Buy, 100.0, 10.0},
+                                  {OrderSide::Sell, 101.0, 4.0}};
+
+  const OrderIdentifier first_id = manager.SendOrders(basket);
+  manager.onTick({0ms, 100.0, 1.0});
+
+  EXPECT_EQ(first_id, 1);
+  const auto summary = manager.getSummary();
+  EXPECT_EQ(summary.executed_orders, 2);
+  // 6 long at 100 plus 4 * (101 - 100) realized
+  EXPECT_DOUBLE_EQ(summary.total_pnl, 4.0);
+  EXPECT_EQ(ReadOrderLogLines().size(), 3);  // header and two legs
+}
+
+TEST_F(OrderManagerTest, SendOrders_EmptyBasket_ReturnsZero) {
+  Config cfg = CreateTestConfig();
+  OrderManager manager(cfg);
+
+  EXPECT_EQ(manager.SendOrders({}), 0);
+  EXPECT_EQ(manager.SendOrder({OrderSide::Buy, 100.0, 1.0}), 1);
+}
+
+TEST_F(OrderManagerTest, SendOrders_SameResultAsOneByOne) {
+  Config cfg = CreateTestConfig();
+  cfg.rejection_probability = 50.0;
+  cfg.seed = 9;
+  OrderManager<NullOrderLogger> batched(cfg);
+  OrderManager<NullOrderLogger> one_by_one(cfg);
+  std::vector<Order> basket;
+  for (int i = 0; i < 20; ++i) {
+    basket.push_back({i % 2 == 0 ? OrderSide::Buy : OrderSide::Sell,
+                      100.0 + i, 1.0 + i});
+  }
+
+  batched.SendOrders(basket);
+  for (const auto& order : basket) {
+    one_by_one.SendOrder(order);
+  }
+  batched.onTick({0ms, 105.0, 1.0});
+  one_by_one.onTick({0ms, 105.0, 1.0});
+
+  const auto batched_summary = batched.getSummary();
+  const auto one_by_one_summary = one_by_one.getSummary();
+  EXPECT_EQ(batched_summary.executed_orders,
+            one_by_one_summary.executed_orders);
+  EXPECT_EQ(batched_summary.rejected_orders,
+            one_by_one_summary.rejected_orders);
+  EXPECT_DOUBLE_EQ(batched_summary.total_pnl, one_by_one_summary.total_pnl);
+}
+
+// ============================================================================
+// Resting Order Tests
+// ============================================================================
+
+TEST_F(OrderManagerTest, PlaceOrder_BooksEachPartialFill) {
+  Config cfg = CreateTestConfig();
+  OrderManager manager(cfg);
+
+  manager.PlaceOrder({OrderSide::Buy, 100.0, 10.0});
+  manager.onTick({0ms, 100.0, 4.0});
+  EXPECT_DOUBLE_EQ(manager.getSummary().total_pnl, 0.0);
+  manager.onTick({1ms, 102.0, 50.0});  // marks 4 long
+
+  auto summary = manager.getSummary();
+  EXPECT_EQ(summary.executed_orders, 1);
+  EXPECT_EQ(summary.partial_fills, 1);
+  EXPECT_DOUBLE_EQ(summary.total_pnl, 8.0);
+
+  manager.onTick({2ms, 99.0, 50.0});  // the other 6 at the limit, 100
+  summary = manager.getSummary();
+  EXPECT_EQ(summary.executed_orders, 2);
+  EXPECT_DOUBLE_EQ(summary.total_pnl, -10.0);
+  // header, partial fill, fill; the ack is not logged
+  EXPECT_EQ(ReadOrderLogLines().size(), 3);
+}
+
+TEST_F(OrderManagerTest, PlaceOrder_RejectedCountsOnce) {
+  Config cfg = CreateTestConfig();
+  cfg.rejection_probability = 100.0;
+  OrderManager manager(cfg);
+
+  const OrderIdentifier id = manager.PlaceOrder({OrderSide::Buy, 100.0, 1.0});
+
+  EXPECT_EQ(manager.getSummary().rejected_orders, 1);
+  EXPECT_FALSE(manager.CancelOrder(id));
+}
+
+TEST_F(OrderManagerTest, CancelOrder_KeepsFilledPart) {
+  Config cfg = CreateTestConfig();
+  OrderManager manager(cfg);
+
+  const OrderIdentifier id = manager.PlaceOrder({OrderSide::Sell, 100.0, 5.0});
+  manager.onTick({0ms, 100.0, 2.0});
+  EXPECT_TRUE(manager.CancelOrder(id));
+  EXPECT_FALSE(manager.CancelOrder(id));
+  manager.onTick({1ms, 100.0, 50.0});
+
+  // The acknowledgement is not logged
+  const auto lines = ReadOrderLogLines();
+  ASSERT_EQ(lines.size(), 3);
+  EXPECT_NE(lines[1].find("PartiallyFilled"), std::string::npos);
+  EXPECT_NE(lines[2].find("Cancelled"), std::string::npos);
+  const auto summary = manager.getSummary();
+  EXPECT_EQ(summary.partial_fills, 1);
+  EXPECT_EQ(summary.cancelled_orders, 1);
+  EXPECT_DOUBLE_EQ(summary.turnover, 200.0);
+}
+
+TEST_F(OrderManagerTest, ReplaceOrder_RequotesEveryTick) {
+  Config cfg = CreateTestConfig();
+  OrderManager<NullOrderLogger> manager(cfg);
+
+  const OrderIdentifier id = manager.PlaceOrder({OrderSide::Buy, 90.0, 5.0});
+  for (int i = 0; i < 100; ++i) {
+    manager.onTick({std::chrono::milliseconds(i), 100.0 + i, 1.0});
+    EXPECT_TRUE(manager.ReplaceOrder(id, 90.0 + i, 5.0));
+  }
+  manager.onTick({100ms, 150.0, 100.0});
+
+  const auto summary = manager.getSummary();
+  EXPECT_EQ(summary.replaced_orders, 100);
+  EXPECT_EQ(summary.executed_orders, 1);
+  EXPECT_DOUBLE_EQ(summary.turnover, 5.0 * 189.0);
+  EXPECT_FALSE(manager.ReplaceOrder(id, 150.0, 5.0));
+}
+
+TEST_F(OrderManagerTest, PlaceOrder_ExpiresAfterTimeInForce) {
+  Config cfg = CreateTestConfig();
+  OrderManager manager(cfg);
+
+  manager.onTick({10ms, 101.0, 1.0});
+  const OrderIdentifier id =
+      manager.PlaceOrder({OrderSide::Buy, 100.0, 5.0}, 5ms);
+  manager.onTick({14ms, 101.0, 1.0});
+  EXPECT_TRUE(manager.ReplaceOrder(id, 100.0, 6.0));
+  manager.onTick({15ms, 99.0, 100.0});
+
+  const auto summary = manager.getSummary();
+  EXPECT_EQ(summary.expired_orders, 1);
+  EXPECT_EQ(summary.executed_orders, 0);
+  EXPECT_FALSE(manager.CancelOrder(id));
+}
+
+TEST_F(OrderManagerTest, SaveLoad_KeepsRestingOrders) {
+  Config cfg = CreateTestConfig();
+  OrderManager<NullOrderLogger> original(cfg);
+  const OrderIdentifier id = original.PlaceOrder({OrderSide::Buy, 100.0, 5.0});
+  original.onTick({0ms, 100.0, 2.0});
+
+  SnapshotWriter writer;
+  original.save(writer);
+  OrderManager<NullOrderLogger> restored(cfg);
+  SnapshotReader reader(std::move(writer).release());
+  ASSERT_FALSE(restored.load(reader).has_value());
+
+  EXPECT_TRUE(restored.ReplaceOrder(id, 101.0, 6.0));
+  restored.onTick({1ms, 101.0, 50.0});
+  const auto summary = restored.getSummary();
+  EXPECT_EQ(summary.executed_orders, 2);
+  EXPECT_DOUBLE_EQ(summary.turnover, 200.0 + 4.0 * 101.0);
+}
+
+// ============================================================================
+// Risk Check Tests
+// ============================================================================
+
+TEST_F(OrderManagerTest, BuySignal_RoomCountsRestingOrders) {
+  Config cfg = CreateTestConfig();
+  OrderManager manager(cfg);
+
+  manager.PlaceOrder({OrderSide::Buy, 90.0, 900.0});
+  manager.onBuySignal(100.0, 500.0);
+
+  const auto summary = manager.getSummary();
+  EXPECT_DOUBLE_EQ(summary.turnover, 100.0 * 100.0);
+  manager.onBuySignal(100.0, 500.0);
+  EXPECT_DOUBLE_EQ(manager.getSummary().turnover, 100.0 * 100.0);
+}
+
+TEST_F(OrderManagerTest, SendOrder_RefusedByRiskNeverSent) {
+  Config cfg = CreateTestConfig();
+  cfg.max_order_notional = 500.0;
+  OrderManager manager(cfg);
+
+  EXPECT_EQ(manager.SendOrder({OrderSide::Buy, 100.0, 10.0}), 0);
+  EXPECT_EQ(manager.SendOrder({OrderSide::Buy, 100.0, 5.0}), 1);
+
+  const auto summary = manager.getSummary();
+  EXPECT_EQ(summary.executed_orders, 1);
+  EXPECT_EQ(summary.rejected_orders, 0);
+  EXPECT_EQ(summary.risk_notional_refusals, 1);
+  const auto lines = ReadOrderLogLines();
+  ASSERT_EQ(lines.size(), 3);
+  EXPECT_NE(lines[1].find("Rejected,Risk: order notional"),
+            std::string::npos);
+}
+
+TEST_F(OrderManagerTest, SendOrders_RefusedLegDropsBasket) {
+  Config cfg = CreateTestConfig();
+  cfg.max_orders_per_second = 1.0;
+  cfg.order_burst = 2;
+  OrderManager manager(cfg);
+  const std::vector<Order> basket{{OrderSide::Buy, 100.0, 1.0},
+                                  {OrderSide::Sell, 101.0, 1.0},
+                                  {OrderSide::Buy, 100.0, 1.0}};
+
+  EXPECT_EQ(manager.SendOrders(basket), 0);
+  // The refused basket gave its tokens back
+  EXPECT_EQ(manager.SendOrders(std::span(basket).first(2)), 1);
+
+  const auto summary = manager.getSummary();
+  EXPECT_EQ(summary.executed_orders, 2);
+  EXPECT_EQ(summary.risk_rate_refusals, 1);
+}
+
+TEST_F(OrderManagerTest, OrderRate_MeasuredInSimulatedTime) {
+  Config cfg = CreateTestConfig();
+  cfg.max_orders_per_second = 10.0;
+  cfg.order_burst = 1;
+  OrderManager<NullOrderLogger> manager(cfg);
+
+  for (int i = 0; i < 100; ++i) {
+    manager.onTick({std::chrono::milliseconds(50 * i), 100.0, 1.0});
+    manager.SendOrder({OrderSide::Buy, 100.0, 1.0});
+    manager.SendOrder({OrderSide::Sell, 100.0, 1.0});
+  }
+
+  const auto summary = manager.getSummary();
+  // One token per 100ms: every other tick gets an order out
+  EXPECT_EQ(summary.executed_orders, 50);
+  EXPECT_EQ(summary.risk_rate_refusals, 150);
+}
+
+TEST_F(OrderManagerTest, MaxLoss_StopsNewOrders) {
+  Config cfg = CreateTestConfig();
+  cfg.max_loss = 50.0;
+  OrderManager manager(cfg);
+
+  manager.onTick({0ms, 100.0, 1.0});
+  manager.onBuySignal(100.0, 10.0);
+  manager.onTick({1ms, 95.0, 1.0});  // 10 long, 50 down
+  manager.onSellSignal(95.0, 10.0);
+
+  const auto summary = manager.getSummary();
+  EXPECT_TRUE(summary.kill_switch);
+  EXPECT_EQ(summary.risk_loss_refusals, 1);
+  EXPECT_EQ(summary.executed_orders, 1);
+  EXPECT_NE(FormatSummary(summary).find("kill switch tripped"),
+            std::string::npos);
+}
+
+// ============================================================================
+// Netting Tests
+// ============================================================================
+
+TEST_F(OrderManagerTest, FlushIntents_OppositeIntentsCrossInternally) {
+  Config cfg = CreateTestConfig();
+  OrderManager manager(cfg);
+
+  manager.SubmitIntent(0, {OrderSide::Buy, 100.0, 10.0});
+  manager.SubmitIntent(1, {OrderSide::Sell, 100.0, 10.0});
+
+  EXPECT_EQ(manager.FlushIntents(), 0);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(0).position, 10.0);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(0).cash, -1000.0);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(1).position, -10.0);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(1).cash, 1000.0);
+  const auto summary = manager.getSummary();
+  EXPECT_EQ(summary.executed_orders, 0);
+  EXPECT_EQ(summary.crossed_intents, 2);
+  EXPECT_DOUBLE_EQ(summary.crossed_volume, 10.0);
+  EXPECT_EQ(ReadOrderLogLines().size(), 1);  // header only
+  // Nothing reached the exchange
+  EXPECT_EQ(manager.SendOrder({OrderSide::Buy, 100.0, 1.0}), 1);
+}
+
+TEST_F(OrderManagerTest, FlushIntents_SendsOnlyTheResidual) {
+  Config cfg = CreateTestConfig();
+  OrderManager manager(cfg);
+
+  manager.SubmitIntent(0, {OrderSide::Buy, 100.0, 10.0});
+  manager.SubmitIntent(1, {OrderSide::Sell, 102.0, 4.0});
+  manager.SubmitIntent(2, {OrderSide::Sell, 98.0, 1.0});
+
+  EXPECT_EQ(manager.FlushIntents(), 2);
+  manager.onTick({0ms, 100.0, 1.0});
+
+  // 1 at 99 crossed; the sell at 102 is above the buy, so 9 bought at 100
+  // and 4 sold at 102 on the exchange
+  const auto buyer = manager.getStrategyBook(0);
+  EXPECT_DOUBLE_EQ(buyer.position, 10.0);
+  EXPECT_DOUBLE_EQ(buyer.cash, -(99.0 + 9 * 100.0));
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(1).position, -4.0);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(1).cash, 4 * 102.0);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(2).cash, 99.0);
+  const auto summary = manager.getSummary();
+  EXPECT_EQ(summary.intents, 3);
+  EXPECT_EQ(summary.crossed_intents, 1);
+  EXPECT_DOUBLE_EQ(summary.crossed_volume, 1.0);
+  EXPECT_EQ(summary.executed_orders, 2);
+  EXPECT_DOUBLE_EQ(summary.total_pnl, 8.0);  // 4 sold 2 above the mark
+  EXPECT_EQ(ReadOrderLogLines().size(), 3);
+}
+
+TEST_F(OrderManagerTest, FlushIntents_SellAboveBuy_NotCrossed) {
+  Config cfg = CreateTestConfig();
+  OrderManager manager(cfg);
+
+  manager.SubmitIntent(0, {OrderSide::Buy, 100.0, 5.0});
+  manager.SubmitIntent(1, {OrderSide::Sell, 101.0, 5.0});
+
+  EXPECT_EQ(manager.FlushIntents(), 2);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(0).position, 5.0);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(0).cash, -500.0);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(1).position, -5.0);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(1).cash, 505.0);
+  const auto summary = manager.getSummary();
+  EXPECT_EQ(summary.crossed_intents, 0);
+  EXPECT_DOUBLE_EQ(summary.crossed_volume, 0.0);
+  EXPECT_EQ(summary.executed_orders, 2);
+}
+
+TEST_F(OrderManagerTest, FlushIntents_SameStrategy_NotCrossed) {
+  Config cfg = CreateTestConfig();
+  OrderManager manager(cfg);
+
+  manager.SubmitIntent(0, {OrderSide::Buy, 100.0, 5.0});
+  manager.SubmitIntent(0, {OrderSide::Sell, 99.0, 5.0});
+
+  EXPECT_EQ(manager.FlushIntents(), 2);
+  const auto summary = manager.getSummary();
+  EXPECT_EQ(summary.crossed_intents, 0);
+  EXPECT_DOUBLE_EQ(summary.crossed_volume, 0.0);
+  EXPECT_EQ(summary.executed_orders, 2);
+}
+
+TEST_F(OrderManagerTest, FlushIntents_RefusedLegKeepsOtherStrategies) {
+  Config cfg = CreateTestConfig();
+  cfg.max_position = 5.0;
+  OrderManager manager(cfg);
+
+  manager.SubmitIntent(0, {OrderSide::Buy, 100.0, 10.0});
+  manager.SubmitIntent(1, {OrderSide::Sell, 101.0, 3.0});
+
+  EXPECT_EQ(manager.FlushIntents(), 1);
+  EXPECT_EQ(manager.getStrategyBook(0).refused, 1);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(0).position, 0.0);
+  EXPECT_EQ(manager.getStrategyBook(1).refused, 0);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(1).position, -3.0);
+  const auto summary = manager.getSummary();
+  EXPECT_EQ(summary.risk_position_refusals, 1);
+  EXPECT_EQ(summary.executed_orders, 1);
+  EXPECT_EQ(ReadOrderLogLines().size(), 3);  // the refusal and the fill
+}
+
+TEST_F(OrderManagerTest, FlushIntents_StrategyPnLAddsUpToFirm) {
+  Config cfg = CreateTestConfig();
+  cfg.rejection_probability = 30.0;
+  cfg.seed = 5;
+  OrderManager<NullOrderLogger> manager(cfg);
+
+  for (int tick = 0; tick < 50; ++tick) {
+    const Price price = 100.0 + tick % 7;
+    manager.onTick({std::chrono::milliseconds(tick), price, 1.0});
+    for (uint32_t strategy = 0; strategy < 4; ++strategy) {
+      const bool buy = (tick + strategy * 3) % 5 < 2;
+      manager.SubmitIntent(strategy, {buy ? OrderSide::Buy : OrderSide::Sell,
+                                      price + strategy * 0.1,
+                                      1.0 + strategy});
+    }
+    manager.FlushIntents();
+  }
+  manager.onTick({50ms, 103.0, 1.0});
+
+  Price strategies_pnl = 0;
+  for (uint32_t strategy = 0; strategy < 4; ++strategy) {
+    const auto book = manager.getStrategyBook(strategy);
+    strategies_pnl += book.cash + book.position * 103.0;
+  }
+  EXPECT_NEAR(strategies_pnl, manager.getSummary().total_pnl, 1e-6);
+  EXPECT_GT(manager.getSummary().crossed_intents, 0);
+}
+
+TEST_F(OrderManagerTest, FlushIntents_RejectedResidualNotBooked) {
+  Config cfg = CreateTestConfig();
+  cfg.rejection_probability = 100.0;
+  OrderManager manager(cfg);
+
+  manager.SubmitIntent(0, {OrderSide::Buy, 100.0, 3.0});
+  manager.SubmitIntent(1, {OrderSide::Buy, 100.0, 2.0});
+  manager.SubmitIntent(2, {OrderSide::Sell, 100.0, 4.0});
+  EXPECT_EQ(manager.FlushIntents(), 1);
+
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(0).position, 3.0);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(1).position, 1.0);
+  EXPECT_DOUBLE_EQ(manager.getStrategyBook(2).position, -4.0);
+  EXPECT_EQ(manager.getSummary().rejected_orders, 1);
+}
+
+TEST_F(OrderManagerTest, SaveLoad_KeepsIntentsAndBooks) {
+  Config cfg = CreateTestConfig();
+  OrderManager<NullOrderLogger> original(cfg);
+  original.SubmitIntent(0, {OrderSide::Buy, 100.0, 5.0});
+  original.SubmitIntent(1, {OrderSide::Sell, 100.0, 5.0});
+  original.FlushIntents();
+  original.SubmitIntent(1, {OrderSide::Buy, 100.0, 2.0});
+
+  SnapshotWriter writer;
+  original.save(writer);
+  OrderManager<NullOrderLogger> restored(cfg);
+  SnapshotReader reader(std::move(writer).release());
+  ASSERT_FALSE(restored.load(reader).has_value());
+
+  EXPECT_EQ(restored.FlushIntents(), 1);
+  EXPECT_DOUBLE_EQ(restored.getStrategyBook(0).position, 5.0);
+  EXPECT_DOUBLE_EQ(restored.getStrategyBook(1).position, -3.0);
+  EXPECT_EQ(restored.getSummary().intents, 3);
+}
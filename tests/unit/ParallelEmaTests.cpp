@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "backtest/ParallelEma.h"
+#include "trading/TimeEMA.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+std::vector<Tick> RandomTicks(size_t count, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dt(50, 200);
+  std::normal_distribution<double> move(0.0, 0.2);
+
+  std::vector<Tick> ticks(count);
+  Tick tick{0ns, 100.0, 1.0};
+  for (auto& t : ticks) {
+    tick.timestamp += std::chrono::milliseconds(dt(gen));
+    tick.price += move(gen);
+    t = tick;
+  }
+  return ticks;
+}
+
+std::vector<Price> SequentialEma(const std::vector<Tick>& ticks,
+                                 std::chrono::nanoseconds period) {
+  TimeEMA ema(period);
+  std::vector<Price> result;
+  for (const auto& tick : ticks) result.push_back(ema.update(tick));
+  return result;
+}
+
+}  // namespace
+
+// ============================================================================
+// SplitRange
+// ============================================================================
+
+TEST(ParallelEmaTest, SplitRange_CoversWholeRange) {
+  auto ranges = SplitRange(10, 3);
+
+  ASSERT_EQ(ranges.size(), 3);
+  EXPECT_EQ(ranges.front().first, 0);
+  EXPECT_EQ(ranges.back().second, 10);
+  for (size_t r = 1; r < ranges.size(); ++r) {
+    EXPECT_EQ(ranges[r].first, ranges[r - 1].second);
+  }
+}
+
+TEST(ParallelEmaTest, SplitRange_MorePartsThanElements) {
+  EXPECT_EQ(SplitRange(2, 8).size(), 2);
+  EXPECT_EQ(SplitRange(0, 8).size(), 1);
+}
+
+// ============================================================================
+// ParallelTimeEMA
+// ============================================================================
+
+TEST(ParallelEmaTest, SingleThread_MatchesTimeEMAExactly) {
+  auto ticks = RandomTicks(1000, 1);
+
+  auto expected = SequentialEma(ticks, 1s);
+  auto actual = ParallelTimeEMA(ticks, 1s, 1);
+
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < ticks.size(); ++i) {
+    ASSERT_EQ(actual[i], expected[i]) << "tick " << i;
+  }
+}
+
+TEST(ParallelEmaTest, ManyThreads_MatchesTimeEMAWithinTolerance) {
+  auto ticks = RandomTicks(100000, 2);
+
+  for (size_t threads : {2, 3, 8, 16}) {
+    auto expected = SequentialEma(ticks, 5s);
+    auto actual = ParallelTimeEMA(ticks, 5s, threads);
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < ticks.size(); ++i) {
+      ASSERT_NEAR(actual[i], expected[i], 1e-9 * expected[i])
+          << "tick " << i << ", threads " << threads;
+    }
+  }
+}
+
+TEST(ParallelEmaTest, RepeatedTimestamps_LeaveAverageUnchanged) {
+  std::vector<Tick> ticks = {
+      {0ms, 100.0, 1.0}, {100ms, 110.0, 1.0}, {100ms, 500.0, 1.0}};
+
+  auto expected = SequentialEma(ticks, 1s);
+  auto actual = ParallelTimeEMA(ticks, 1s, 3);
+
+  EXPECT_DOUBLE_EQ(actual[2], expected[2]);
+  EXPECT_DOUBLE_EQ(actual[2], actual[1]);
+}
+
+TEST(ParallelEmaTest, Empty_ReturnsEmpty) {
+  EXPECT_TRUE(ParallelTimeEMA({}, 1s, 4).empty());
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "simulation/PathGenerator.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+Config CreateTestConfig() {
+  Config cfg;
+  cfg.initial_price = 100.0;
+  cfg.average_trend_value = 0.05;
+  cfg.price_variation = 0.2;
+  cfg.time_horizon = 24h;
+  cfg.min_diff_time = 100ms;
+  cfg.max_diff_time = 200ms;
+  cfg.min_volume = 10.0;
+  cfg.max_volume = 100.0;
+  return cfg;
+}
+
+std::vector<Tick> Generate(size_t count, size_t threads,
+                           const std::vector<size_t>& batches = {}) {
+  PathGenerator generator(CreateTestConfig(), 17);
+  std::vector<Tick> ticks(count);
+  size_t done = 0;
+  for (size_t batch : batches) {
+    generator.generate(std::span(ticks).subspan(done, batch), threads);
+    done += batch;
+  }
+  generator.generate(std::span(ticks).subspan(done), threads);
+  return ticks;
+}
+
+void ExpectIdentical(const std::vector<Tick>& a, const std::vector<Tick>& b) {
+  ASSERT_EQ(a.size(), b.size());
+  for (size_t i = 0; i < a.size(); ++i) {
+    ASSERT_EQ(a[i].timestamp, b[i].timestamp) << "tick " << i;
+    ASSERT_EQ(a[i].price, b[i].price) << "tick " << i;
+    ASSERT_EQ(a[i].volume, b[i].volume) << "tick " << i;
+  }
+}
+
+}  // namespace
+
+TEST(PathGeneratorTest, Generate_BitIdenticalForAnyThreadCount) {
+  const size_t count = 5 * PathGenerator::kBlockSize + 123;
+  auto serial = Generate(count, 1);
+
+  for (size_t threads : {2, 3, 8}) {
+    ExpectIdentical(Generate(count, threads), serial);
+  }
+}
+
+TEST(PathGeneratorTest, Generate_BitIdenticalForAnyBatchSplit) {
+  const size_t count = 3 * PathGenerator::kBlockSize + 7;
+  auto whole = Generate(count, 1);
+
+  ExpectIdentical(Generate(count, 1, {1, 4095, 1, 5000}), whole);
+  ExpectIdentical(Generate(count, 4, {PathGenerator::kBlockSize, 10}), whole);
+}
+
+TEST(PathGeneratorTest, Generate_RespectsConfigRanges) {
+  auto ticks = Generate(10000, 2);
+
+  auto previous = 0ns;
+  for (const auto& tick : ticks) {
+    EXPECT_GE(tick.timestamp - previous, 100ms);
+    EXPECT_LE(tick.timestamp - previous, 200ms);
+    EXPECT_GE(tick.volume, 10.0);
+    EXPECT_LT(tick.volume, 100.0);
+    EXPECT_GT(tick.price, 0.0);
+    previous = tick.timestamp;
+  }
+}
+
+TEST(PathGeneratorTest, Generate_LogReturnsHaveGbmMoments) {
+  Config cfg = CreateTestConfig();
+  cfg.price_variation = 1.0;
+  cfg.average_trend_value = 0.5;  // zero log drift, so prices stay finite
+  cfg.min_diff_time = cfg.max_diff_time = 1h;
+  PathGenerator generator(cfg, 3);
+  std::vector<Tick> ticks(200000);
+  generator.generate(ticks, 4);
+
+  double sum = 0;
+  double sum_sq = 0;
+  Price previous = cfg.initial_price;
+  for (const auto& tick : ticks) {
+    double r = std::log(tick.price / previous);
+    sum += r;
+    sum_sq += r * r;
+    previous = tick.price;
+  }
+  const double n = static_cast<double>(ticks.size());
+  const double t = 1.0 / 24.0;
+  const double mean = sum / n;
+  const double variance = sum_sq / n - mean * mean;
+
+  EXPECT_NEAR(mean, 0.0, 0.002);
+  EXPECT_NEAR(variance, t, t * 0.02);
+}
+
+TEST(PathGeneratorTest, SaveLoad_ContinuesIdentically) {
+  auto whole = Generate(1000, 1);
+
+  PathGenerator first(CreateTestConfig(), 17);
+  std::vector<Tick> ticks(1000);
+  first.generate(std::span(ticks).first(600), 1);
+  SnapshotWriter writer;
+  first.save(writer);
+
+  PathGenerator second(CreateTestConfig(), 99);
+  SnapshotReader reader(std::move(writer).release());
+  second.load(reader);
+  second.generate(std::span(ticks).subspan(600), 2);
+
+  ExpectIdentical(ticks, whole);
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+
+#include "trading/PerformanceStats.h"
+
+using namespace std::chrono_literals;
+
+// ============================================================================
+// Empty State Tests
+// ============================================================================
+
+TEST(PerformanceStatsTest, NoEvents_ZeroSummary) {
+  PerformanceStats stats;
+
+  auto summary = stats.getSummary();
+
+  EXPECT_EQ(summary.ticks, 0);
+  EXPECT_DOUBLE_EQ(summary.total_pnl, 0.0);
+  EXPECT_DOUBLE_EQ(summary.sharpe, 0.0);
+  EXPECT_DOUBLE_EQ(summary.max_drawdown, 0.0);
+}
+
+// ============================================================================
+// Return Statistics Tests
+// ============================================================================
+
+TEST(PerformanceStatsTest, Returns_WelfordMatchesTwoPassStatistics) {
+  PerformanceStats stats;
+  const double prices[] = {100.0, 101.0, 99.5, 102.0, 101.0, 103.5};
+
+  stats.onTick(0ms, prices[0]);
+  stats.onFill(OrderSide::Buy, prices[0], 2.0);
+  for (int i = 1; i < 6; ++i) {
+    stats.onTick(std::chrono::milliseconds(i * 100), prices[i]);
+  }
+
+  double returns[5];
+  double mean = 0;
+  for (int i = 0; i < 5; ++i) {
+    returns[i] = 2.0 * (prices[i + 1] - prices[i]);
+    mean += returns[i] / 5.0;
+  }
+  double variance = 0;
+  for (double r : returns) {
+    variance += (r - mean) * (r - mean) / 4.0;
+  }
+
+  auto summary = stats.getSummary();
+  EXPECT_EQ(summary.ticks, 6);
+  EXPECT_NEAR(summary.mean_return, mean, 1e-12);
+  EXPECT_NEAR(summary.return_stddev, std::sqrt(variance), 1e-12);
+  EXPECT_NEAR(summary.sharpe, mean / std::sqrt(variance), 1e-12);
+  EXPECT_NEAR(summary.total_pnl, 2.0 * (103.5 - 100.0), 1e-12);
+}
+
+TEST(PerformanceStatsTest, MaxDrawdown_PeakToTrough) {
+  PerformanceStats stats;
+  stats.onTick(0ms, 100.0);
+  stats.onFill(OrderSide::Buy, 100.0, 1.0);
+
+  stats.onTick(100ms, 110.0);  // peak equity +10
+  stats.onTick(200ms, 95.0);   // trough equity -5
+  stats.onTick(300ms, 105.0);
+
+  EXPECT_DOUBLE_EQ(stats.getSummary().max_drawdown, 15.0);
+}
+
+// ============================================================================
+// Trade Statistics Tests
+// ============================================================================
+
+TEST(PerformanceStatsTest, WinLoss_CountedOnClosingFills) {
+  PerformanceStats stats;
+
+  stats.onFill(OrderSide::Buy, 100.0, 10.0);
+  stats.onFill(OrderSide::Sell, 105.0, 10.0);  // win
+  stats.onFill(OrderSide::Sell, 105.0, 5.0);   // opens short
+  stats.onFill(OrderSide::Buy, 110.0, 5.0);    // loss
+  stats.onFill(OrderSide::Buy, 100.0, 4.0);
+  stats.onFill(OrderSide::Sell, 90.0, 2.0);    // loss
+
+  auto summary = stats.getSummary();
+  EXPECT_EQ(summary.executed_orders, 6);
+  EXPECT_EQ(summary.winning_trades, 1);
+  EXPECT_EQ(summary.losing_trades, 2);
+  EXPECT_DOUBLE_EQ(summary.win_loss_ratio, 0.5);
+}
+
+TEST(PerformanceStatsTest, FlipThroughZero_RemainderUsesFillPrice) {
+  PerformanceStats stats;
+
+  stats.onFill(OrderSide::Buy, 100.0, 10.0);
+  stats.onFill(OrderSide::Sell, 110.0, 15.0);  // closes long (win), short 5
+  stats.onFill(OrderSide::Buy, 105.0, 5.0);    // short from 110 -> win
+
+  EXPECT_EQ(stats.getSummary().winning_trades, 2);
+  EXPECT_EQ(stats.getSummary().losing_trades, 0);
+}
+
+TEST(PerformanceStatsTest, Turnover_SumsTradedNotional) {
+  PerformanceStats stats;
+
+  stats.onFill(OrderSide::Buy, 100.0, 10.0);
+  stats.onFill(OrderSide::Sell, 50.0, 4.0);
+  stats.onReject();
+
+  auto summary = stats.getSummary();
+  EXPECT_DOUBLE_EQ(summary.turnover, 1200.0);
+  EXPECT_EQ(summary.rejected_orders, 1);
+}
+
+TEST(PerformanceStatsTest, TimeInMarket_FractionOfElapsedTime) {
+  PerformanceStats stats;
+
+  stats.onTick(0ms, 100.0);
+  stats.onTick(100ms, 100.0);
+  stats.onFill(OrderSide::Buy, 100.0, 1.0);
+  stats.onTick(400ms, 100.0);  // held for 300ms
+  stats.onFill(OrderSide::Sell, 100.0, 1.0);
+  stats.onTick(1000ms, 100.0);
+
+  EXPECT_NEAR(stats.getSummary().time_in_market, 0.3, 1e-12);
+}
+
+// ============================================================================
+// Snapshot Tests
+// ============================================================================
+
+TEST(PerformanceStatsTest, SaveLoad_RestoresAccumulators) {
+  PerformanceStats stats;
+  stats.onTick(0ms, 100.0);
+  stats.onFill(OrderSide::Buy, 100.0, 3.0);
+  stats.onTick(100ms, 102.0);
+  stats.onTick(250ms, 99.0);
+
+  SnapshotWriter writer;
+  stats.save(writer);
+  PerformanceStats restored;
+  SnapshotReader reader(writer.data());
+  restored.load(reader);
+  ASSERT_TRUE(reader.ok() && reader.atEnd());
+
+  stats.onTick(300ms, 104.0);
+  restored.onTick(300ms, 104.0);
+
+  auto expected = stats.getSummary();
+  auto actual = restored.getSummary();
+  EXPECT_EQ(actual.ticks, expected.ticks);
+  EXPECT_DOUBLE_EQ(actual.sharpe, expected.sharpe);
+  EXPECT_DOUBLE_EQ(actual.max_drawdown, expected.max_drawdown);
+  EXPECT_DOUBLE_EQ(actual.time_in_market, expected.time_in_market);
+}
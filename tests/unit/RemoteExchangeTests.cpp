@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <format>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "config/Config.h"
+#include "simulation/Simulator.h"
+#include "trading/ExchangeApi.h"
+#include "venue/ExchangeServer.h"
+#include "venue/RemoteExchange.h"
+#include "venue/VenueChannel.h"
+
+// The venue runs on a thread of the test process; the protocol and the
+// shared-memory rings are the same as across processes.
+class RemoteExchangeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+    config_.venue_name =
+        std::format("tsim_test_{}_{}", ::getpid(), info->name());
+    config_.venue_capacity = 8;
+    config_.rejection_probability = 0;
+    config_.seed = 7;
+  }
+
+  void StartVenue() {
+    auto server = ExchangeServer::Open(config_);
+    ASSERT_TRUE(server.has_value()) << server.error();
+    server_ = std::move(server.value());
+    venue_ =
+        std::jthread([this](std::stop_token stop) { server_->Run(stop); });
+  }
+
+  void StopVenue() {
+    venue_ = {};
+    server_.reset();
+  }
+
+  struct Reply {
+    OrderIdentifier id;
+    Status status;
+    std::string error;
+  };
+
+  ExchangeCallback Record() {
+    return [this](OrderIdentifier id, Status status, std::string_view error) {
+      replies_.push_back({id, status, std::string(error)});
+    };
+  }
+
+  Config config_;
+  std::unique_ptr<ExchangeServer> server_;
+  std::jthread venue_;
+  std::vector<Reply> replies_;
+};
+
+TEST_F(RemoteExchangeTest, NoVenue_ConstructorThrows) {
+  EXPECT_THROW(RemoteExchange exchange(config_), std::runtime_error);
+}
+
+TEST_F(RemoteExchangeTest, Order_FilledAfterPoll) {
+  StartVenue();
+  RemoteExchange exchange(config_);
+
+  const auto id =
+      exchange.sendOrder({OrderSide::Buy, 100.0, 10.0}, Record());
+  exchange.poll();
+
+  ASSERT_EQ(replies_.size(), 1);
+  EXPECT_EQ(replies_[0].id, id);
+  EXPECT_EQ(replies_[0].status, Status::Executed);
+  EXPECT_EQ(exchange.getRoundTripStats().count, 1);
+  EXPECT_GT(exchange.getRoundTripStats().max.count(), 0);
+}
+
+TEST_F(RemoteExchangeTest, SecondVenue_FailsAndLeavesFirstServing) {
+  StartVenue();
+  RemoteExchange exchange(config_);
+
+  auto second = ExchangeServer::Open(config_);
+  ASSERT_FALSE(second.has_value());
+  EXPECT_NE(second.error().find("already exists"), std::string::npos);
+
+  exchange.sendOrder({OrderSide::Buy, 100.0, 10.0}, Record());
+  exchange.poll();
+  ASSERT_EQ(replies_.size(), 1);
+  EXPECT_EQ(replies_[0].status, Status::Executed);
+}
+
+TEST_F(RemoteExchangeTest, FullRejection_RejectsEveryOrder) {
+  config_.rejection_probability = 100;
+  StartVenue();
+  RemoteExchange exchange(config_);
+
+  exchange.sendOrder({OrderSide::Sell, 100.0, 10.0}, Record());
+  exchange.poll();
+
+  ASSERT_EQ(replies_.size(), 1);
+  EXPECT_EQ(replies_[0].status, Status::Rejected);
+  EXPECT_EQ(replies_[0].error, "Random rejection");
+}
+
+TEST_F(RemoteExchangeTest, SameSeed_DecidesLikeExchangeApi) {
+  config_.rejection_probability = 50;
+  StartVenue();
+  RemoteExchange remote(config_);
+  ExchangeApi local(config_);
+
+  std::vector<Status> expected;
+  for (int i = 0; i < 100; ++i) {
+    local.sendOrder({OrderSide::Buy, 100.0, 1.0},
+                    [&](OrderIdentifier, Status status, std::string_view) {
+                      expected.push_back(status);
+                    });
+    local.poll();
+    remote.sendOrder({OrderSide::Buy, 100.0, 1.0}, Record());
+    remote.poll();
+  }
+
+  ASSERT_EQ(replies_.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(replies_[i].status, expected[i]) << "order " << i;
+  }
+}
+
+TEST_F(RemoteExchangeTest, MoreOrdersThanRingCapacity_AllAnswered) {
+  StartVenue();
+  RemoteExchange exchange(config_);
+
+  for (int i = 0; i < 100; ++i) {
+    exchange.sendOrder({OrderSide::Buy, 100.0 + i, 1.0}, Record());
+  }
+  exchange.poll();
+
+  ASSERT_EQ(replies_.size(), 100);
+  for (size_t i = 0; i < replies_.size(); ++i) {
+    EXPECT_EQ(replies_[i].id, i + 1);
+  }
+  EXPECT_EQ(server_->orders(), 100);
+}
+
+TEST_F(RemoteExchangeTest, SendOrders_BasketAnsweredByOnePoll) {
+  StartVenue();
+  RemoteExchange exchange(config_);
+  const std::vector<Order> basket(20, Order{OrderSide::Buy, 100.0, 1.0});
+
+  const auto first_id = exchange.sendOrders(basket, Record());
+  exchange.poll();
+
+  ASSERT_EQ(replies_.size(), basket.size());
+  for (size_t i = 0; i < replies_.size(); ++i) {
+    EXPECT_EQ(replies_[i].id, first_id + i);
+  }
+}
+
+TEST_F(RemoteExchangeTest, CancelAfterDecision_IsIgnored) {
+  StartVenue();
+  RemoteExchange exchange(config_);
+
+  const auto id = exchange.sendOrder({OrderSide::Buy, 100.0, 1.0}, Record());
+  exchange.cancelOrder(id);
+  exchange.poll();
+  exchange.sendOrder({OrderSide::Buy, 100.0, 1.0}, Record());
+  exchange.poll();
+
+  ASSERT_EQ(replies_.size(), 2);
+  EXPECT_EQ(replies_[0].status, Status::Executed);
+  EXPECT_EQ(replies_[1].status, Status::Executed);
+}
+
+TEST_F(RemoteExchangeTest, VenueShutdown_RejectsOrdersInFlight) {
+  StartVenue();
+  RemoteExchange exchange(config_);
+  StopVenue();
+
+  exchange.sendOrder({OrderSide::Buy, 100.0, 1.0}, Record());
+  exchange.poll();
+
+  ASSERT_EQ(replies_.size(), 1);
+  EXPECT_EQ(replies_[0].status, Status::Rejected);
+  EXPECT_EQ(replies_[0].error, "Exchange disconnected");
+}
+
+TEST_F(RemoteExchangeTest, ClientDetach_StopsVenue) {
+  auto server = ExchangeServer::Open(config_);
+  ASSERT_TRUE(server.has_value()) << server.error();
+  {
+    RemoteExchange exchange(config_);
+    exchange.sendOrder({OrderSide::Buy, 100.0, 1.0}, Record());
+  }
+
+  server.value()->Run();  // returns once the detached client is answered
+  EXPECT_EQ(server.value()->orders(), 1);
+}
+
+TEST_F(RemoteExchangeTest, Simulation_MatchesInProcessExchange) {
+  config_.rejection_probability = 20;
+  config_.metrics_only = true;
+  config_.steps_count = 2000;
+  config_.fast_ema = 1s;
+  config_.slow_ema = 5s;
+  StartVenue();
+
+  RemoteMetricsOnlySimulator remote(config_);
+  remote.Run();
+  MetricsOnlySimulator local(config_);
+  local.Run();
+
+  const auto remote_summary = remote.getSummary();
+  const auto local_summary = local.getSummary();
+  EXPECT_GT(remote_summary.executed_orders, 0);
+  EXPECT_EQ(remote_summary.executed_orders, local_summary.executed_orders);
+  EXPECT_EQ(remote_summary.rejected_orders, local_summary.rejected_orders);
+  EXPECT_DOUBLE_EQ(remote_summary.total_pnl, local_summary.total_pnl);
+  EXPECT_EQ(remote_summary.round_trips,
+            remote_summary.executed_orders + remote_summary.rejected_orders);
+  EXPECT_EQ(local_summary.round_trips, 0);
+}
+
+TEST_F(RemoteExchangeTest, Channel_NotPowerOfTwoCapacity_Fails) {
+  auto channel = VenueChannel::Create(config_.venue_name, 6);
+
+  ASSERT_FALSE(channel.has_value());
+  EXPECT_NE(channel.error().find("power of two"), std::string::npos);
+}
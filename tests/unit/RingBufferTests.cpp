@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "common/RingBuffer.h"
+
+using namespace std::chrono_literals;
+
+// ============================================================================
+// Queue Operations
+// ============================================================================
+
+TEST(RingBufferTest, Constructor_RoundsCapacityToPowerOfTwo) {
+  RingBuffer<int> buffer(5);
+
+  EXPECT_EQ(buffer.capacity(), 8);
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(RingBufferTest, PushPop_FifoOrder) {
+  RingBuffer<int> buffer(4);
+
+  buffer.push_back(1);
+  buffer.push_back(2);
+  buffer.push_back(3);
+  buffer.pop_front();
+
+  EXPECT_EQ(buffer.size(), 2);
+  EXPECT_EQ(buffer.front(), 2);
+  EXPECT_EQ(buffer.back(), 3);
+}
+
+TEST(RingBufferTest, PopBack_RemovesNewest) {
+  RingBuffer<int> buffer(4);
+
+  buffer.push_back(1);
+  buffer.push_back(2);
+  buffer.pop_back();
+
+  EXPECT_EQ(buffer.size(), 1);
+  EXPECT_EQ(buffer.back(), 1);
+}
+
+TEST(RingBufferTest, WrapAround_KeepsOrder) {
+  RingBuffer<int> buffer(4);
+
+  for (int i = 0; i < 10; ++i) {
+    buffer.push_back(i);
+    if (buffer.size() > 3) buffer.pop_front();
+  }
+
+  EXPECT_EQ(buffer.capacity(), 4);
+  EXPECT_EQ(buffer[0], 7);
+  EXPECT_EQ(buffer[1], 8);
+  EXPECT_EQ(buffer[2], 9);
+}
+
+TEST(RingBufferTest, Overflow_GrowsAndKeepsOrder) {
+  RingBuffer<int> buffer(2);
+  buffer.push_back(0);
+  buffer.push_back(1);
+  buffer.pop_front();  // head no longer at slot 0
+
+  for (int i = 2; i < 6; ++i) buffer.push_back(i);
+
+  EXPECT_EQ(buffer.capacity(), 8);
+  ASSERT_EQ(buffer.size(), 5);
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    EXPECT_EQ(buffer[i], static_cast<int>(i) + 1);
+  }
+}
+
+TEST(RingBufferTest, SaveLoad_RestoresContents) {
+  RingBuffer<double> buffer(4);
+  buffer.push_back(1.5);
+  buffer.push_back(2.5);
+
+  SnapshotWriter writer;
+  buffer.save(writer);
+  RingBuffer<double> restored(4);
+  restored.push_back(9.0);
+  SnapshotReader reader(std::move(writer).release());
+  restored.load(reader);
+
+  ASSERT_EQ(restored.size(), 2);
+  EXPECT_DOUBLE_EQ(restored.front(), 1.5);
+  EXPECT_DOUBLE_EQ(restored.back(), 2.5);
+  EXPECT_TRUE(reader.atEnd());
+}
+
+// ============================================================================
+// WindowCapacity
+// ============================================================================
+
+TEST(RingBufferTest, WindowCapacity_CoversWindowAtMinInterval) {
+  EXPECT_EQ(WindowCapacity(1s, 100ms), 11);
+  EXPECT_EQ(WindowCapacity(1s, 300ms), 4);
+  EXPECT_EQ(WindowCapacity(1s, 0ns), 2);
+}
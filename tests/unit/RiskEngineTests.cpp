@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "config/Config.h"
+#include "trading/RiskEngine.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+Config RiskConfig() {
+  Config config;
+  config.min_position = -100.0;
+  config.max_position = 100.0;
+  return config;
+}
+
+}  // namespace
+
+// ============================================================================
+// Position Tests
+// ============================================================================
+
+TEST(RiskEngineTest, DefaultLimits_OnlyPositionChecked) {
+  RiskEngine risk(RiskConfig());
+
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(risk.check({OrderSide::Buy, 1e9, 0.01}, 0ns), RiskReason::None);
+    risk.onSent(OrderSide::Buy, 0.01);
+    risk.onDone(OrderSide::Buy, 0.01);
+  }
+  EXPECT_EQ(risk.check({OrderSide::Buy, 100.0, 101.0}, 0ns),
+            RiskReason::Position);
+}
+
+TEST(RiskEngineTest, Position_CountsOpenOrders) {
+  RiskEngine risk(RiskConfig());
+
+  ASSERT_EQ(risk.check({OrderSide::Buy, 100.0, 60.0}, 0ns), RiskReason::None);
+  risk.onSent(OrderSide::Buy, 60.0);
+
+  EXPECT_EQ(risk.check({OrderSide::Buy, 100.0, 60.0}, 0ns),
+            RiskReason::Position);
+  EXPECT_DOUBLE_EQ(risk.buyRoom(), 40.0);
+  EXPECT_EQ(risk.check({OrderSide::Buy, 100.0, 40.0}, 0ns), RiskReason::None);
+}
+
+TEST(RiskEngineTest, Position_FillsMoveOpenVolumeIntoPosition) {
+  RiskEngine risk(RiskConfig());
+  risk.onSent(OrderSide::Buy, 60.0);
+  risk.onFill(OrderSide::Buy, 20.0);
+  risk.onDone(OrderSide::Buy, 40.0);
+
+  EXPECT_DOUBLE_EQ(risk.buyRoom(), 80.0);
+  EXPECT_DOUBLE_EQ(risk.sellRoom(), 120.0);
+}
+
+TEST(RiskEngineTest, Position_OpenSellsDoNotOffsetBuys) {
+  RiskEngine risk(RiskConfig());
+  risk.onSent(OrderSide::Sell, 80.0);
+
+  // Either side may fill alone, so each is checked on its own
+  EXPECT_EQ(risk.check({OrderSide::Buy, 100.0, 100.0}, 0ns),
+            RiskReason::None);
+  EXPECT_EQ(risk.check({OrderSide::Sell, 100.0, 30.0}, 0ns),
+            RiskReason::Position);
+}
+
+TEST(RiskEngineTest, Replace_ChecksOnlyTheAddedVolume) {
+  RiskEngine risk(RiskConfig());
+  risk.onSent(OrderSide::Buy, 90.0);
+
+  EXPECT_EQ(risk.check({OrderSide::Buy, 100.0, 95.0}, 0ns, 90.0),
+            RiskReason::None);
+  EXPECT_EQ(risk.check({OrderSide::Buy, 100.0, 101.0}, 0ns, 90.0),
+            RiskReason::Position);
+}
+
+// ============================================================================
+// Notional, Rate and Loss Tests
+// ============================================================================
+
+TEST(RiskEngineTest, Notional_RefusesLargeOrders) {
+  Config config = RiskConfig();
+  config.max_order_notional = 1000.0;
+  RiskEngine risk(config);
+
+  EXPECT_EQ(risk.check({OrderSide::Buy, 100.0, 10.0}, 0ns), RiskReason::None);
+  EXPECT_EQ(risk.check({OrderSide::Sell, 100.0, 10.5}, 0ns),
+            RiskReason::Notional);
+}
+
+TEST(RiskEngineTest, Rate_TokenBucketRefillsInSimulatedTime) {
+  Config config = RiskConfig();
+  config.max_orders_per_second = 2.0;
+  config.order_burst = 3;
+  RiskEngine risk(config);
+  const Order order{OrderSide::Buy, 100.0, 1.0};
+
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(risk.check(order, 0ns), RiskReason::None);
+    risk.onSent(order.side, 0);
+  }
+  EXPECT_EQ(risk.check(order, 0ns), RiskReason::Rate);
+  EXPECT_EQ(risk.check(order, 400ms), RiskReason::Rate);
+  EXPECT_EQ(risk.check(order, 600ms), RiskReason::None);
+  risk.onSent(order.side, 0);
+  // Refilling never exceeds the burst
+  EXPECT_EQ(risk.check(order, 1h), RiskReason::None);
+  for (int i = 0; i < 3; ++i) risk.onSent(order.side, 0);
+  EXPECT_EQ(risk.check(order, 1h), RiskReason::Rate);
+}
+
+TEST(RiskEngineTest, Rate_UnsentOrderReturnsItsToken) {
+  Config config = RiskConfig();
+  config.max_orders_per_second = 1.0;
+  config.order_burst = 1;
+  RiskEngine risk(config);
+
+  risk.onSent(OrderSide::Buy, 5.0);
+  EXPECT_EQ(risk.check({OrderSide::Buy, 100.0, 5.0}, 0ns), RiskReason::Rate);
+  risk.onUnsent(OrderSide::Buy, 5.0);
+  EXPECT_EQ(risk.check({OrderSide::Buy, 100.0, 5.0}, 0ns), RiskReason::None);
+  EXPECT_DOUBLE_EQ(risk.buyRoom(), 100.0);
+}
+
+TEST(RiskEngineTest, MaxLoss_KillSwitchStaysTripped) {
+  Config config = RiskConfig();
+  config.max_loss = 500.0;
+  RiskEngine risk(config);
+
+  risk.onMark(-499.0);
+  EXPECT_FALSE(risk.killed());
+  risk.onMark(-500.0);
+  risk.onMark(100.0);
+
+  EXPECT_TRUE(risk.killed());
+  EXPECT_EQ(risk.check({OrderSide::Sell, 100.0, 1.0}, 0ns),
+            RiskReason::MaxLoss);
+}
+
+TEST(RiskEngineTest, Refusals_CountedByFirstReason) {
+  Config config = RiskConfig();
+  config.max_order_notional = 1000.0;
+  config.max_loss = 10.0;
+  RiskEngine risk(config);
+
+  risk.check({OrderSide::Buy, 100.0, 200.0}, 0ns);  // position and notional
+  risk.check({OrderSide::Buy, 200.0, 10.0}, 0ns);
+  risk.onMark(-10.0);
+  risk.check({OrderSide::Buy, 100.0, 200.0}, 0ns);
+
+  EXPECT_EQ(risk.refusals(RiskReason::Position), 1);
+  EXPECT_EQ(risk.refusals(RiskReason::Notional), 1);
+  EXPECT_EQ(risk.refusals(RiskReason::MaxLoss), 1);
+  EXPECT_EQ(risk.refusals(RiskReason::Rate), 0);
+}
+
+TEST(RiskEngineTest, SaveLoad_RestoresBucketAndSwitch) {
+  Config config = RiskConfig();
+  config.max_orders_per_second = 1.0;
+  config.order_burst = 1;
+  config.max_loss = 10.0;
+  RiskEngine original(config);
+  original.onSent(OrderSide::Sell, 30.0);
+  original.onMark(-20.0);
+  original.check({OrderSide::Sell, 100.0, 1.0}, 0ns);
+
+  SnapshotWriter writer;
+  original.save(writer);
+  RiskEngine restored(config);
+  SnapshotReader reader(std::move(writer).release());
+  restored.load(reader);
+
+  EXPECT_TRUE(restored.killed());
+  EXPECT_DOUBLE_EQ(restored.sellRoom(), 70.0);
+  EXPECT_EQ(restored.refusals(RiskReason::MaxLoss), 1);
+}
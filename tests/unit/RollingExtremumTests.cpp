@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "trading/RollingExtremum.h"
+
+using namespace std::chrono_literals;
+
+TEST(RollingExtremumTest, Update_FirstTick_ReturnsTickPrice) {
+  RollingMin min(1s, 100ms);
+  RollingMax max(1s, 100ms);
+
+  EXPECT_DOUBLE_EQ(min.update({0ms, 100.0, 1.0}), 100.0);
+  EXPECT_DOUBLE_EQ(max.update({0ms, 100.0, 1.0}), 100.0);
+}
+
+TEST(RollingExtremumTest, Update_TracksExtremaInWindow) {
+  RollingMin min(1s, 100ms);
+  RollingMax max(1s, 100ms);
+
+  for (auto tick : {Tick{0ms, 100.0, 1.0}, Tick{200ms, 90.0, 1.0},
+                    Tick{400ms, 120.0, 1.0}, Tick{600ms, 110.0, 1.0}}) {
+    min.update(tick);
+    max.update(tick);
+  }
+
+  EXPECT_DOUBLE_EQ(min.getCurrentPrice(), 90.0);
+  EXPECT_DOUBLE_EQ(max.getCurrentPrice(), 120.0);
+}
+
+TEST(RollingExtremumTest, Update_ExtremumExpires) {
+  RollingMin min(1s, 100ms);
+
+  min.update({0ms, 80.0, 1.0});
+  min.update({500ms, 100.0, 1.0});
+  Price result = min.update({1000ms, 110.0, 1.0});
+
+  EXPECT_DOUBLE_EQ(result, 100.0);
+}
+
+TEST(RollingExtremumTest, Update_NonPositiveWindow_HoldsNoTicks) {
+  for (auto window : {0s, -1s}) {
+    RollingMin min(window, 100ms);
+    RollingMax max(window, 100ms);
+
+    EXPECT_DOUBLE_EQ(min.update({0ms, 100.0, 1.0}), 0.0);
+    EXPECT_DOUBLE_EQ(max.update({100ms, 110.0, 1.0}), 0.0);
+  }
+}
+
+TEST(RollingExtremumTest, Update_MatchesNaiveWindowScan) {
+  RollingMin min(1s, 50ms);
+  RollingMax max(1s, 50ms);
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> dt(50, 150);
+  std::normal_distribution<double> move(0.0, 1.0);
+
+  std::vector<Tick> ticks;
+  Tick tick{0ns, 100.0, 1.0};
+  for (int i = 0; i < 1000; ++i) {
+    tick.timestamp += std::chrono::milliseconds(dt(gen));
+    tick.price += move(gen);
+    ticks.push_back(tick);
+    Price actual_min = min.update(tick);
+    Price actual_max = max.update(tick);
+
+    Price expected_min = tick.price;
+    Price expected_max = tick.price;
+    for (const auto& t : ticks) {
+      if (t.timestamp > tick.timestamp - 1s) {
+        expected_min = std::min(expected_min, t.price);
+        expected_max = std::max(expected_max, t.price);
+      }
+    }
+    ASSERT_DOUBLE_EQ(actual_min, expected_min) << "tick " << i;
+    ASSERT_DOUBLE_EQ(actual_max, expected_max) << "tick " << i;
+  }
+}
+
+TEST(RollingExtremumTest, Update_MonotonicInput_StaysWithinCapacity) {
+  RollingMax max(1s, 100ms);
+  const size_t capacity = WindowCapacity(1s, 100ms);
+
+  // Falling prices keep every tick as a candidate: the worst case
+  for (int i = 0; i < 100; ++i) {
+    max.update({std::chrono::milliseconds(100 * i), 1000.0 - i, 1.0});
+  }
+
+  EXPECT_DOUBLE_EQ(max.getCurrentPrice(), 1000.0 - 90);
+  SnapshotWriter writer;
+  max.save(writer);
+  SnapshotReader reader(std::move(writer).release());
+  uint64_t candidates = 0;
+  reader.read(candidates);
+  EXPECT_LE(candidates, capacity);
+}
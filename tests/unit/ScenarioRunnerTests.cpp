@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <vector>
+
+#include "config/Config.h"
+#include "simulation/ScenarioRunner.h"
+#include "simulation/Simulator.h"
+
+using namespace std::chrono_literals;
+
+namespace fs = std::filesystem;
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class ScenarioRunnerTest : public ::testing::Test {
+ protected:
+  fs::path temp_dir;
+
+  void SetUp() override {
+    auto timestamp =
+        std::chrono::system_clock::now().time_since_epoch().count();
+    temp_dir = fs::temp_directory_path() /
+               std::format("scenario_runner_test_{}", timestamp);
+    fs::create_directories(temp_dir);
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(temp_dir, ec);
+  }
+
+  Config CreateTestConfig() {
+    Config cfg;
+    cfg.price_evolution_path = temp_dir / "ticks.csv";
+    cfg.orders_log_path = temp_dir / "orders.csv";
+    cfg.checkpoint_path = temp_dir / "checkpoint.bin";
+    cfg.rejection_probability = 0.0;
+    cfg.time_horizon = 24h;
+    cfg.min_diff_time = 100ms;
+    cfg.max_diff_time = 200ms;
+    cfg.fast_ema = 200ms;
+    cfg.slow_ema = 1s;
+    cfg.seed = 11;
+    cfg.steps_count = 300;
+    cfg.branch_step = 100;
+    return cfg;
+  }
+
+  static std::vector<std::string> ReadLines(const fs::path& path) {
+    std::vector<std::string> lines;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+      lines.push_back(line);
+    }
+    return lines;
+  }
+};
+
+// ============================================================================
+// Path / Config Tests
+// ============================================================================
+
+TEST_F(ScenarioRunnerTest, BranchPath_InsertsNameBeforeExtension) {
+  EXPECT_EQ(ScenarioRunner::BranchPath("output/orders.csv", "high_vol"),
+            fs::path("output/orders.high_vol.csv"));
+  EXPECT_EQ(ScenarioRunner::BranchPath("ticks", "calm"),
+            fs::path("ticks.calm"));
+}
+
+TEST_F(ScenarioRunnerTest, BranchConfig_OverridesBranchParameters) {
+  Config base = CreateTestConfig();
+  ScenarioBranch branch{.name = "stress",
+                        .average_trend_value = -0.5,
+                        .price_variation = 0.9,
+                        .rejection_probability = 25.0};
+
+  Config cfg = ScenarioRunner::BranchConfig(base, branch);
+
+  EXPECT_DOUBLE_EQ(cfg.average_trend_value, -0.5);
+  EXPECT_DOUBLE_EQ(cfg.price_variation, 0.9);
+  EXPECT_DOUBLE_EQ(cfg.rejection_probability, 25.0);
+  EXPECT_EQ(cfg.orders_log_path, temp_dir / "orders.stress.csv");
+  EXPECT_TRUE(cfg.resume);
+}
+
+// ============================================================================
+// Run Tests
+// ============================================================================
+
+TEST_F(ScenarioRunnerTest, Run_EachBranchHasFullHistory) {
+  Config cfg = CreateTestConfig();
+  cfg.branches = {{"calm", 0.0, 0.01, 0.0}, {"wild", 0.0, 0.8, 50.0}};
+
+  auto errors = ScenarioRunner(cfg).Run();
+
+  ASSERT_TRUE(errors.empty()) << errors.front();
+  auto prefix = ReadLines(cfg.price_evolution_path);
+  auto calm = ReadLines(temp_dir / "ticks.calm.csv");
+  auto wild = ReadLines(temp_dir / "ticks.wild.csv");
+
+  EXPECT_EQ(prefix.size(), 101);  // Header + prefix ticks
+  ASSERT_EQ(calm.size(), 301);
+  ASSERT_EQ(wild.size(), 301);
+  for (size_t i = 0; i < prefix.size(); ++i) {
+    EXPECT_EQ(calm[i], prefix[i]);
+    EXPECT_EQ(wild[i], prefix[i]);
+  }
+  EXPECT_NE(calm.back(), wild.back());
+}
+
+TEST_F(ScenarioRunnerTest, Run_UnchangedBranchMatchesStraightRun) {
+  Config cfg = CreateTestConfig();
+  cfg.branches = {{"same", cfg.average_trend_value, cfg.price_variation,
+                   cfg.rejection_probability}};
+
+  auto errors = ScenarioRunner(cfg).Run();
+  ASSERT_TRUE(errors.empty()) << errors.front();
+
+  Config straight = CreateTestConfig();
+  straight.price_evolution_path = temp_dir / "straight_ticks.csv";
+  straight.orders_log_path = temp_dir / "straight_orders.csv";
+  Simulator(straight).Run();
+
+  EXPECT_EQ(ReadLines(temp_dir / "ticks.same.csv"),
+            ReadLines(straight.price_evolution_path));
+  EXPECT_EQ(ReadLines(temp_dir / "orders.same.csv"),
+            ReadLines(straight.orders_log_path));
+}
+
+TEST_F(ScenarioRunnerTest, Run_BarLogBranchMatchesStraightRun) {
+  Config cfg = CreateTestConfig();
+  cfg.tick_log_format = TickLogFormat::Bars;
+  cfg.bar_resolutions = {1s, 5s};
+  cfg.branches = {{"same", cfg.average_trend_value, cfg.price_variation,
+                   cfg.rejection_probability}};
+
+  auto errors = ScenarioRunner(cfg).Run();
+  ASSERT_TRUE(errors.empty()) << errors.front();
+
+  Config straight = CreateTestConfig();
+  straight.tick_log_format = TickLogFormat::Bars;
+  straight.bar_resolutions = cfg.bar_resolutions;
+  straight.price_evolution_path = temp_dir / "straight_ticks.csv";
+  straight.orders_log_path = temp_dir / "straight_orders.csv";
+  BarLogSimulator(straight).Run();
+
+  for (const auto resolution : cfg.bar_resolutions) {
+    const auto bars =
+        ReadLines(BarLogger::Path(temp_dir / "ticks.same.csv", resolution));
+    EXPECT_GT(bars.size(), 1);
+    EXPECT_EQ(bars, ReadLines(BarLogger::Path(straight.price_evolution_path,
+                                              resolution)));
+  }
+}
@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <format>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "config/Config.h"
+#include "simulation/Simulator.h"
+#include "trading/ExchangeApi.h"
+#include "trading/OrderManager.h"
+#include "venue/SharedVenue.h"
+
+// The venue runs on a thread of the test process, the sessions on the test
+// thread or on threads of their own
+class SharedVenueTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+    config_.venue_name =
+        std::format("tsim_test_{}_{}", ::getpid(), info->name());
+    config_.venue_capacity = 8;
+    config_.venue_sessions = 4;
+    config_.rejection_probability = 0;
+    config_.seed = 7;
+  }
+
+  void StartVenue() {
+    auto venue = SharedVenue::Create(config_);
+    ASSERT_TRUE(venue.has_value()) << venue.error();
+    venue_ = std::move(venue.value());
+    thread_ = std::jthread([this](std::stop_token stop) { venue_->Run(stop); });
+  }
+
+  void StopVenue() { thread_ = {}; }
+
+  struct Reply {
+    OrderIdentifier id;
+    Status status;
+    std::string error;
+  };
+
+  ExchangeCallback Record() {
+    return [this](OrderIdentifier id, Status status, std::string_view error) {
+      replies_.push_back({id, status, std::string(error)});
+    };
+  }
+
+  Config config_;
+  std::unique_ptr<SharedVenue> venue_;
+  std::jthread thread_;
+  std::vector<Reply> replies_;
+};
+
+TEST_F(SharedVenueTest, NoVenue_ConstructorThrows) {
+  EXPECT_THROW(SharedExchange exchange(config_), std::runtime_error);
+}
+
+TEST_F(SharedVenueTest, SameName_CreateFails) {
+  StartVenue();
+
+  auto second = SharedVenue::Create(config_);
+  ASSERT_FALSE(second.has_value());
+  EXPECT_NE(second.error().find("SharedVenue"), std::string::npos);
+}
+
+TEST_F(SharedVenueTest, AllSessionsTaken_ConstructorThrows) {
+  config_.venue_sessions = 1;
+  StartVenue();
+  SharedExchange first(config_);
+
+  EXPECT_THROW(SharedExchange second(config_), std::runtime_error);
+}
+
+TEST_F(SharedVenueTest, Order_FilledAfterPoll) {
+  StartVenue();
+  SharedExchange exchange(config_);
+
+  const auto id = exchange.sendOrder({OrderSide::Buy, 100.0, 10.0}, Record());
+  exchange.poll();
+
+  ASSERT_EQ(replies_.size(), 1);
+  EXPECT_EQ(replies_[0].id, id);
+  EXPECT_EQ(replies_[0].status, Status::Executed);
+  EXPECT_EQ(exchange.getRoundTripStats().count, 1);
+}
+
+TEST_F(SharedVenueTest, FullRejection_RejectsEveryOrder) {
+  config_.rejection_probability = 100;
+  StartVenue();
+  SharedExchange exchange(config_);
+
+  exchange.sendOrder({OrderSide::Sell, 100.0, 10.0}, Record());
+  exchange.poll();
+
+  ASSERT_EQ(replies_.size(), 1);
+  EXPECT_EQ(replies_[0].status, Status::Rejected);
+  EXPECT_EQ(replies_[0].error, "Random rejection");
+}
+
+TEST_F(SharedVenueTest, OneSession_DecidesLikeExchangeApi) {
+  config_.rejection_probability = 50;
+  StartVenue();
+  SharedExchange shared(config_);
+  ExchangeApi local(config_);
+
+  std::vector<Status> expected;
+  for (int i = 0; i < 100; ++i) {
+    local.sendOrder({OrderSide::Buy, 100.0, 1.0},
+                    [&](OrderIdentifier, Status status, std::string_view) {
+                      expected.push_back(status);
+                    });
+    shared.sendOrder({OrderSide::Buy, 100.0, 1.0}, Record());
+  }
+  local.poll();
+  shared.poll();
+
+  ASSERT_EQ(replies_.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(replies_[i].id, i + 1);
+    EXPECT_EQ(replies_[i].status, expected[i]) << "order " << i;
+  }
+}
+
+TEST_F(SharedVenueTest, Sessions_NumberOrdersFromDisjointRanges) {
+  StartVenue();
+  SharedExchange first(config_);
+  SharedExchange second(config_);
+
+  const auto a = first.sendOrder({OrderSide::Buy, 100.0, 1.0}, Record());
+  const auto b = second.sendOrder({OrderSide::Buy, 100.0, 1.0}, Record());
+  first.poll();
+  second.poll();
+
+  EXPECT_EQ(a, 1);
+  EXPECT_EQ(b, kSharedSessionIds + 1);
+  EXPECT_EQ(replies_.size(), 2);
+}
+
+TEST_F(SharedVenueTest, SendOrders_BasketLargerThanQueueAnswered) {
+  StartVenue();
+  SharedExchange exchange(config_);
+  const std::vector<Order> basket(20, Order{OrderSide::Buy, 100.0, 1.0});
+
+  const auto first_id = exchange.sendOrders(basket, Record());
+  exchange.poll();
+
+  ASSERT_EQ(replies_.size(), basket.size());
+  for (size_t i = 0; i < replies_.size(); ++i) {
+    EXPECT_EQ(replies_[i].id, first_id + i);
+  }
+}
+
+TEST_F(SharedVenueTest, SendOrders_BasketLargerThanQueue_RepliesWaitForPoll) {
+  StartVenue();
+  SharedExchange exchange(config_);
+  const std::vector<Order> basket(20, Order{OrderSide::Buy, 100.0, 1.0});
+
+  exchange.sendOrders(basket, Record());
+  EXPECT_TRUE(replies_.empty());
+
+  exchange.poll();
+  EXPECT_EQ(replies_.size(), basket.size());
+}
+
+TEST_F(SharedVenueTest, OrderManager_BasketLargerThanQueue_BooksEveryFill) {
+  config_.min_position = -1000.0;
+  config_.max_position = 1000.0;
+  StartVenue();
+  OrderManager<NullOrderLogger, SharedExchange> manager(config_);
+  const std::vector<Order> basket(20, Order{OrderSide::Buy, 100.0, 1.0});
+
+  ASSERT_NE(manager.SendOrders(basket), 0);
+
+  const auto summary = manager.getSummary();
+  EXPECT_EQ(summary.executed_orders, basket.size());
+  EXPECT_DOUBLE_EQ(summary.turnover, 2000.0);
+}
+
+TEST_F(SharedVenueTest, ManyThreads_EachGetsItsOwnRepliesInOrder) {
+  config_.venue_capacity = 16;
+  config_.rejection_probability = 30;
+  StartVenue();
+
+  constexpr int kOrders = 2000;
+  std::vector<uint64_t> answered(config_.venue_sessions, 0);
+  std::vector<uint64_t> misrouted(config_.venue_sessions, 0);
+  {
+    std::vector<std::jthread> strategies;
+    for (size_t s = 0; s < config_.venue_sessions; ++s) {
+      strategies.emplace_back([&, s] {
+        SharedExchange exchange(config_);
+        std::vector<OrderIdentifier> sent;
+        std::vector<OrderIdentifier> received;
+        for (int i = 0; i < kOrders; ++i) {
+          sent.push_back(exchange.sendOrder(
+              {OrderSide::Buy, 100.0, 1.0},
+              [&](OrderIdentifier id, Status, std::string_view) {
+                received.push_back(id);
+              }));
+          // Several orders in flight at once, one poll for all of them
+          if (i % 5 == 4) exchange.poll();
+        }
+        exchange.poll();
+        answered[s] = received.size();
+        misrouted[s] = sent == received ? 0 : 1;
+      });
+    }
+  }
+
+  for (size_t s = 0; s < config_.venue_sessions; ++s) {
+    EXPECT_EQ(answered[s], kOrders) << "session " << s;
+    EXPECT_EQ(misrouted[s], 0) << "session " << s;
+  }
+  const auto stats = venue_->stats();
+  EXPECT_EQ(stats.sessions, config_.venue_sessions);
+  EXPECT_EQ(stats.orders, config_.venue_sessions * kOrders);
+  EXPECT_GT(stats.rejected, 0);
+  EXPECT_LE(stats.batches, stats.orders);
+}
+
+TEST_F(SharedVenueTest, VenueStopped_RejectsOrdersInFlight) {
+  StartVenue();
+  SharedExchange exchange(config_);
+  StopVenue();
+
+  exchange.sendOrder({OrderSide::Buy, 100.0, 1.0}, Record());
+  exchange.poll();
+
+  ASSERT_EQ(replies_.size(), 1);
+  EXPECT_EQ(replies_[0].status, Status::Rejected);
+  EXPECT_EQ(replies_[0].error, "Exchange disconnected");
+}
+
+TEST_F(SharedVenueTest, OneSimulation_MatchesInProcessExchange) {
+  config_.rejection_probability = 20;
+  config_.metrics_only = true;
+  config_.steps_count = 2000;
+  StartVenue();
+
+  SharedMetricsOnlySimulator shared(config_);
+  shared.Run();
+  MetricsOnlySimulator local(config_);
+  local.Run();
+
+  const auto shared_summary = shared.getSummary();
+  const auto local_summary = local.getSummary();
+  EXPECT_GT(shared_summary.executed_orders, 0);
+  EXPECT_EQ(shared_summary.executed_orders, local_summary.executed_orders);
+  EXPECT_EQ(shared_summary.rejected_orders, local_summary.rejected_orders);
+  EXPECT_DOUBLE_EQ(shared_summary.total_pnl, local_summary.total_pnl);
+}
@@ -1,10 +1,13 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "config/Config.h"
@@ -15,6 +18,58 @@ using ::testing::HasSubstr;
 
 namespace fs = std::filesystem;
 
+namespace {
+
+// Minimal strategy used to check what the simulator drives through the
+// Strategy concept.
+class RecordingStrategy {
+ public:
+  explicit RecordingStrategy(const Config&) {}
+
+  void onTick(const Tick& tick) {
+    ticks.push_back(tick.timestamp);
+    volume += tick.volume;
+  }
+  void onReply(OrderIdentifier, Status) {}
+  void onTimer(std::chrono::nanoseconds now) { timers.push_back(now); }
+
+  [[nodiscard]] PerformanceSummary getSummary() const {
+    PerformanceSummary summary{};
+    summary.ticks = ticks.size();
+    return summary;
+  }
+
+  void save(SnapshotWriter& writer) const {
+    writer.write(static_cast<uint64_t>(ticks.size()));
+  }
+  std::optional<std::string> load(SnapshotReader& reader) {
+    uint64_t count = 0;
+    reader.read(count);
+    ticks.resize(count);
+    return std::nullopt;
+  }
+
+  std::vector<std::chrono::nanoseconds> ticks;
+  std::vector<std::chrono::nanoseconds> timers;
+  Volume volume = 0;
+};
+
+// Falls behind a generator that is not slowed down by logging
+class SlowStrategy : public RecordingStrategy {
+ public:
+  using RecordingStrategy::RecordingStrategy;
+
+  void onTick(const Tick& tick) {
+    RecordingStrategy::onTick(tick);
+    std::this_thread::sleep_for(50us);
+  }
+};
+
+static_assert(Strategy<RecordingStrategy>);
+static_assert(Strategy<EmaTradingBot<>>);
+
+}  // namespace
+
 // ============================================================================
 // Test Fixture
 // ============================================================================
@@ -395,4 +450,417 @@ TEST_F(SimulatorTest, Run_LowInitialPrice) {
   for (const auto& tick : ticks) {
     EXPECT_GT(tick.price, 0.0);
   }
-}
\ No newline at end of file
+}
+// ============================================================================
+// Checkpoint / Resume Tests
+// ============================================================================
+
+TEST_F(SimulatorTest, Seed_SameSeed_IdenticalTicks) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 100;
+  cfg.seed = 42;
+  Simulator(cfg).Run();
+  auto first = ReadTickLogLines();
+
+  Simulator(cfg).Run();
+  auto second = ReadTickLogLines();
+
+  EXPECT_EQ(first, second);
+}
+
+TEST_F(SimulatorTest, Checkpoint_WritesSnapshotFile) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 100;
+  cfg.checkpoint_interval = 50;
+  cfg.checkpoint_path = temp_dir / "checkpoint.bin";
+  Simulator sim(cfg);
+
+  sim.Run();
+
+  EXPECT_TRUE(fs::exists(cfg.checkpoint_path));
+}
+
+TEST_F(SimulatorTest, Resume_ContinuesBitExactly) {
+  auto read_file = [](const fs::path& path) {
+    std::ifstream file(path);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+  };
+
+  Config reference = CreateTestConfig();
+  reference.seed = 7;
+  reference.rejection_probability = 30.0;
+  reference.fast_ema = 200ms;
+  reference.slow_ema = 1s;
+  reference.price_variation = 0.5;
+  reference.steps_count = 400;
+  reference.price_evolution_path = temp_dir / "reference_ticks.csv";
+  reference.orders_log_path = temp_dir / "reference_orders.csv";
+  Simulator(reference).Run();
+
+  // Interrupted run: the last checkpoint is at step 200, but the logs already
+  // contain ticks up to step 250.
+  Config interrupted = reference;
+  interrupted.steps_count = 250;
+  interrupted.checkpoint_interval = 100;
+  interrupted.checkpoint_path = temp_dir / "checkpoint.bin";
+  interrupted.price_evolution_path = temp_dir / "ticks.csv";
+  interrupted.orders_log_path = temp_dir / "orders.csv";
+  Simulator(interrupted).Run();
+
+  Config resumed = interrupted;
+  resumed.steps_count = reference.steps_count;
+  resumed.resume = true;
+  Simulator sim(resumed);
+  auto err = sim.LoadCheckpoint(resumed.checkpoint_path);
+  ASSERT_FALSE(err.has_value()) << err.value();
+  EXPECT_EQ(sim.getCurrentStep(), 200);
+  sim.Run();
+
+  EXPECT_EQ(read_file(resumed.price_evolution_path),
+            read_file(reference.price_evolution_path));
+  EXPECT_EQ(read_file(resumed.orders_log_path),
+            read_file(reference.orders_log_path));
+}
+
+TEST_F(SimulatorTest, LoadCheckpoint_MissingFile_ReturnsError) {
+  Config cfg = CreateTestConfig();
+  Simulator sim(cfg);
+
+  auto err = sim.LoadCheckpoint(temp_dir / "missing.bin");
+
+  EXPECT_TRUE(err.has_value());
+}
+
+// ============================================================================
+// Metrics-Only Tests
+// ============================================================================
+
+TEST_F(SimulatorTest, MetricsOnly_WritesNoLogFiles) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 500;
+  cfg.fast_ema = 200ms;
+  cfg.slow_ema = 1s;
+  cfg.price_variation = 0.5;
+  MetricsOnlySimulator sim(cfg);
+
+  sim.Run();
+
+  EXPECT_FALSE(fs::exists(cfg.price_evolution_path));
+  EXPECT_FALSE(fs::exists(cfg.orders_log_path));
+  EXPECT_EQ(sim.getSummary().ticks, 500);
+}
+
+TEST_F(SimulatorTest, MetricsOnly_SameSummaryAsLoggedRun) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 500;
+  cfg.seed = 3;
+  cfg.fast_ema = 200ms;
+  cfg.slow_ema = 1s;
+  cfg.price_variation = 0.5;
+  cfg.rejection_probability = 20.0;
+
+  Simulator logged(cfg);
+  logged.Run();
+  MetricsOnlySimulator metrics_only(cfg);
+  metrics_only.Run();
+
+  auto expected = logged.getSummary();
+  auto actual = metrics_only.getSummary();
+  EXPECT_EQ(actual.executed_orders, expected.executed_orders);
+  EXPECT_EQ(actual.rejected_orders, expected.rejected_orders);
+  EXPECT_DOUBLE_EQ(actual.total_pnl, expected.total_pnl);
+  EXPECT_DOUBLE_EQ(actual.max_drawdown, expected.max_drawdown);
+}
+
+TEST_F(SimulatorTest, CustomStrategy_ReceivesEveryTick) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 50;
+
+  Simulator<RecordingStrategy, NullTickLogger> sim(cfg);
+  sim.Run();
+
+  const auto& ticks = sim.getStrategy().ticks;
+  ASSERT_EQ(ticks.size(), 50);
+  EXPECT_TRUE(std::is_sorted(ticks.begin(), ticks.end()));
+  EXPECT_TRUE(sim.getStrategy().timers.empty());
+  EXPECT_EQ(sim.getSummary().ticks, 50);
+}
+
+TEST_F(SimulatorTest, CustomStrategy_TimerFiresOnSimulatedClock) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 100;
+  cfg.timer_interval = 1s;
+
+  Simulator<RecordingStrategy, NullTickLogger> sim(cfg);
+  sim.Run();
+
+  const auto& ticks = sim.getStrategy().ticks;
+  const auto& timers = sim.getStrategy().timers;
+  // 100 ticks at 100-200ms cover 10-20s of simulated time
+  ASSERT_EQ(static_cast<int64_t>(timers.size()), ticks.back() / 1s);
+  for (size_t i = 0; i < timers.size(); ++i) {
+    EXPECT_EQ(timers[i], static_cast<int64_t>(i + 1) * 1s);
+  }
+}
+
+TEST_F(SimulatorTest, Warmup_SkipsSimulatedTimeWithoutTicks) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 10;
+  cfg.warmup = 1h;
+
+  Simulator<RecordingStrategy, NullTickLogger> sim(cfg);
+  sim.Run();
+
+  const auto& ticks = sim.getStrategy().ticks;
+  ASSERT_EQ(ticks.size(), 10);
+  EXPECT_GT(ticks.front(), 1h);
+  EXPECT_LE(ticks.front(), 1h + cfg.max_diff_time);
+}
+
+TEST_F(SimulatorTest, FastForward_ZeroVariation_AppliesDrift) {
+  Config cfg = CreateTestConfig();
+  cfg.price_variation = 0.0;
+  cfg.average_trend_value = 0.05;
+  cfg.time_horizon = 24h;
+
+  Simulator<RecordingStrategy, NullTickLogger> sim(cfg);
+  auto bridge = sim.fastForward(24h);
+
+  EXPECT_EQ(bridge.getStartTime(), 0ns);
+  EXPECT_EQ(bridge.getEndTime(), 24h);
+  EXPECT_NEAR(bridge.priceAt(24h), 100.0 * std::exp(0.05), 1e-9);
+}
+
+TEST_F(SimulatorTest, Warmup_ResumedRunDoesNotWarmUpAgain) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 250;  // last checkpoint at step 200
+  cfg.seed = 9;
+  cfg.warmup = 1h;
+  cfg.checkpoint_interval = 100;
+  cfg.checkpoint_path = temp_dir / "checkpoint.bin";
+
+  Simulator<RecordingStrategy, NullTickLogger> reference(cfg);
+  reference.Run();
+
+  cfg.resume = true;
+  Simulator<RecordingStrategy, NullTickLogger> resumed(cfg);
+  ASSERT_FALSE(resumed.LoadCheckpoint(cfg.checkpoint_path).has_value());
+  resumed.Run();
+
+  EXPECT_EQ(resumed.getStrategy().ticks.back(),
+            reference.getStrategy().ticks.back());
+}
+
+TEST_F(SimulatorTest, ParallelPath_SameTicksForAnyThreadCount) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 3 * PathGenerator::kBlockSize + 11;
+  cfg.seed = 21;
+  cfg.path_threads = 1;
+
+  Simulator<RecordingStrategy, NullTickLogger> serial(cfg);
+  serial.Run();
+  cfg.path_threads = 4;
+  Simulator<RecordingStrategy, NullTickLogger> parallel(cfg);
+  parallel.Run();
+
+  EXPECT_EQ(parallel.getStrategy().ticks, serial.getStrategy().ticks);
+  EXPECT_EQ(parallel.getSummary().ticks, cfg.steps_count);
+}
+
+TEST_F(SimulatorTest, ParallelPath_ResumeContinuesBitExactly) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 400;
+  cfg.seed = 8;
+  cfg.path_threads = 2;
+
+  Config reference_cfg = cfg;
+  reference_cfg.price_evolution_path = temp_dir / "reference.csv";
+  reference_cfg.orders_log_path = temp_dir / "reference_orders.csv";
+  {
+    Simulator reference(reference_cfg);
+    reference.Run();
+  }
+
+  cfg.steps_count = 250;
+  cfg.checkpoint_interval = 100;
+  cfg.checkpoint_path = temp_dir / "checkpoint.bin";
+  {
+    Simulator interrupted(cfg);
+    interrupted.Run();
+  }
+
+  cfg.steps_count = 400;
+  cfg.resume = true;
+  {
+    Simulator resumed(cfg);
+    ASSERT_FALSE(resumed.LoadCheckpoint(cfg.checkpoint_path).has_value());
+    resumed.Run();
+  }
+
+  std::ifstream expected(reference_cfg.price_evolution_path);
+  std::ifstream actual(cfg.price_evolution_path);
+  std::stringstream expected_text;
+  std::stringstream actual_text;
+  expected_text << expected.rdbuf();
+  actual_text << actual.rdbuf();
+  EXPECT_EQ(actual_text.str(), expected_text.str());
+}
+
+TEST_F(SimulatorTest, LatestDelivery_FastStrategyCanSeeEveryTick) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 200;
+  cfg.seed = 7;
+
+  Simulator<RecordingStrategy, NullTickLogger> every(cfg);
+  every.Run();
+  cfg.tick_delivery = TickDelivery::Latest;
+  Simulator<RecordingStrategy, NullTickLogger> latest(cfg);
+  latest.Run();
+
+  // Whatever was skipped, the delivered ticks are in order and end on the
+  // last generated one
+  const auto& ticks = latest.getStrategy().ticks;
+  ASSERT_FALSE(ticks.empty());
+  EXPECT_TRUE(std::is_sorted(ticks.begin(), ticks.end()));
+  EXPECT_EQ(ticks.back(), every.getStrategy().ticks.back());
+  EXPECT_EQ(ticks.size() + latest.getSummary().conflated_ticks, 200);
+}
+
+TEST_F(SimulatorTest, LatestDelivery_SlowStrategyIsConflated) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 2000;
+  cfg.tick_delivery = TickDelivery::Latest;
+
+  Simulator<SlowStrategy, NullTickLogger> sim(cfg);
+  sim.Run();
+
+  const auto summary = sim.getSummary();
+  EXPECT_GT(summary.conflated_ticks, 0);
+  EXPECT_EQ(summary.ticks + summary.conflated_ticks, 2000);
+  EXPECT_THAT(FormatSummary(summary), HasSubstr("Conflated ticks:"));
+}
+
+TEST_F(SimulatorTest, LatestDelivery_ConflatedVolumeAddsUp) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 2000;
+  cfg.seed = 7;
+
+  Simulator<RecordingStrategy, NullTickLogger> every(cfg);
+  every.Run();
+  cfg.tick_delivery = TickDelivery::Latest;
+  cfg.conflate_volume = true;
+  Simulator<SlowStrategy, NullTickLogger> latest(cfg);
+  latest.Run();
+
+  EXPECT_NEAR(latest.getStrategy().volume, every.getStrategy().volume,
+              1e-6 * every.getStrategy().volume);
+}
+
+TEST_F(SimulatorTest, BusDelivery_StrategySeesWhatEveryDelivers) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 2000;
+  cfg.seed = 7;
+  cfg.timer_interval = 1s;
+
+  Simulator<RecordingStrategy, NullTickLogger> every(cfg);
+  every.Run();
+  cfg.tick_delivery = TickDelivery::Bus;
+  cfg.bus_capacity = 64;
+  Simulator<RecordingStrategy, NullTickLogger> bus(cfg);
+  bus.Run();
+
+  EXPECT_EQ(bus.getStrategy().ticks, every.getStrategy().ticks);
+  EXPECT_EQ(bus.getStrategy().timers, every.getStrategy().timers);
+}
+
+TEST_F(SimulatorTest, BusDelivery_SameLogsAsEvery) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 1000;
+  cfg.seed = 11;
+  cfg.rejection_probability = 0.2;
+
+  Config reference_cfg = cfg;
+  reference_cfg.price_evolution_path = temp_dir / "reference.csv";
+  reference_cfg.orders_log_path = temp_dir / "reference_orders.csv";
+  {
+    Simulator reference(reference_cfg);
+    reference.Run();
+  }
+  cfg.tick_delivery = TickDelivery::Bus;
+  cfg.bus_wait = BusWait::Yield;
+  {
+    Simulator bus(cfg);
+    bus.Run();
+  }
+
+  for (const auto& [expected_path, actual_path] :
+       {std::pair{reference_cfg.price_evolution_path,
+                  cfg.price_evolution_path},
+        std::pair{reference_cfg.orders_log_path, cfg.orders_log_path}}) {
+    std::ifstream expected(expected_path);
+    std::ifstream actual(actual_path);
+    std::stringstream expected_text;
+    std::stringstream actual_text;
+    expected_text << expected.rdbuf();
+    actual_text << actual.rdbuf();
+    EXPECT_EQ(actual_text.str(), expected_text.str()) << actual_path;
+  }
+}
+
+TEST_F(SimulatorTest, BusDelivery_ResumeContinuesBitExactly) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 400;
+  cfg.seed = 8;
+  cfg.tick_delivery = TickDelivery::Bus;
+  cfg.bus_capacity = 16;
+
+  Config reference_cfg = cfg;
+  reference_cfg.price_evolution_path = temp_dir / "reference.csv";
+  reference_cfg.orders_log_path = temp_dir / "reference_orders.csv";
+  {
+    Simulator reference(reference_cfg);
+    reference.Run();
+  }
+
+  cfg.steps_count = 250;
+  cfg.checkpoint_interval = 100;
+  cfg.checkpoint_path = temp_dir / "checkpoint.bin";
+  {
+    Simulator interrupted(cfg);
+    interrupted.Run();
+  }
+
+  cfg.steps_count = 400;
+  cfg.resume = true;
+  {
+    Simulator resumed(cfg);
+    ASSERT_FALSE(resumed.LoadCheckpoint(cfg.checkpoint_path).has_value());
+    resumed.Run();
+  }
+
+  std::ifstream expected(reference_cfg.price_evolution_path);
+  std::ifstream actual(cfg.price_evolution_path);
+  std::stringstream expected_text;
+  std::stringstream actual_text;
+  expected_text << expected.rdbuf();
+  actual_text << actual.rdbuf();
+  EXPECT_EQ(actual_text.str(), expected_text.str());
+}
+
+TEST_F(SimulatorTest, BusDelivery_SummaryReportsLatency) {
+  Config cfg = CreateTestConfig();
+  cfg.steps_count = 500;
+  cfg.tick_delivery = TickDelivery::Bus;
+
+  Simulator<RecordingStrategy, NullTickLogger> sim(cfg);
+  sim.Run();
+
+  const auto summary = sim.getSummary();
+  EXPECT_EQ(summary.bus_ticks, 500);
+  EXPECT_GT(summary.bus_batches, 0);
+  EXPECT_LE(summary.bus_batches, 500);
+  EXPECT_LE(summary.mean_bus_latency, summary.max_bus_latency);
+  EXPECT_THAT(FormatSummary(summary), HasSubstr("Bus latency:"));
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <random>
+
+#include "common/Snapshot.h"
+#include "common/Types.h"
+
+using namespace std::chrono_literals;
+
+namespace fs = std::filesystem;
+
+// ============================================================================
+// Writer / Reader Round Trip Tests
+// ============================================================================
+
+TEST(SnapshotTest, RoundTrip_TriviallyCopyableValues) {
+  SnapshotWriter writer;
+  writer.write(uint64_t{42});
+  writer.write(3.5);
+  writer.write(Tick{150ms, 101.25, 7.0});
+  writer.write(Status::Rejected);
+
+  SnapshotReader reader(writer.data());
+  uint64_t number = 0;
+  double value = 0;
+  Tick tick{};
+  Status status = Status::Pending;
+
+  EXPECT_TRUE(reader.read(number));
+  EXPECT_TRUE(reader.read(value));
+  EXPECT_TRUE(reader.read(tick));
+  EXPECT_TRUE(reader.read(status));
+  EXPECT_TRUE(reader.atEnd());
+
+  EXPECT_EQ(number, 42);
+  EXPECT_DOUBLE_EQ(value, 3.5);
+  EXPECT_EQ(tick.timestamp, 150ms);
+  EXPECT_DOUBLE_EQ(tick.price, 101.25);
+  EXPECT_EQ(status, Status::Rejected);
+}
+
+TEST(SnapshotTest, RoundTrip_String) {
+  SnapshotWriter writer;
+  writer.writeString("hello, snapshot");
+
+  SnapshotReader reader(writer.data());
+  std::string value;
+
+  EXPECT_TRUE(reader.readString(value));
+  EXPECT_EQ(value, "hello, snapshot");
+}
+
+TEST(SnapshotTest, RoundTrip_EngineContinuesSameSequence) {
+  std::mt19937 original(123);
+  original.discard(1000);
+
+  SnapshotWriter writer;
+  writer.writeEngine(original);
+
+  std::mt19937 restored;
+  SnapshotReader reader(writer.data());
+  ASSERT_TRUE(reader.readEngine(restored));
+
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(original(), restored());
+  }
+}
+
+TEST(SnapshotTest, Engine_PackedSmallerThanText) {
+  std::mt19937 engine(7);
+  std::ostringstream text;
+  text << engine;
+
+  SnapshotWriter writer;
+  writer.writeEngine(engine);
+
+  EXPECT_LT(writer.data().size(), text.str().size());
+}
+
+TEST(SnapshotTest, RoundTrip_DistributionKeepsCachedVariate) {
+  std::mt19937 gen(5);
+  std::normal_distribution<double> original(0.0, 1.0);
+  original(gen);  // Leaves the second Box-Muller variate cached
+
+  SnapshotWriter writer;
+  writer.writeDistribution(original);
+  writer.writeEngine(gen);
+
+  std::mt19937 restored_gen;
+  std::normal_distribution<double> restored;
+  SnapshotReader reader(writer.data());
+  ASSERT_TRUE(reader.readDistribution(restored));
+  ASSERT_TRUE(reader.readEngine(restored_gen));
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(original(gen), restored(restored_gen));
+  }
+}
+
+TEST(SnapshotTest, Read_PastEnd_Fails) {
+  SnapshotWriter writer;
+  writer.write(uint32_t{1});
+
+  SnapshotReader reader(writer.data());
+  uint64_t value = 0;
+
+  EXPECT_FALSE(reader.read(value));
+  EXPECT_FALSE(reader.ok());
+}
+
+// ============================================================================
+// File Tests
+// ============================================================================
+
+class SnapshotFileTest : public ::testing::Test {
+ protected:
+  fs::path temp_dir;
+
+  void SetUp() override {
+    auto timestamp =
+        std::chrono::system_clock::now().time_since_epoch().count();
+    temp_dir =
+        fs::temp_directory_path() / std::format("snapshot_test_{}", timestamp);
+    fs::create_directories(temp_dir);
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(temp_dir, ec);
+  }
+};
+
+TEST_F(SnapshotFileTest, WriteThenRead_ReturnsPayload) {
+  auto path = temp_dir / "nested" / "state.bin";
+
+  auto err = WriteSnapshotFile(path, std::string("payload\0bytes", 13));
+  ASSERT_FALSE(err.has_value()) << err.value();
+
+  auto payload = ReadSnapshotFile(path);
+  ASSERT_TRUE(payload.has_value()) << payload.error();
+  EXPECT_EQ(payload.value(), std::string("payload\0bytes", 13));
+  EXPECT_FALSE(fs::exists(temp_dir / "nested" / "state.bin.tmp"));
+}
+
+TEST_F(SnapshotFileTest, Read_MissingFile_ReturnsError) {
+  auto payload = ReadSnapshotFile(temp_dir / "missing.bin");
+
+  EXPECT_FALSE(payload.has_value());
+}
+
+TEST_F(SnapshotFileTest, Read_NotASnapshot_ReturnsError) {
+  auto path = temp_dir / "state.bin";
+  std::ofstream(path) << "Time,Price,Volume\n";
+
+  auto payload = ReadSnapshotFile(path);
+
+  ASSERT_FALSE(payload.has_value());
+  EXPECT_NE(payload.error().find("not a snapshot"), std::string::npos);
+}
+
+TEST_F(SnapshotFileTest, Read_SizeBeyondFile_ReturnsError) {
+  auto path = temp_dir / "state.bin";
+  ASSERT_FALSE(WriteSnapshotFile(path, "payload").has_value());
+  // Overwrite the header's payload size with one far past the file's end
+  {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    const uint64_t size = uint64_t{1} << 60;
+    file.seekp(12);
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+  }
+
+  auto payload = ReadSnapshotFile(path);
+
+  ASSERT_FALSE(payload.has_value());
+  EXPECT_NE(payload.error().find("truncated"), std::string::npos);
+}
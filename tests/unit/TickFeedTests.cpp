@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/Snapshot.h"
+#include "config/Config.h"
+#include "feed/TickFeedPublisher.h"
+#include "feed/TickFeedSubscriber.h"
+
+using namespace std::chrono_literals;
+
+class TickFeedTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+    config_.tick_feed_name =
+        std::format("tsim_test_{}_{}", ::getpid(), info->name());
+    config_.tick_feed_capacity = 16;
+  }
+
+  void TearDown() override {
+    ::shm_unlink(TickFeedShmName(config_.tick_feed_name).c_str());
+  }
+
+  static Tick MakeTick(int i) {
+    return {std::chrono::nanoseconds(i * 1000), 100.0 + i, 1.0 * i};
+  }
+
+  Config config_;
+};
+
+TEST_F(TickFeedTest, Subscriber_ReadsTicksInOrder) {
+  TickFeedPublisher publisher(config_);
+  auto subscriber = TickFeedSubscriber::Open(config_.tick_feed_name);
+  ASSERT_TRUE(subscriber.has_value()) << subscriber.error();
+
+  EXPECT_FALSE(subscriber.value()->poll().has_value());
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_FALSE(publisher.writeTick(MakeTick(i)).has_value());
+  }
+
+  for (int i = 0; i < 10; ++i) {
+    auto tick = subscriber.value()->poll();
+    ASSERT_TRUE(tick.has_value());
+    EXPECT_EQ(tick->timestamp, MakeTick(i).timestamp);
+    EXPECT_DOUBLE_EQ(tick->price, MakeTick(i).price);
+    EXPECT_DOUBLE_EQ(tick->volume, MakeTick(i).volume);
+  }
+  EXPECT_FALSE(subscriber.value()->poll().has_value());
+  EXPECT_EQ(subscriber.value()->sequence(), 10);
+  EXPECT_EQ(subscriber.value()->lost(), 0);
+}
+
+TEST_F(TickFeedTest, MissingFeed_OpenFails) {
+  auto subscriber = TickFeedSubscriber::Open(config_.tick_feed_name);
+
+  ASSERT_FALSE(subscriber.has_value());
+  EXPECT_NE(subscriber.error().find("TickFeedSubscriber"), std::string::npos);
+}
+
+TEST_F(TickFeedTest, BadCapacity_OpenFails) {
+  // A segment that looks like a feed but whose capacity is no power of two
+  const auto shm_name = TickFeedShmName(config_.tick_feed_name);
+  const int fd = ::shm_open(shm_name.c_str(), O_RDWR | O_CREAT, 0600);
+  ASSERT_GE(fd, 0);
+  ASSERT_EQ(::ftruncate(fd, static_cast<off_t>(TickFeedSize(3))), 0);
+  void* map = ::mmap(nullptr, TickFeedSize(3), PROT_READ | PROT_WRITE,
+                     MAP_SHARED, fd, 0);
+  ::close(fd);
+  ASSERT_NE(map, MAP_FAILED);
+  auto& header = *static_cast<TickFeedHeader*>(map);
+  header.version = kTickFeedVersion;
+  header.slot_size = sizeof(TickFeedSlot);
+  header.capacity = 3;
+  std::atomic_ref(header.magic).store(kTickFeedMagic);
+  ::munmap(map, TickFeedSize(3));
+
+  auto subscriber = TickFeedSubscriber::Open(config_.tick_feed_name);
+
+  ASSERT_FALSE(subscriber.has_value());
+  EXPECT_NE(subscriber.error().find("not a tick feed"), std::string::npos);
+}
+
+TEST_F(TickFeedTest, SecondPublisher_WhileOpen_Fails) {
+  TickFeedPublisher publisher(config_);
+
+  EXPECT_THROW(TickFeedPublisher second(config_), std::runtime_error);
+
+  // The running feed is left alone
+  auto subscriber = TickFeedSubscriber::Open(config_.tick_feed_name);
+  ASSERT_TRUE(subscriber.has_value()) << subscriber.error();
+  publisher.writeTick(MakeTick(0));
+  EXPECT_TRUE(subscriber.value()->poll().has_value());
+}
+
+TEST_F(TickFeedTest, LateSubscriber_StartsAtOldestTickInRing) {
+  TickFeedPublisher publisher(config_);
+  for (int i = 0; i < 20; ++i) {
+    publisher.writeTick(MakeTick(i));
+  }
+
+  auto subscriber = TickFeedSubscriber::Open(config_.tick_feed_name);
+  ASSERT_TRUE(subscriber.has_value()) << subscriber.error();
+
+  EXPECT_EQ(subscriber.value()->sequence(), 4);
+  auto tick = subscriber.value()->poll();
+  ASSERT_TRUE(tick.has_value());
+  EXPECT_DOUBLE_EQ(tick->price, MakeTick(4).price);
+  EXPECT_EQ(subscriber.value()->lost(), 0);
+}
+
+TEST_F(TickFeedTest, Overrun_SkipsOverwrittenTicks) {
+  TickFeedPublisher publisher(config_);
+  auto subscriber = TickFeedSubscriber::Open(config_.tick_feed_name);
+  ASSERT_TRUE(subscriber.has_value()) << subscriber.error();
+
+  for (int i = 0; i < 40; ++i) {
+    publisher.writeTick(MakeTick(i));
+  }
+
+  auto tick = subscriber.value()->poll();
+  ASSERT_TRUE(tick.has_value());
+  EXPECT_DOUBLE_EQ(tick->price, MakeTick(24).price);
+  EXPECT_EQ(subscriber.value()->lost(), 24);
+
+  int read = 1;
+  while (subscriber.value()->poll()) ++read;
+  EXPECT_EQ(read, 16);
+}
+
+TEST_F(TickFeedTest, MultipleSubscribers_EachReadEveryTick) {
+  TickFeedPublisher publisher(config_);
+  auto first = TickFeedSubscriber::Open(config_.tick_feed_name);
+  auto second = TickFeedSubscriber::Open(config_.tick_feed_name);
+  ASSERT_TRUE(first.has_value() && second.has_value());
+
+  for (int i = 0; i < 8; ++i) {
+    publisher.writeTick(MakeTick(i));
+  }
+
+  for (auto* subscriber : {first->get(), second->get()}) {
+    for (int i = 0; i < 8; ++i) {
+      auto tick = subscriber->poll();
+      ASSERT_TRUE(tick.has_value());
+      EXPECT_DOUBLE_EQ(tick->price, MakeTick(i).price);
+    }
+  }
+}
+
+TEST_F(TickFeedTest, Next_ReturnsNothingOnceClosedAndDrained) {
+  auto publisher = std::make_unique<TickFeedPublisher>(config_);
+  auto subscriber = TickFeedSubscriber::Open(config_.tick_feed_name);
+  ASSERT_TRUE(subscriber.has_value()) << subscriber.error();
+
+  publisher->writeTick(MakeTick(0));
+  publisher->writeTick(MakeTick(1));
+  publisher.reset();
+
+  EXPECT_TRUE(subscriber.value()->next().has_value());
+  EXPECT_TRUE(subscriber.value()->next().has_value());
+  EXPECT_FALSE(subscriber.value()->next().has_value());
+}
+
+TEST_F(TickFeedTest, ConcurrentSubscriber_SeesOrderedUntornTicks) {
+  config_.tick_feed_capacity = 1024;
+  constexpr int kTicks = 200'000;
+
+  auto publisher = std::make_unique<TickFeedPublisher>(config_);
+  auto subscriber = TickFeedSubscriber::Open(config_.tick_feed_name);
+  ASSERT_TRUE(subscriber.has_value()) << subscriber.error();
+
+  std::jthread writer([&] {
+    for (int i = 0; i < kTicks; ++i) {
+      publisher->writeTick(MakeTick(i));
+    }
+    publisher.reset();
+  });
+
+  int64_t last = -1;
+  uint64_t read = 0;
+  while (auto tick = subscriber.value()->next()) {
+    const int64_t i = tick->timestamp.count() / 1000;
+    ASSERT_GT(i, last);
+    ASSERT_DOUBLE_EQ(tick->price, 100.0 + i);
+    ASSERT_DOUBLE_EQ(tick->volume, 1.0 * i);
+    last = i;
+    ++read;
+  }
+
+  EXPECT_EQ(last, kTicks - 1);
+  EXPECT_EQ(read + subscriber.value()->lost(), kTicks);
+}
+
+TEST_F(TickFeedTest, Load_ContinuesNumberingInFreshSegment) {
+  std::string state;
+  {
+    TickFeedPublisher publisher(config_);
+    for (int i = 0; i < 5; ++i) {
+      publisher.writeTick(MakeTick(i));
+    }
+    SnapshotWriter writer;
+    publisher.save(writer);
+    state = writer.data();
+  }
+
+  TickFeedPublisher publisher(config_);
+  SnapshotReader reader(state);
+  ASSERT_FALSE(publisher.load(reader).has_value());
+  publisher.writeTick(MakeTick(5));
+
+  auto subscriber = TickFeedSubscriber::Open(config_.tick_feed_name);
+  ASSERT_TRUE(subscriber.has_value()) << subscriber.error();
+  EXPECT_EQ(subscriber.value()->sequence(), 5);
+  auto tick = subscriber.value()->poll();
+  ASSERT_TRUE(tick.has_value());
+  EXPECT_DOUBLE_EQ(tick->price, MakeTick(5).price);
+}
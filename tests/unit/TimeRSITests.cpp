@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "trading/TimeRSI.h"
+
+using namespace std::chrono_literals;
+
+TEST(TimeRSITest, Update_FirstTick_IsNeutral) {
+  TimeRSI rsi(1s, 100ms);
+
+  EXPECT_DOUBLE_EQ(rsi.update({0ms, 100.0, 1.0}), 50.0);
+}
+
+TEST(TimeRSITest, Update_OnlyGains_Returns100) {
+  TimeRSI rsi(1s, 100ms);
+
+  rsi.update({0ms, 100.0, 1.0});
+  rsi.update({100ms, 101.0, 1.0});
+  double result = rsi.update({200ms, 103.0, 1.0});
+
+  EXPECT_DOUBLE_EQ(result, 100.0);
+}
+
+TEST(TimeRSITest, Update_OnlyLosses_Returns0) {
+  TimeRSI rsi(1s, 100ms);
+
+  rsi.update({0ms, 100.0, 1.0});
+  double result = rsi.update({100ms, 95.0, 1.0});
+
+  EXPECT_DOUBLE_EQ(result, 0.0);
+}
+
+TEST(TimeRSITest, Update_MixedChanges_RatioOfGains) {
+  TimeRSI rsi(1s, 100ms);
+
+  rsi.update({0ms, 100.0, 1.0});
+  rsi.update({100ms, 103.0, 1.0});
+  double result = rsi.update({200ms, 102.0, 1.0});
+
+  // gains 3, losses 1
+  EXPECT_DOUBLE_EQ(result, 75.0);
+}
+
+TEST(TimeRSITest, Update_ChangesExpire) {
+  TimeRSI rsi(1s, 100ms);
+
+  rsi.update({0ms, 100.0, 1.0});
+  rsi.update({100ms, 90.0, 1.0});
+  rsi.update({600ms, 92.0, 1.0});
+  double result = rsi.update({1100ms, 91.0, 1.0});
+
+  // The -10 change at 100ms has left the window: gains 2, losses 1
+  EXPECT_NEAR(result, 100.0 * 2.0 / 3.0, 1e-9);
+}
+
+TEST(TimeRSITest, SaveLoad_ContinuesIdentically) {
+  TimeRSI original(1s, 100ms);
+  original.update({0ms, 100.0, 1.0});
+  original.update({300ms, 104.0, 1.0});
+
+  SnapshotWriter writer;
+  original.save(writer);
+  TimeRSI restored(1s, 100ms);
+  SnapshotReader reader(std::move(writer).release());
+  restored.load(reader);
+
+  EXPECT_DOUBLE_EQ(restored.update({600ms, 101.0, 1.0}),
+                   original.update({600ms, 101.0, 1.0}));
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "trading/TimeSMA.h"
+
+using namespace std::chrono_literals;
+
+TEST(TimeSMATest, GetCurrentPrice_BeforeUpdate_ReturnsZero) {
+  TimeSMA sma(1s, 100ms);
+
+  EXPECT_DOUBLE_EQ(sma.getCurrentPrice(), 0.0);
+}
+
+TEST(TimeSMATest, Update_FirstTick_ReturnsTickPrice) {
+  TimeSMA sma(1s, 100ms);
+
+  EXPECT_DOUBLE_EQ(sma.update({100ms, 150.0, 10.0}), 150.0);
+}
+
+TEST(TimeSMATest, Update_AveragesTicksInWindow) {
+  TimeSMA sma(1s, 100ms);
+
+  sma.update({0ms, 100.0, 1.0});
+  sma.update({400ms, 110.0, 1.0});
+  Price result = sma.update({800ms, 120.0, 1.0});
+
+  EXPECT_DOUBLE_EQ(result, 110.0);
+}
+
+TEST(TimeSMATest, Update_DropsTicksOlderThanWindow) {
+  TimeSMA sma(1s, 100ms);
+
+  sma.update({0ms, 100.0, 1.0});
+  sma.update({500ms, 110.0, 1.0});
+  // The tick at 0ms is exactly one window old and leaves the window
+  Price result = sma.update({1000ms, 120.0, 1.0});
+
+  EXPECT_DOUBLE_EQ(result, 115.0);
+}
+
+TEST(TimeSMATest, Update_NonPositiveWindow_HoldsNoTicks) {
+  for (auto window : {0s, -1s}) {
+    TimeSMA sma(window, 100ms);
+
+    EXPECT_DOUBLE_EQ(sma.update({0ms, 100.0, 1.0}), 0.0);
+    EXPECT_DOUBLE_EQ(sma.update({100ms, 110.0, 1.0}), 0.0);
+  }
+}
+
+TEST(TimeSMATest, Update_MatchesNaiveWindowMean) {
+  TimeSMA sma(2s, 50ms);
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> dt(50, 200);
+  std::normal_distribution<double> move(0.0, 0.5);
+
+  std::vector<Tick> ticks;
+  Tick tick{0ns, 100.0, 1.0};
+  for (int i = 0; i < 1000; ++i) {
+    tick.timestamp += std::chrono::milliseconds(dt(gen));
+    tick.price += move(gen);
+    ticks.push_back(tick);
+    Price actual = sma.update(tick);
+
+    double sum = 0;
+    int count = 0;
+    for (const auto& t : ticks) {
+      if (t.timestamp > tick.timestamp - 2s) {
+        sum += t.price;
+        ++count;
+      }
+    }
+    ASSERT_NEAR(actual, sum / count, 1e-9) << "tick " << i;
+  }
+}
+
+TEST(TimeSMATest, SaveLoad_ContinuesIdentically) {
+  TimeSMA original(1s, 100ms);
+  original.update({0ms, 100.0, 1.0});
+  original.update({300ms, 104.0, 1.0});
+
+  SnapshotWriter writer;
+  original.save(writer);
+  TimeSMA restored(1s, 100ms);
+  SnapshotReader reader(std::move(writer).release());
+  restored.load(reader);
+
+  EXPECT_DOUBLE_EQ(restored.update({1100ms, 90.0, 1.0}),
+                   original.update({1100ms, 90.0, 1.0}));
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "trading/TimeVWAP.h"
+
+using namespace std::chrono_literals;
+
+TEST(TimeVWAPTest, Update_FirstTick_ReturnsTickPrice) {
+  TimeVWAP vwap(1s, 100ms);
+
+  EXPECT_DOUBLE_EQ(vwap.update({0ms, 100.0, 10.0}), 100.0);
+}
+
+TEST(TimeVWAPTest, Update_WeightsByVolume) {
+  TimeVWAP vwap(1s, 100ms);
+
+  vwap.update({0ms, 100.0, 30.0});
+  Price result = vwap.update({200ms, 200.0, 10.0});
+
+  EXPECT_DOUBLE_EQ(result, 125.0);
+  EXPECT_DOUBLE_EQ(vwap.getVolume(), 40.0);
+}
+
+TEST(TimeVWAPTest, Update_DropsTicksOlderThanWindow) {
+  TimeVWAP vwap(1s, 100ms);
+
+  vwap.update({0ms, 100.0, 30.0});
+  vwap.update({600ms, 200.0, 10.0});
+  Price result = vwap.update({1200ms, 300.0, 10.0});
+
+  EXPECT_DOUBLE_EQ(result, 250.0);
+  EXPECT_DOUBLE_EQ(vwap.getVolume(), 20.0);
+}
+
+TEST(TimeVWAPTest, Update_NonPositiveWindow_ReturnsLastPrice) {
+  for (auto window : {0s, -1s}) {
+    TimeVWAP vwap(window, 100ms);
+
+    EXPECT_DOUBLE_EQ(vwap.update({0ms, 100.0, 10.0}), 100.0);
+    EXPECT_DOUBLE_EQ(vwap.update({100ms, 110.0, 10.0}), 110.0);
+    EXPECT_DOUBLE_EQ(vwap.getVolume(), 0.0);
+  }
+}
+
+TEST(TimeVWAPTest, Update_ZeroVolume_ReturnsLastPrice) {
+  TimeVWAP vwap(1s, 100ms);
+
+  EXPECT_DOUBLE_EQ(vwap.update({0ms, 100.0, 0.0}), 100.0);
+  EXPECT_DOUBLE_EQ(vwap.update({100ms, 101.0, 0.0}), 101.0);
+}
+
+TEST(TimeVWAPTest, SaveLoad_ContinuesIdentically) {
+  TimeVWAP original(1s, 100ms);
+  original.update({0ms, 100.0, 5.0});
+  original.update({500ms, 102.0, 7.0});
+
+  SnapshotWriter writer;
+  original.save(writer);
+  TimeVWAP restored(1s, 100ms);
+  SnapshotReader reader(std::move(writer).release());
+  restored.load(reader);
+
+  EXPECT_DOUBLE_EQ(restored.update({1200ms, 99.0, 3.0}),
+                   original.update({1200ms, 99.0, 3.0}));
+}
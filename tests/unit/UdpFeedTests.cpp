@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include "common/Snapshot.h"
+#include "config/Config.h"
+#include "feed/UdpFeedPublisher.h"
+#include "feed/UdpFeedSubscriber.h"
+
+class UdpFeedTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Distinct ports per test process, so parallel test runs do not collide
+    const auto base = static_cast<uint16_t>(20000 + (::getpid() % 2000) * 16);
+    config_.udp_feed_port = base;
+    config_.udp_replay_port = base + 1;
+    config_.udp_feed_batch = 4;
+    config_.udp_replay_capacity = 256;
+  }
+
+  std::unique_ptr<UdpFeedSubscriber> Subscribe() {
+    auto subscriber =
+        UdpFeedSubscriber::Open(config_.udp_feed_port, config_.udp_replay_port);
+    EXPECT_TRUE(subscriber.has_value()) << subscriber.error();
+    return subscriber ? std::move(subscriber.value()) : nullptr;
+  }
+
+  static Tick MakeTick(int i) {
+    return {std::chrono::nanoseconds(i * 1000), 100.0 + i, 1.0 * i};
+  }
+
+  static void ExpectTicksInOrder(UdpFeedSubscriber& subscriber, int count) {
+    for (int i = 0; i < count; ++i) {
+      auto tick = subscriber.next();
+      ASSERT_TRUE(tick.has_value()) << "tick " << i;
+      EXPECT_EQ(tick->timestamp, MakeTick(i).timestamp);
+      EXPECT_DOUBLE_EQ(tick->price, MakeTick(i).price);
+      EXPECT_DOUBLE_EQ(tick->volume, MakeTick(i).volume);
+    }
+  }
+
+  Config config_;
+};
+
+TEST_F(UdpFeedTest, Subscriber_ReceivesEveryTickThenEnd) {
+  auto subscriber = Subscribe();
+  ASSERT_NE(subscriber, nullptr);
+  {
+    UdpFeedPublisher publisher(config_);
+    for (int i = 0; i < 102; ++i) {
+      ASSERT_FALSE(publisher.writeTick(MakeTick(i)).has_value());
+    }
+  }
+
+  ExpectTicksInOrder(*subscriber, 102);
+  EXPECT_FALSE(subscriber->next().has_value());
+  EXPECT_EQ(subscriber->stats().ticks, 102);
+  EXPECT_EQ(subscriber->stats().gaps, 0);
+  EXPECT_EQ(subscriber->stats().lost, 0);
+}
+
+TEST_F(UdpFeedTest, Publisher_BatchesTicksPerDatagram) {
+  auto subscriber = Subscribe();
+  ASSERT_NE(subscriber, nullptr);
+  uint64_t datagrams = 0;
+  {
+    UdpFeedPublisher publisher(config_);
+    for (int i = 0; i < 128; ++i) {
+      publisher.writeTick(MakeTick(i));
+    }
+    datagrams = publisher.datagrams();
+  }
+
+  EXPECT_EQ(datagrams, 32);
+  ExpectTicksInOrder(*subscriber, 128);
+}
+
+TEST_F(UdpFeedTest, LateSubscriber_RecoversMissedTicksByReplay) {
+  UdpFeedPublisher publisher(config_);
+  // One full sendmmsg batch goes out before anyone listens
+  const int unheard = 4 * UdpFeedPublisher::kPacketsPerSend;
+  for (int i = 0; i < unheard; ++i) {
+    publisher.writeTick(MakeTick(i));
+  }
+
+  auto subscriber = Subscribe();
+  ASSERT_NE(subscriber, nullptr);
+  for (int i = unheard; i < 2 * unheard; ++i) {
+    publisher.writeTick(MakeTick(i));
+  }
+
+  ExpectTicksInOrder(*subscriber, 2 * unheard);
+  EXPECT_EQ(subscriber->stats().gaps, 1);
+  EXPECT_EQ(subscriber->stats().recovered, unheard);
+  EXPECT_EQ(subscriber->stats().lost, 0);
+  EXPECT_EQ(publisher.replays(), 1);
+}
+
+TEST_F(UdpFeedTest, LaggingSubscriber_FindsEndByReplay) {
+  config_.udp_replay_capacity = 4096;
+  auto opened = UdpFeedSubscriber::Open(config_.udp_feed_port,
+                                        config_.udp_replay_port, 1);
+  ASSERT_TRUE(opened.has_value()) << opened.error();
+  auto subscriber = std::move(opened.value());
+  // The smallest receive buffer overflows long before the end datagrams
+  constexpr int kTicks = 2000;
+  std::atomic<bool> written = false;
+  std::jthread publishing([&] {
+    UdpFeedPublisher publisher(config_);
+    for (int i = 0; i < kTicks; ++i) {
+      publisher.writeTick(MakeTick(i));
+    }
+    written = true;
+  });
+  while (!written) std::this_thread::yield();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+  ExpectTicksInOrder(*subscriber, kTicks);
+  EXPECT_FALSE(subscriber->next().has_value());
+  EXPECT_GT(subscriber->stats().recovered, 0);
+  EXPECT_EQ(subscriber->stats().lost, 0);
+}
+
+TEST_F(UdpFeedTest, TicksBeyondReplayCapacity_CountedAsLost) {
+  config_.udp_feed_batch = 1;
+  config_.udp_replay_capacity = 32;
+  UdpFeedPublisher publisher(config_);
+  const int per_send = UdpFeedPublisher::kPacketsPerSend;
+  for (int i = 0; i < 4 * per_send; ++i) {
+    publisher.writeTick(MakeTick(i));
+  }
+
+  auto subscriber = Subscribe();
+  ASSERT_NE(subscriber, nullptr);
+  for (int i = 4 * per_send; i < 5 * per_send; ++i) {
+    publisher.writeTick(MakeTick(i));
+  }
+
+  // The ring holds ticks [5 * per_send - 32, 5 * per_send): of the unheard
+  // ones only the last per_send can be replayed
+  auto tick = subscriber->next();
+  ASSERT_TRUE(tick.has_value());
+  EXPECT_DOUBLE_EQ(tick->price, MakeTick(3 * per_send).price);
+  EXPECT_EQ(subscriber->stats().recovered, per_send);
+  EXPECT_EQ(subscriber->stats().lost, 3 * per_send);
+}
+
+TEST_F(UdpFeedTest, Load_ContinuesNumbering) {
+  auto subscriber = Subscribe();
+  ASSERT_NE(subscriber, nullptr);
+  SnapshotWriter writer;
+  writer.write(uint64_t{0});
+  {
+    UdpFeedPublisher publisher(config_);
+    SnapshotReader reader(writer.data());
+    ASSERT_FALSE(publisher.load(reader).has_value());
+    for (int i = 0; i < 8; ++i) {
+      publisher.writeTick(MakeTick(i));
+    }
+    SnapshotWriter saved;
+    publisher.save(saved);
+    uint64_t sequence = 0;
+    SnapshotReader saved_reader(saved.data());
+    saved_reader.read(sequence);
+    EXPECT_EQ(sequence, 8);
+  }
+
+  ExpectTicksInOrder(*subscriber, 8);
+  EXPECT_FALSE(subscriber->next().has_value());
+}
+
+TEST_F(UdpFeedTest, PortInUse_SubscriberOpenFails) {
+  auto first = Subscribe();
+  ASSERT_NE(first, nullptr);
+
+  auto second =
+      UdpFeedSubscriber::Open(config_.udp_feed_port, config_.udp_replay_port);
+  ASSERT_FALSE(second.has_value());
+  EXPECT_NE(second.error().find("UdpFeedSubscriber"), std::string::npos);
+}
+
+TEST_F(UdpFeedTest, ReplayPortInUse_PublisherThrows) {
+  UdpFeedPublisher publisher(config_);
+
+  EXPECT_THROW(UdpFeedPublisher second(config_), std::runtime_error);
+}